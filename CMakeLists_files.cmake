@@ -197,6 +197,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+    opm/input/eclipse/Parser/DeckCache.cpp
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/InputErrorAction.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
@@ -230,6 +231,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/ScheduleDeck.cpp
     opm/input/eclipse/Schedule/ScheduleGrid.cpp
     opm/input/eclipse/Schedule/ScheduleRestartInfo.cpp
+    opm/input/eclipse/Schedule/ScheduleReplay.cpp
     opm/input/eclipse/Schedule/ScheduleState.cpp
     opm/input/eclipse/Schedule/ScheduleStatic.cpp
     opm/input/eclipse/Schedule/ScheduleTypes.cpp
@@ -394,6 +396,7 @@ if(ENABLE_ECL_OUTPUT)
           opm/io/eclipse/ERsm.cpp
           opm/io/eclipse/ESmry.cpp
           opm/io/eclipse/ExtESmry.cpp
+          opm/io/eclipse/MappedFile.cpp
           opm/io/eclipse/ESmry_write_rsm.cpp
           opm/io/eclipse/OutputStream.cpp
           opm/io/eclipse/ExtSmryOutput.cpp
@@ -456,6 +459,8 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_cubic.cpp
       tests/test_EvaluationFormat.cpp
       tests/test_densead.cpp
+      tests/test_EvaluationBatch.cpp
+      tests/test_EvaluationExpression.cpp
       tests/test_messagelimiter.cpp
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmInputError_format.cpp
@@ -465,6 +470,7 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_SegmentMatcher.cpp
       tests/test_sparsevector.cpp
       tests/test_uniformtablelinear.cpp
+      tests/material/test_1dtables.cpp
       tests/material/test_2dtables.cpp
       tests/material/test_blackoilfluidstate.cpp
       tests/material/test_components.cpp
@@ -524,6 +530,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/COMPSEGUnits.cpp
     tests/parser/CompositionalTests.cpp
     tests/parser/CopyRegTests.cpp
+    tests/parser/DeckCacheTests.cpp
     tests/parser/DeckValueTests.cpp
     tests/parser/DeckTests.cpp
     tests/parser/EclipseGridTests.cpp
@@ -1010,11 +1017,14 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/ConditionalStorage.hpp
       opm/material/common/Means.hpp
       opm/material/common/IntervalTabulated2DFunction.hpp
+      opm/material/common/SegmentLocator.hpp
       opm/material/common/Tabulated1DFunction.hpp
       opm/material/densead/Evaluation9.hpp
       opm/material/densead/Evaluation8.hpp
       opm/material/densead/Evaluation7.hpp
       opm/material/densead/Evaluation.hpp
+      opm/material/densead/EvaluationBatch.hpp
+      opm/material/densead/EvaluationExpression.hpp
       opm/material/densead/Evaluation5.hpp
       opm/material/densead/Evaluation3.hpp
       opm/material/densead/Evaluation4.hpp
@@ -1132,6 +1142,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Units/UnitSystem.hpp
        opm/input/eclipse/Units/Units.hpp
        opm/input/eclipse/Units/Dimension.hpp
+       opm/input/eclipse/Parser/DeckCache.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
        opm/input/eclipse/Parser/Parser.hpp
@@ -1406,6 +1417,7 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/EclArrayView.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -1417,6 +1429,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/ERsm.hpp
         opm/io/eclipse/ESmry.hpp
         opm/io/eclipse/ExtESmry.hpp
+        opm/io/eclipse/MappedFile.hpp
         opm/io/eclipse/PaddedOutputString.hpp
         opm/io/eclipse/OutputStream.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
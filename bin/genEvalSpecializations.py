@@ -97,6 +97,11 @@ namespace DenseAd {
 //! is run-time determined
 static constexpr int DynamicSize = -1;
 
+//! Lazily evaluated expression of Evaluation objects, see
+//! EvaluationExpression.hpp
+template <class Eval, class Node>
+class Expression;
+
 {% endif %}\
 {% if numDerivs < 0 %}\
 /*!
@@ -246,6 +251,15 @@ public:
 
         checkDefined_();
     }
+
+    // evaluate an expression template, see EvaluationExpression.hpp
+    template <class Node>
+    Evaluation(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        checkDefined_();
+    }
 {% endif %}\
 
     // create an evaluation which represents a constant function
@@ -712,6 +726,16 @@ public:
         return *this;
     }
 
+{% if numDerivs >= 0 %}\
+    template <class Node>
+    Evaluation& operator=(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        return *this;
+    }
+
+{% endif %}\
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
@@ -37,54 +37,74 @@
     in the lengths of cell face diagonals and of the diagonals across the
     cell. For a cubical block only the first four terms would exist.
 
+    The coefficients of one coordinate are stored in an array indexed by
+    g = i1 + i2 * 2 + i3 * 4.
 */
 
-double C(const double* r, int i1, int i2, int i3){
-   int g = i1 + i2 * 2 + i3 * 4;
+namespace {
 
-   if (g == 0)
-       return r[0];
-
-   if (g == 1)
-       return r[1] - r[0];
+std::array<double,8> C(const double* r)
+{
+    return {{ r[0],
+              r[1] - r[0],
+              r[2] - r[0],
+              r[3] + r[0] - r[2] - r[1],
+              r[4] - r[0],
+              r[5] + r[0] - r[4] - r[1],
+              r[6] + r[0] - r[4] - r[2],
+              r[7] + r[4] + r[2] + r[1] - r[6] - r[5] - r[3] - r[0] }};
+}
 
-   if (g == 2)
-       return r[2] - r[0];
 
-   if (g == 3)
-       return r[3] + r[0] - r[2] - r[1];
+struct Term {
+    int a;       // index of C(1, pb, pg)
+    int b;       // index of C(qa, 1, qg)
+    int c;       // index of C(ra, rb, 1)
+    double weight;
+};
 
-   if (g == 4)
-       return r[4] - r[0];
 
-   if (g == 5)
-       return r[5] + r[0] - r[4] - r[1];
+/*
+    The terms of the volume integral, one for each combination of the
+    six bits pb, pg, qa, qg, ra and rb.  Precomputing the coefficient
+    indices and weights avoids all branches in the summation.
+*/
+const std::array<Term, 64>& terms()
+{
+    static const std::array<Term, 64> terms = []()
+    {
+        std::array<Term, 64> t{};
+        for (int n = 0; n < 64; ++n) {
+            const int pb = (n >> 5) & 1;
+            const int pg = (n >> 4) & 1;
+            const int qa = (n >> 3) & 1;
+            const int qg = (n >> 2) & 1;
+            const int ra = (n >> 1) & 1;
+            const int rb = (n >> 0) & 1;
+
+            t[n].a = 1 + pb * 2 + pg * 4;
+            t[n].b = qa + 2 + qg * 4;
+            t[n].c = ra + rb * 2 + 4;
+            t[n].weight = 1.0 / ((qa + ra + 1) * (pb + rb + 1) * (pg + qg + 1));
+        }
 
-   if (g == 6)
-       return r[6] + r[0] - r[4] - r[2];
+        return t;
+    }();
 
-   return  r[7] + r[4] + r[2] + r[1] - r[6] - r[5] - r[3] - r[0];
+    return terms;
 }
 
 
-struct pqr_t {
-    int pb;
-    int pg;
-    int qa;
-    int qg;
-    int ra;
-    int rb;
-};
-
-
-double calculateCellVol(const std::array<double,8>& X, const std::array<double,8>& Y, const std::array<double,8>& Z){
+double cellVol(const double* X, const double* Y, const double* Z)
+{
     /*
-      The permutation array should be ordered so that the sign:
+      The permutations are ordered so that the sign:
 
          sign = (-1)^N, N = # permutations
 
       is alternating - so that the sign can just be changed multiplying with -1.
     */
+    const std::array<std::array<double,8>,3> coeff = {{ C(X), C(Y), C(Z) }};
     static const std::array< std::array<std::size_t, 3>, 6 > permutation = {{{ 0, 1, 2},
                                                                              { 0, 2, 1},
                                                                              { 1, 2, 0},
@@ -92,44 +112,90 @@ double calculateCellVol(const std::array<double,8>& X, const std::array<double,8
                                                                              { 2, 0, 1},
                                                                              { 2, 1, 0}}};
 
-
-    static const std::array<pqr_t, 64> pqr_array
-        = {{{0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1}, {0, 0, 0, 0, 1, 0}, {0, 0, 0, 0, 1, 1},
-            {0, 0, 0, 1, 0, 0}, {0, 0, 0, 1, 0, 1}, {0, 0, 0, 1, 1, 0}, {0, 0, 0, 1, 1, 1},
-            {0, 0, 1, 0, 0, 0}, {0, 0, 1, 0, 0, 1}, {0, 0, 1, 0, 1, 0}, {0, 0, 1, 0, 1, 1},
-            {0, 0, 1, 1, 0, 0}, {0, 0, 1, 1, 0, 1}, {0, 0, 1, 1, 1, 0}, {0, 0, 1, 1, 1, 1},
-            {0, 1, 0, 0, 0, 0}, {0, 1, 0, 0, 0, 1}, {0, 1, 0, 0, 1, 0}, {0, 1, 0, 0, 1, 1},
-            {0, 1, 0, 1, 0, 0}, {0, 1, 0, 1, 0, 1}, {0, 1, 0, 1, 1, 0}, {0, 1, 0, 1, 1, 1},
-            {0, 1, 1, 0, 0, 0}, {0, 1, 1, 0, 0, 1}, {0, 1, 1, 0, 1, 0}, {0, 1, 1, 0, 1, 1},
-            {0, 1, 1, 1, 0, 0}, {0, 1, 1, 1, 0, 1}, {0, 1, 1, 1, 1, 0}, {0, 1, 1, 1, 1, 1},
-            {1, 0, 0, 0, 0, 0}, {1, 0, 0, 0, 0, 1}, {1, 0, 0, 0, 1, 0}, {1, 0, 0, 0, 1, 1},
-            {1, 0, 0, 1, 0, 0}, {1, 0, 0, 1, 0, 1}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 1},
-            {1, 0, 1, 0, 0, 0}, {1, 0, 1, 0, 0, 1}, {1, 0, 1, 0, 1, 0}, {1, 0, 1, 0, 1, 1},
-            {1, 0, 1, 1, 0, 0}, {1, 0, 1, 1, 0, 1}, {1, 0, 1, 1, 1, 0}, {1, 0, 1, 1, 1, 1},
-            {1, 1, 0, 0, 0, 0}, {1, 1, 0, 0, 0, 1}, {1, 1, 0, 0, 1, 0}, {1, 1, 0, 0, 1, 1},
-            {1, 1, 0, 1, 0, 0}, {1, 1, 0, 1, 0, 1}, {1, 1, 0, 1, 1, 0}, {1, 1, 0, 1, 1, 1},
-            {1, 1, 1, 0, 0, 0}, {1, 1, 1, 0, 0, 1}, {1, 1, 1, 0, 1, 0}, {1, 1, 1, 0, 1, 1},
-            {1, 1, 1, 1, 0, 0}, {1, 1, 1, 1, 0, 1}, {1, 1, 1, 1, 1, 0}, {1, 1, 1, 1, 1, 1}}};
+    const auto& term = terms();
 
     double volume = 0.0;
-    const double* vect[3];
-    const std::array<std::array<double,8>,3> data = {{X, Y, Z}};
     double perm_sign = 1;
     for (const auto& perm : permutation) {
-        for (std::size_t perm_index = 0; perm_index < 3; perm_index++)
-            vect[perm_index] = data[perm[perm_index]].data();
+        const double* cp = coeff[perm[0]].data();
+        const double* cq = coeff[perm[1]].data();
+        const double* cr = coeff[perm[2]].data();
 
-        for (const auto& pqr : pqr_array) {
-            const double cprod = C(vect[0], 1, pqr.pb, pqr.pg)*C(vect[1], pqr.qa, 1, pqr.qg)*C(vect[2], pqr.ra, pqr.rb, 1);
-            const double denom = (pqr.qa + pqr.ra + 1) * (pqr.pb + pqr.rb + 1) * (pqr.pg + pqr.qg + 1);
-            volume += perm_sign * cprod / denom;
-        }
+        double sum = 0.0;
+        for (const auto& t : term)
+            sum += cp[t.a] * cq[t.b] * cr[t.c] * t.weight;
 
+        volume += perm_sign * sum;
         perm_sign *= -1;
     }
+
     return std::fabs(volume);
 }
 
+} // Anonymous namespace
+
+
+double calculateCellVol(const std::array<double,8>& X, const std::array<double,8>& Y, const std::array<double,8>& Z){
+    return cellVol(X.data(), Y.data(), Z.data());
+}
+
+
+/*
+    The batch variant works on blocks of cells.  The expansion coefficients
+    of a block are stored as one array of cells per coordinate and
+    coefficient, so the summation of the terms runs over contiguous cells
+    with the same coefficient indices and weight.  The arithmetic of each
+    cell is the same as in cellVol(), so are the results.
+*/
+void calculateCellVol(const std::size_t n, const double* X, const double* Y, const double* Z, double* volume)
+{
+    constexpr std::size_t blockSize = 64;
+    static const std::array< std::array<std::size_t, 3>, 6 > permutation = {{{ 0, 1, 2},
+                                                                             { 0, 2, 1},
+                                                                             { 1, 2, 0},
+                                                                             { 1, 0, 2},
+                                                                             { 2, 0, 1},
+                                                                             { 2, 1, 0}}};
+    const auto& term = terms();
+
+    std::array<std::array<std::array<double, blockSize>, 8>, 3> coeff;
+    std::array<double, blockSize> sum;
+    std::array<double, blockSize> block_volume;
+
+    for (std::size_t start = 0; start < n; start += blockSize) {
+        const std::size_t m = std::min(blockSize, n - start);
+
+        const std::array<const double*, 3> coords {{ X + 8*start, Y + 8*start, Z + 8*start }};
+        for (std::size_t dim = 0; dim < 3; ++dim) {
+            for (std::size_t cell = 0; cell < m; ++cell) {
+                const auto c = C(coords[dim] + 8*cell);
+                for (std::size_t g = 0; g < 8; ++g)
+                    coeff[dim][g][cell] = c[g];
+            }
+        }
+
+        std::fill_n(block_volume.begin(), m, 0.0);
+        double perm_sign = 1;
+        for (const auto& perm : permutation) {
+            std::fill_n(sum.begin(), m, 0.0);
+            for (const auto& t : term) {
+                const double* cp = coeff[perm[0]][t.a].data();
+                const double* cq = coeff[perm[1]][t.b].data();
+                const double* cr = coeff[perm[2]][t.c].data();
+                for (std::size_t cell = 0; cell < m; ++cell)
+                    sum[cell] += cp[cell] * cq[cell] * cr[cell] * t.weight;
+            }
+
+            for (std::size_t cell = 0; cell < m; ++cell)
+                block_volume[cell] += perm_sign * sum[cell];
+            perm_sign *= -1;
+        }
+
+        for (std::size_t cell = 0; cell < m; ++cell)
+            volume[start + cell] = std::fabs(block_volume[cell]);
+    }
+}
+
 
 /* 
     Cell volume calculation for a cell from a cylindrical grid, given by the
@@ -15,14 +15,19 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <vector>
 #include <array>
+#include <cstddef>
+#include <vector>
 #include <math.h>  
 
 #ifndef CALCULATE_CELLVOL
 #define CALCULATE_CELLVOL
 
 double calculateCellVol(const std::array<double,8>& X, const std::array<double,8>& Y, const std::array<double,8>& Z);
+
+// Volumes of n cells.  The corner coordinates are stored cell by cell, i.e.,
+// X[8*cell + corner], in the same corner order as for a single cell.
+void calculateCellVol(std::size_t n, const double* X, const double* Y, const double* Z, double* volume);
 double calculateCylindricalCellVol(const double R1, const double R2, const double dTheta, const double dZ);
 
 #endif
@@ -17,6 +17,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -45,16 +46,54 @@ namespace Opm {
 
 
 std::size_t Deck::count(const std::string& keyword) const {
-    return this->global_view().count(keyword);
+    auto iter = this->keyword_index->find(keyword);
+    if (iter == this->keyword_index->end())
+        return 0;
+
+    return iter->second.size();
 }
 
-const DeckView& Deck::global_view() const {
-    if (!this->m_global_view) {
-        this->m_global_view = std::make_unique<DeckView>();
-        for (const auto& kw : this->keywordList)
-            this->m_global_view->add_keyword(kw);
+void Deck::releaseArrayData() {
+    for (auto& keyword : this->keywordList) {
+        if (!keyword.isDataKeyword())
+            continue;
+
+        for (std::size_t r = 0; r < keyword.size(); ++r) {
+            auto& record = keyword.getRecord(r);
+            for (std::size_t i = 0; i < record.size(); ++i)
+                record.getItem(i).releaseData();
+        }
     }
-    return *this->m_global_view;
+}
+
+DeckView Deck::global_view() const {
+    return this->view(0, this->keywordList.size());
+}
+
+DeckView Deck::view(std::size_t begin, std::size_t end) const {
+    if (begin > end || end > this->keywordList.size())
+        throw std::out_of_range("Invalid deck view range");
+
+    return DeckView(this->keywordList, this->keyword_index, begin, end);
+}
+
+void Deck::rebuild_index() {
+    this->keyword_index->clear();
+    for (std::size_t index = 0; index < this->keywordList.size(); index++)
+        (*this->keyword_index)[this->keywordList[index].name()].push_back(index);
+}
+
+const std::vector<std::size_t> Deck::index(const std::string& keyword) const {
+    auto iter = this->keyword_index->find(keyword);
+    if (iter == this->keyword_index->end())
+        return {};
+
+    return iter->second;
+}
+
+void Deck::remove_keywords(int from, int to) {
+    this->keywordList.erase(this->keywordList.begin() + from, this->keywordList.begin() + to);
+    this->rebuild_index();
 }
 
     Opm::DeckView Deck::operator[](const std::string& keyword) const {
@@ -74,6 +113,7 @@ const DeckView& Deck::global_view() const {
         , input_path( d.input_path )
         , file_tree( d.file_tree )
         , unit_system_access_count(d.unit_system_access_count)
+        , keyword_index( std::make_shared<DeckView::index_type>(*d.keyword_index) )
     {
     }
 
@@ -85,7 +125,10 @@ const DeckView& Deck::global_view() const {
         , input_path( d.input_path )
         , file_tree( std::move(d.file_tree) )
         , unit_system_access_count(d.unit_system_access_count)
+        , keyword_index( std::move(d.keyword_index) )
     {
+        // Views of d keep the moved index alive.
+        d.keyword_index = std::make_shared<DeckView::index_type>();
     }
 
     Deck Deck::serializationTestObject()
@@ -97,6 +140,7 @@ const DeckView& Deck::global_view() const {
         result.m_dataFile = "test1";
         result.input_path = "test2";
         result.unit_system_access_count = 1;
+        result.rebuild_index();
 
         return result;
     }
@@ -111,8 +155,8 @@ const DeckView& Deck::global_view() const {
         else if (keyword.name() == "PVT-M")
             this->selectActiveUnitSystem( UnitSystem::UnitType::UNIT_TYPE_PVT_M );
 
+        (*this->keyword_index)[keyword.name()].push_back(this->keywordList.size());
         this->keywordList.push_back( std::move( keyword ) );
-        this->m_global_view = nullptr;
     }
 
     void Deck::addKeyword( const DeckKeyword& keyword ) {
@@ -224,6 +268,7 @@ const DeckView& Deck::global_view() const {
         input_path = data.input_path;
         unit_system_access_count = data.unit_system_access_count;
         activeUnits = data.activeUnits;
+        keyword_index = std::make_shared<DeckView::index_type>(*data.keyword_index);
 
         return *this;
     }
@@ -257,7 +302,7 @@ const DeckView& Deck::global_view() const {
     }
 
     bool Deck::hasKeyword(const std::string& keyword) const {
-        return this->global_view().has_keyword(keyword);
+        return this->keyword_index->find(keyword) != this->keyword_index->end();
     }
 
 }
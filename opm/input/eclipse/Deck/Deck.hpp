@@ -103,10 +103,13 @@ namespace Opm {
             void serializeOp(Serializer& serializer)
             {
                 serializer(keywordList);
+                if (!serializer.isSerializing())
+                    this->rebuild_index();
                 serializer(defaultUnits);
                 serializer(activeUnits);
                 serializer(m_dataFile);
                 serializer(input_path);
+                serializer(file_tree);
                 serializer(unit_system_access_count);
             }
 
@@ -119,9 +122,7 @@ namespace Opm {
 
 
 
-            const std::vector<std::size_t> index(const std::string& keyword) const {
-                return this->global_view().index(keyword);
-            }
+            const std::vector<std::size_t> index(const std::string& keyword) const;
 
             template< class Keyword >
             std::size_t count() const {
@@ -129,7 +130,19 @@ namespace Opm {
             }
             size_t count(const std::string& keyword) const;
 
-            void remove_keywords(int from, int to) { keywordList.erase(keywordList.begin() +from, keywordList.begin() + to); };     
+            void remove_keywords(int from, int to);
+
+            // View of the keywords [begin, end).  The view shares the keyword
+            // index of the deck, so it is created in constant time.
+            DeckView view(std::size_t begin, std::size_t end) const;
+
+            // Release the values of all data keywords, i.e., the per-cell
+            // arrays like ZCORN and PORO, once the EclipseState has been
+            // constructed.  The keywords remain in the deck, but are empty.
+            // An EclipseState with lazy field properties still reads these
+            // arrays, so call fieldProps().apply_deferred_operations() on it
+            // first.
+            void releaseArrayData();
 
         private:
 
@@ -142,8 +155,13 @@ namespace Opm {
             DeckTree file_tree;
             mutable std::size_t unit_system_access_count = 0;
 
-            const DeckView& global_view() const;
-            mutable std::unique_ptr<DeckView> m_global_view{nullptr};
+            // Positions of all keywords by name, maintained as keywords are
+            // added.  Shared with the section views, which therefore remain
+            // valid when the deck is moved.
+            std::shared_ptr<DeckView::index_type> keyword_index{std::make_shared<DeckView::index_type>()};
+
+            DeckView global_view() const;
+            void rebuild_index();
     };
 }
 #endif  /* DECK_HPP */
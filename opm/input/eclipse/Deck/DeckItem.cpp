@@ -78,6 +78,27 @@ const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
 }
 
 
+void DeckItem::push_status( value::status status, std::size_t n ) {
+    if (n == 0)
+        return;
+
+    if (!this->status_runs.empty() && (this->status_runs.back().second == status))
+        this->status_runs.back().first += n;
+    else
+        this->status_runs.emplace_back(this->data_size() + n, status);
+
+    this->value_status.clear();
+}
+
+template< typename Func >
+void DeckItem::for_each_status( Func&& func ) const {
+    std::size_t begin = 0;
+    for (const auto& [end, status] : this->status_runs) {
+        func(begin, end, status);
+        begin = end;
+    }
+}
+
 DeckItem::DeckItem( const std::string& nm, int) :
     type( get_type< int >() ),
     item_name( nm )
@@ -122,7 +143,7 @@ DeckItem DeckItem::serializationTestObject()
     result.uval = {UDAValue(3.0)};
     result.type = type_tag::string;
     result.item_name = "test2";
-    result.value_status = {value::status::deck_value};
+    result.status_runs = {{1, value::status::deck_value}};
     result.raw_data = false;
     result.active_dimensions = {Dimension::serializationTestObject()};
     result.default_dimensions = {Dimension::serializationTestObject()};
@@ -135,31 +156,61 @@ const std::string& DeckItem::name() const {
 }
 
 bool DeckItem::defaultApplied( size_t index ) const {
-    return value::defaulted( this->value_status.at(index));
+    return value::defaulted( this->getValueStatus(index) );
 }
 
 const std::vector<value::status>& DeckItem::getValueStatus() const {
+    if (this->value_status.size() != this->data_size()) {
+        this->value_status.clear();
+        this->value_status.reserve(this->data_size());
+        this->for_each_status([this](std::size_t begin, std::size_t end, value::status status)
+        {
+            this->value_status.insert(this->value_status.end(), end - begin, status);
+        });
+    }
+
     return this->value_status;
 }
 
+value::status DeckItem::getValueStatus( size_t index ) const {
+    if (index >= this->data_size())
+        throw std::out_of_range("Invalid index");
+
+    // Most items consist of a single run, typically all deck values.
+    if (this->status_runs.size() == 1)
+        return this->status_runs.front().second;
+
+    const auto run = std::upper_bound(this->status_runs.begin(), this->status_runs.end(), index,
+                                      [](std::size_t i, const auto& r) { return i < r.first; });
+    return run->second;
+}
+
 bool DeckItem::hasValue( size_t index ) const {
-    if (index >= this->value_status.size())
+    if (index >= this->data_size())
         return false;
 
-    return value::has_value( this->value_status[index] );
+    return value::has_value( this->getValueStatus(index) );
 }
 
 size_t DeckItem::data_size() const {
-    return this->value_status.size();
+    return this->status_runs.empty() ? 0 : this->status_runs.back().first;
+}
+
+void DeckItem::releaseData() {
+    this->dval = {};
+    this->ival = {};
+    this->sval = {};
+    this->rsval = {};
+    this->uval = {};
+    this->status_runs = {};
+    this->value_status = {};
+    this->raw_data = true;
 }
 
 
 template< typename T >
 T DeckItem::get( size_t index ) const {
-    if (index >= this->value_status.size())
-        throw std::out_of_range("Invalid index");
-
-    if (!value::has_value(this->value_status[index]))
+    if (!value::has_value(this->getValueStatus(index)))
         throw std::invalid_argument("Tried to get uninitialized value from DeckItem index: " + std::to_string(index));
 
     return this->value_ref< T >()[index];
@@ -175,7 +226,7 @@ UDAValue DeckItem::get( size_t index ) const {
     // correctly we therefor need to create a new one with the correct dimension
     // attached before returning.
     std::size_t dim_index = index % this->active_dimensions.size();
-    if (value::defaulted(this->value_status[index])) {
+    if (value::defaulted(this->getValueStatus(index))) {
         if (value.is<std::string>())
             return UDAValue(value.get<std::string>(), this->default_dimensions[dim_index]);
         else
@@ -210,7 +261,7 @@ void DeckItem::push( T x ) {
     auto& val = this->value_ref< T >();
 
     val.push_back( std::move( x ) );
-    this->value_status.push_back( value::status::deck_value );
+    this->push_status( value::status::deck_value, 1 );
 }
 
 void DeckItem::push_back( int x ) {
@@ -238,7 +289,7 @@ void DeckItem::push( T x, size_t n ) {
     auto& val = this->value_ref< T >();
 
     val.insert( val.end(), n, x );
-    this->value_status.insert( this->value_status.end(), n, value::status::deck_value );
+    this->push_status( value::status::deck_value, n );
 }
 
 void DeckItem::push_back( int x, size_t n ) {
@@ -260,12 +311,12 @@ void DeckItem::push_back( UDAValue x, size_t n ) {
 template< typename T >
 void DeckItem::push_default( T x, std::size_t n ) {
     auto& val = this->value_ref< T >();
-    if( this->value_status.size() != val.size() )
+    if( this->data_size() != val.size() )
         throw std::logic_error("To add a value to an item, "
                 "no 'pseudo defaults' can be added before");
 
     val.insert(val.end(), n, std::move( x ) );
-    this->value_status.insert( this->value_status.end(), n, value::status::valid_default );
+    this->push_status( value::status::valid_default, n );
 }
 
 void DeckItem::push_backDefault( int x, std::size_t n ) {
@@ -293,7 +344,7 @@ template<typename T>
 void DeckItem::push_backDummyDefault( std::size_t n ) {
     auto& val = this->value_ref< T >();
     val.insert( val.end(), n, T() );
-    this->value_status.insert( this->value_status.end(), n, value::status::empty_default );
+    this->push_status( value::status::empty_default, n );
 }
 
 std::string DeckItem::getTrimmedString( size_t index ) const {
@@ -311,16 +362,15 @@ const std::vector<double>& DeckItem::getData() const {
         return data;
 
     const auto dim_size = this->active_dimensions.size();
-    for( size_t index = 0; index < data.size(); index++ ) {
-        const auto dimIndex = index % dim_size;
-        if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        } else {
-            const auto& dim = this->active_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        }
-    }
+    this->for_each_status([&data, dim_size, this](std::size_t begin, std::size_t end, value::status status)
+    {
+        const auto& dim = value::defaulted(status)
+            ? this->default_dimensions
+            : this->active_dimensions;
+
+        for (auto index = begin; index < end; ++index)
+            data[index] = dim[index % dim_size].convertSiToRaw(data[index]);
+    });
     this->raw_data = true;
     return data;
 }
@@ -344,14 +394,22 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
     // SI units, so externally the object still behaves as const.
 
     const auto dim_size = this->active_dimensions.size();
-    const auto sz = data.size();
-    for (auto index = 0*sz; index < sz; ++index) {
-        const auto& dim = value::defaulted(this->value_status[index])
+    this->for_each_status([&data, dim_size, this](std::size_t begin, std::size_t end, value::status status)
+    {
+        const auto& dim = value::defaulted(status)
             ? this->default_dimensions
             : this->active_dimensions;
 
-        data[index] = dim[index % dim_size].convertRawToSi(data[index]);
-    }
+        if (dim_size == 1) {
+            const auto& d = dim.front();
+            for (auto index = begin; index < end; ++index)
+                data[index] = d.convertRawToSi(data[index]);
+        }
+        else {
+            for (auto index = begin; index < end; ++index)
+                data[index] = dim[index % dim_size].convertRawToSi(data[index]);
+        }
+    });
 
     this->raw_data = false;
 
@@ -435,7 +493,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
         return false;
 
     if (cmp_default)
-        if (this->value_status != other.value_status)
+        if (this->status_runs != other.status_runs)
             return false;
 
     switch( this->type ) {
@@ -20,7 +20,9 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <iosfwd>
@@ -75,7 +77,16 @@ namespace Opm {
 
         template< typename T > const std::vector< T >& getData() const;
         const std::vector< double >& getSIDoubleData() const;
+
+        // The status of the data points is stored run length encoded; the
+        // vector returned by getValueStatus() is only expanded on demand.
+        // Prefer the indexed version for large numeric items.
         const std::vector<value::status>& getValueStatus() const;
+        value::status getValueStatus( size_t ) const;
+
+        // Release all data points, e.g. for large numeric keywords once
+        // they have been consumed.  The item is empty afterwards.
+        void releaseData();
 
         template< typename T>
         void shrink_to_fit();
@@ -144,7 +155,7 @@ namespace Opm {
             serializer(uval);
             serializer(type);
             serializer(item_name);
-            serializer(value_status);
+            serializer(status_runs);
             serializer(raw_data);
             serializer(active_dimensions);
             serializer(default_dimensions);
@@ -161,7 +172,14 @@ namespace Opm {
         type_tag type = type_tag::unknown;
 
         std::string item_name;
-        std::vector<value::status> value_status;
+
+        // Run length encoded status of the data points; each entry holds
+        // the end of the run (one past its last index) and the status of
+        // all data points in the run.  Adjacent runs always differ.
+        std::vector<std::pair<std::size_t, value::status>> status_runs;
+
+        // Expanded status, built by getValueStatus() on request.
+        mutable std::vector<value::status> value_status;
         /*
           To save space we mutate the dval object in place when asking for SI
           data; the current state of of the dval member is tracked with the
@@ -176,6 +194,8 @@ namespace Opm {
         template< typename T > void push( T );
         template< typename T > void push( T, size_t );
         template< typename T > void push_default( T, std::size_t n );
+        void push_status( value::status, std::size_t n );
+        template< typename Func > void for_each_status( Func&& func ) const;
         template< typename T > void write_vector(DeckOutput& writer, const std::vector<T>& data) const;
     };
 }
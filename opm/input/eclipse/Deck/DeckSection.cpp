@@ -48,46 +48,37 @@ const std::unordered_map<std::string, std::size_t> section_index = {
     {"SCHEDULE", 7}
 };
 
-    std::pair<std::size_t, std::size_t> index_pair(const Deck& deck, const std::string& section) {
+    // The section extends from the first occurrence of the section keyword
+    // to the first subsequent keyword which starts a later section.  Only
+    // the positions of the section keywords are consulted, so the boundaries
+    // are found without scanning the keywords of the section.
+    DeckView section_view(const Deck& deck, const std::string& section) {
         if (!deck.hasKeyword(section))
-            return {0,0};
+            return deck.view(0, 0);
 
-        auto start_index = deck.index(section).front();
-        std::unordered_set<std::string> end_set;
-        {
-            auto this_section_index = section_index.at(section);
+        const auto start_index = deck.index(section).front();
+        const auto this_section_index = section_index.at(section);
 
-            for (const auto& [section_name, index] : section_index) {
-                if (index > this_section_index)
-                    end_set.insert(section_name);
-            }
-        }
-
-        if (end_set.empty())
-            return {start_index, deck.size()};
-
-        std::size_t deck_index = start_index;
-        while (true) {
-            const auto& kw = deck[deck_index];
-            if (end_set.count(kw.name()) == 1)
-                break;
+        auto end_index = deck.size();
+        for (const auto& [section_name, index] : section_index) {
+            if (index <= this_section_index)
+                continue;
 
-            deck_index++;
-
-            if (deck_index == deck.size())
-                break;
+            const auto positions = deck.index(section_name);
+            auto next = std::upper_bound(positions.begin(), positions.end(), start_index);
+            if (next != positions.end())
+                end_index = std::min(end_index, *next);
         }
-        return {start_index, deck_index};
+
+        return deck.view(start_index, end_index);
     }
 
 
     DeckSection::DeckSection( const Deck& deck, const std::string& section )
-        : section_name( section )
+        : DeckView( section_view(deck, section) )
+        , section_name( section )
         , units( deck.getActiveUnitSystem() )
     {
-        auto [start_index, end_index] = index_pair(deck, section);
-        for (std::size_t index = start_index; index < end_index; index++)
-            this->add_keyword(deck[index]);
     }
 
 
@@ -16,34 +16,95 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <functional>
+#include <stdexcept>
+#include <string>
 
 #include <opm/input/eclipse/Deck/DeckView.hpp>
 
 
+Opm::DeckView::DeckView(const std::vector<DeckKeyword>& deck_keywords_arg,
+                        std::shared_ptr<const index_type> deck_index_arg,
+                        std::size_t begin, std::size_t end)
+    : deck_keywords(deck_keywords_arg.data())
+    , deck_index(std::move(deck_index_arg))
+    , slice_begin(begin)
+    , slice_end(end)
+{}
+
+std::pair<const std::size_t*, const std::size_t*>
+Opm::DeckView::slice_positions(const std::string& keyword) const {
+    auto iter = this->deck_index->find(keyword);
+    if (iter == this->deck_index->end())
+        return {nullptr, nullptr};
+
+    const auto& positions = iter->second;
+    const auto* first = std::lower_bound(positions.data(), positions.data() + positions.size(), this->slice_begin);
+    const auto* last = std::lower_bound(first, positions.data() + positions.size(), this->slice_end);
+    return {first, last};
+}
+
+void Opm::DeckView::detach_slice() {
+    if (this->deck_index == nullptr)
+        return;
+
+    const auto* kw_list = this->deck_keywords;
+    const auto begin = this->slice_begin;
+    const auto end = this->slice_end;
+
+    this->deck_keywords = nullptr;
+    this->deck_index.reset();
+    this->slice_begin = this->slice_end = 0;
+
+    for (std::size_t index = begin; index < end; index++)
+        this->add_keyword(kw_list[index]);
+}
+
 void Opm::DeckView::add_keyword(const Opm::DeckKeyword& kw) {
+    this->detach_slice();
     this->keyword_index[kw.name()].push_back(this->keywords.size());
     this->keywords.push_back(std::cref(kw));
 }
 
 bool Opm::DeckView::has_keyword(const std::string& kw) const {
+    if (this->deck_index != nullptr) {
+        auto [first, last] = this->slice_positions(kw);
+        return first != last;
+    }
+
     return this->keyword_index.find(kw) != this->keyword_index.end();
 }
 
 bool Opm::DeckView::empty() const {
-    return this->keywords.empty();
+    return this->size() == 0;
 }
 
 std::size_t Opm::DeckView::size() const {
+    if (this->deck_index != nullptr)
+        return this->slice_end - this->slice_begin;
+
     return this->keywords.size();
 }
 
 const Opm::DeckKeyword& Opm::DeckView::operator[](std::size_t kw_index) const {
-    return this->keywords.at(kw_index).get();
+    if (kw_index >= this->size())
+        throw std::out_of_range("DeckView index " + std::to_string(kw_index) + " out of range");
+
+    return this->get(kw_index);
 }
 
 Opm::DeckView Opm::DeckView::operator[](const std::string& kw_name) const {
     DeckView dw;
+    if (this->deck_index != nullptr) {
+        auto [first, last] = this->slice_positions(kw_name);
+        dw.keywords.reserve(last - first);
+        for (auto pos = first; pos != last; ++pos)
+            dw.add_keyword(this->deck_keywords[*pos]);
+
+        return dw;
+    }
+
     auto iter = this->keyword_index.find(kw_name);
     if (iter != this->keyword_index.end()) {
         for (const auto& kw_index : iter->second) {
@@ -58,17 +119,27 @@ const Opm::DeckKeyword& Opm::DeckView::front() const {
     if (this->empty())
         throw std::logic_error("Tried to get front() from empty DeckView");
 
-    return this->keywords.front().get();
+    return this->get(0);
 }
 
 const Opm::DeckKeyword& Opm::DeckView::back() const {
     if (this->empty())
         throw std::logic_error("Tried to get back() from empty DeckView");
 
-    return this->keywords.back().get();
+    return this->get(this->size() - 1);
 }
 
 std::vector<std::size_t> Opm::DeckView::index(const std::string& keyword) const {
+    if (this->deck_index != nullptr) {
+        auto [first, last] = this->slice_positions(keyword);
+        std::vector<std::size_t> kw_index;
+        kw_index.reserve(last - first);
+        for (auto pos = first; pos != last; ++pos)
+            kw_index.push_back(*pos - this->slice_begin);
+
+        return kw_index;
+    }
+
     auto iter = this->keyword_index.find(keyword);
     if (iter != this->keyword_index.end())
         return iter->second;
@@ -77,6 +148,11 @@ std::vector<std::size_t> Opm::DeckView::index(const std::string& keyword) const
 }
 
 std::size_t Opm::DeckView::count(const std::string& keyword) const {
+    if (this->deck_index != nullptr) {
+        auto [first, last] = this->slice_positions(keyword);
+        return last - first;
+    }
+
     auto iter = this->keyword_index.find(keyword);
     if (iter == this->keyword_index.end())
         return 0;
@@ -22,8 +22,12 @@
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <cstddef>
 #include <iterator>
+#include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Opm {
 
@@ -34,38 +38,40 @@ public:
 
 
     struct Iterator {
-        explicit Iterator(storage_type::const_iterator inner_iter) :
-            inner(inner_iter)
+        Iterator(const DeckView* deck_view, std::size_t position) :
+            view(deck_view),
+            pos(position)
         {}
 
-        using difference_type = storage_type::const_iterator::difference_type;
-        using iterator_category = storage_type::const_iterator::iterator_category;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
         using pointer = const DeckKeyword*;
         using reference = const DeckKeyword&;
         using value_type = DeckKeyword;
 
-        const DeckKeyword& operator*()  { return this->inner->get(); }
-        const DeckKeyword* operator->() { return &this->inner->get(); }
+        const DeckKeyword& operator*()  { return this->view->get(this->pos); }
+        const DeckKeyword* operator->() { return &this->view->get(this->pos); }
 
-        Iterator& operator++()    { ++this->inner; return *this; }
-        Iterator  operator++(int) { auto tmp = *this; ++this->inner; return tmp; }
+        Iterator& operator++()    { ++this->pos; return *this; }
+        Iterator  operator++(int) { auto tmp = *this; ++this->pos; return tmp; }
 
-        Iterator& operator--()    { --this->inner; return *this; }
-        Iterator  operator--(int) { auto tmp = *this; --this->inner; return tmp; }
+        Iterator& operator--()    { --this->pos; return *this; }
+        Iterator  operator--(int) { auto tmp = *this; --this->pos; return tmp; }
 
-        Iterator::difference_type operator-(const Iterator &other) { return this->inner - other.inner; }
-        Iterator operator+(Iterator::difference_type shift) { Iterator tmp = *this; tmp.inner += shift; return tmp;}
+        Iterator::difference_type operator-(const Iterator &other) { return static_cast<difference_type>(this->pos) - static_cast<difference_type>(other.pos); }
+        Iterator operator+(Iterator::difference_type shift) { Iterator tmp = *this; tmp.pos += shift; return tmp;}
 
-        friend bool operator== (const Iterator& a, const Iterator& b) { return a.inner == b.inner; };
-        friend bool operator<= (const Iterator& a, const Iterator& b) { return a.inner <= b.inner; };
-        friend bool operator!= (const Iterator& a, const Iterator& b) { return a.inner != b.inner; };
+        friend bool operator== (const Iterator& a, const Iterator& b) { return a.pos == b.pos; };
+        friend bool operator<= (const Iterator& a, const Iterator& b) { return a.pos <= b.pos; };
+        friend bool operator!= (const Iterator& a, const Iterator& b) { return a.pos != b.pos; };
 
     private:
-        storage_type::const_iterator inner;
+        const DeckView* view;
+        std::size_t pos;
     };
 
-    Iterator begin() const { return Iterator(this->keywords.begin()); }
-    Iterator end() const { return Iterator(this->keywords.end()); }
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, this->size()); }
 
     const DeckKeyword& operator[](std::size_t index) const;
     DeckView operator[](const std::string& keyword) const;
@@ -91,8 +97,36 @@ public:
     }
 
 private:
+    friend class Deck;
+    using index_type = std::unordered_map<std::string, std::vector<std::size_t>>;
+
+    // A view of the keywords [begin, end) of a deck.  The slice shares the
+    // keyword storage and the keyword index of the deck, i.e., it is created
+    // in constant time and keyword lookups only visit the matching keywords.
+    // Like an ordinary view it refers to the keywords themselves, so it
+    // stays valid when the deck is moved, but not when keywords are added
+    // to or removed from the deck.
+    DeckView(const std::vector<DeckKeyword>& deck_keywords,
+             std::shared_ptr<const index_type> deck_index,
+             std::size_t begin, std::size_t end);
+
+    const DeckKeyword& get(std::size_t kw_index) const {
+        if (this->deck_index != nullptr)
+            return this->deck_keywords[this->slice_begin + kw_index];
+
+        return this->keywords[kw_index].get();
+    }
+
+    std::pair<const std::size_t*, const std::size_t*> slice_positions(const std::string& keyword) const;
+    void detach_slice();
+
     storage_type keywords;
-    std::unordered_map<std::string, std::vector<std::size_t>> keyword_index;
+    index_type keyword_index;
+
+    const DeckKeyword* deck_keywords{nullptr};
+    std::shared_ptr<const index_type> deck_index{};
+    std::size_t slice_begin{0};
+    std::size_t slice_end{0};
 };
 
 }
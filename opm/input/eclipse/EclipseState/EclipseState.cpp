@@ -129,7 +129,7 @@ namespace Opm {
 // process is done twice, first after the initial field_props processing and
 // subsequently after the processing of numerical aquifers.
 
-    EclipseState::EclipseState(const Deck& deck)
+    EclipseState::EclipseState(const Deck& deck, const bool lazyFieldProps)
     try
         : m_tables(            deck )
         , m_runspec(           deck )
@@ -138,7 +138,7 @@ namespace Opm {
         , m_inputGrid(         deck, nullptr )
         , m_inputNnc(          m_inputGrid, deck)
         , m_gridDims(          deck )
-        , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
+        , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps(), lazyFieldProps)
         , m_simulationConfig(  m_eclipseConfig.init().restartRequested(), deck, field_props)
         , aquifer_config(      m_tables, m_inputGrid, deck, field_props)
         , compositional_config(deck, m_runspec)
@@ -70,7 +70,12 @@ namespace Opm {
         };
 
         EclipseState() = default;
-        explicit EclipseState(const Deck& deck);
+        /// With lazyFieldProps = true the arrays of the PROPS and SOLUTION
+        /// sections are only evaluated when first requested.  The deck
+        /// must then outlive the EclipseState, and keep its array data,
+        /// until fieldProps().apply_deferred_operations() has been called,
+        /// see FieldProps.
+        explicit EclipseState(const Deck& deck, bool lazyFieldProps = false);
         virtual ~EclipseState() = default;
 
         const IOConfig& getIOConfig() const;
@@ -90,6 +90,101 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
                    [scale_factor](const auto& v) { return v * scale_factor; });
 }
 
+// Straight line through the top and bottom points of a pillar.  The slopes
+// are computed once per pillar and shared by all corners on the pillar.
+struct Pillar
+{
+    double xt{};
+    double yt{};
+    double zt{};
+    double dxdz{};
+    double dydz{};
+    bool vertical{true};
+};
+
+Pillar makePillar(const std::vector<double>& coord, const std::size_t p)
+{
+    const double* c = &coord[6*p];
+
+    Pillar pillar;
+    pillar.xt = c[0];
+    pillar.yt = c[1];
+    pillar.zt = c[2];
+    pillar.vertical = (c[2] == c[5]);
+    if (! pillar.vertical) {
+        pillar.dxdz = (c[3] - c[0]) / (c[2] - c[5]);
+        pillar.dydz = (c[4] - c[1]) / (c[2] - c[5]);
+    }
+
+    return pillar;
+}
+
+std::vector<Pillar> makePillars(const std::vector<double>& coord,
+                                const std::size_t nx, const std::size_t ny)
+{
+    std::vector<Pillar> pillars((nx + 1)*(ny + 1));
+    for (std::size_t p = 0; p < pillars.size(); ++p)
+        pillars[p] = makePillar(coord, p);
+
+    return pillars;
+}
+
+// Same result as EclipseGrid::getCellCorners().  The pillars of the cell
+// are p0[0], p0[1], p1[0] and p1[1].
+void cellCorners(const Pillar* p0, const Pillar* p1,
+                 const std::vector<double>& zcorn,
+                 const std::size_t nx, const std::size_t ny,
+                 const std::size_t i, const std::size_t j, const std::size_t k,
+                 double* X, double* Y, double* Z)
+{
+    const std::size_t z_offset = k*nx*ny*8 + j*nx*4 + i*2;
+    const std::array<const Pillar*, 4> pillars {{ p0, p0 + 1, p1, p1 + 1 }};
+    const std::array<std::size_t, 4> zind {{ z_offset, z_offset + 1,
+                                             z_offset + nx*2, z_offset + nx*2 + 1 }};
+
+    for (int n = 0; n < 4; n++) {
+        Z[n] = zcorn[zind[n]];
+        Z[n + 4] = zcorn[zind[n] + nx*ny*4];
+    }
+
+    for (int n = 0; n < 4; n++) {
+        const auto& p = *pillars[n];
+        if (p.vertical) {
+            X[n] = X[n + 4] = p.xt;
+            Y[n] = Y[n + 4] = p.yt;
+        } else {
+            X[n] = p.xt + p.dxdz * (p.zt - Z[n]);
+            X[n + 4] = p.xt + p.dxdz * (p.zt - Z[n + 4]);
+
+            Y[n] = p.yt + p.dydz * (p.zt - Z[n]);
+            Y[n + 4] = p.yt + p.dydz * (p.zt - Z[n + 4]);
+        }
+    }
+}
+
+void resizeGeometry(EclipseGrid::CellGeometry& geometry, const std::size_t n)
+{
+    geometry.volume.resize(n);
+    geometry.center.resize(n);
+    geometry.depth.resize(n);
+    geometry.thickness.resize(n);
+}
+
+// Center, depth and thickness, with the same formulae as the single cell
+// functions of EclipseGrid.
+void setCellGeometry(const double* X, const double* Y, const double* Z,
+                     const std::size_t pos, EclipseGrid::CellGeometry& geometry)
+{
+    geometry.center[pos] = { std::accumulate(X, X + 8, 0.0) / 8.0,
+                             std::accumulate(Y, Y + 8, 0.0) / 8.0,
+                             std::accumulate(Z, Z + 8, 0.0) / 8.0 };
+
+    const double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    const double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    geometry.depth[pos] = (z1 + z2)/2.0;
+    geometry.thickness[pos] = z2 - z1;
+}
+
 }
 EclipseGrid::EclipseGrid()
     : GridDims(),
@@ -1543,13 +1638,20 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         if (!this->active_volume.has_value()) {
             std::vector<double> volume(this->m_nactive);
 
+            const auto nx = this->getNX();
+            const auto ny = this->getNY();
+            const auto pillars = makePillars(this->m_coord, nx, ny);
+
             #pragma omp parallel for schedule(static)
             for (std::size_t active_index = 0; active_index < this->m_active_to_global.size(); active_index++) {
                 std::array<double,8> X;
                 std::array<double,8> Y;
                 std::array<double,8> Z;
                 auto global_index = this->m_active_to_global[active_index];
-                this->getCellCorners(global_index, X, Y, Z );
+                const auto [ci, cj, ck] = this->getIJK(global_index);
+                cellCorners(&pillars[ci + cj*(nx + 1)], &pillars[ci + (cj + 1)*(nx + 1)],
+                            this->m_zcorn, nx, ny, ci, cj, ck,
+                            X.data(), Y.data(), Z.data());
                 if (m_rv && m_thetav) {
                     const auto[i,j,k] = this->getIJK(global_index);
                     const auto& r = *m_rv;
@@ -1826,6 +1928,102 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->getCellDepth(globalIndex);
     }
 
+    EclipseGrid::CellGeometry
+    EclipseGrid::getLayerGeometry(size_t k_begin, size_t k_end) const {
+        if ((k_begin > k_end) || (k_end > this->getNZ()))
+            throw std::invalid_argument("Invalid layer range");
+
+        const auto nx = this->getNX();
+        const auto ny = this->getNY();
+        const auto offset = k_begin*nx*ny;
+        const auto pillars = makePillars(this->m_coord, nx, ny);
+
+        CellGeometry geometry;
+        resizeGeometry(geometry, (k_end - k_begin)*nx*ny);
+
+        // Each task processes one row of cells.
+        const auto numRows = (k_end - k_begin)*ny;
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t row = 0; row < numRows; ++row) {
+            const auto j = row % ny;
+            const auto k = k_begin + row / ny;
+            const auto pos = row*nx;
+
+            std::vector<double> X(8*nx);
+            std::vector<double> Y(8*nx);
+            std::vector<double> Z(8*nx);
+            for (std::size_t i = 0; i < nx; ++i)
+                cellCorners(&pillars[i + j*(nx + 1)], &pillars[i + (j + 1)*(nx + 1)],
+                            this->m_zcorn, nx, ny, i, j, k,
+                            &X[8*i], &Y[8*i], &Z[8*i]);
+
+            if (m_rv && m_thetav) {
+                const auto& r = *m_rv;
+                const auto& t = *m_thetav;
+                for (std::size_t i = 0; i < nx; ++i)
+                    geometry.volume[pos + i] = calculateCylindricalCellVol(r[i], r[i+1], t[j],
+                                                                           Z[8*i + 4] - Z[8*i]);
+            } else
+                calculateCellVol(nx, X.data(), Y.data(), Z.data(), &geometry.volume[pos]);
+
+            for (std::size_t i = 0; i < nx; ++i)
+                setCellGeometry(&X[8*i], &Y[8*i], &Z[8*i], pos + i, geometry);
+        }
+
+        for (const auto& [globalIndex, depth] : this->m_aquifer_cell_depths) {
+            if ((globalIndex >= offset) && (globalIndex < offset + geometry.depth.size()))
+                geometry.depth[globalIndex - offset] = depth;
+        }
+
+        return geometry;
+    }
+
+    EclipseGrid::CellGeometry
+    EclipseGrid::getColumnGeometry(size_t i, size_t j) const {
+        if (i >= this->getNX() || j >= this->getNY())
+            throw std::invalid_argument("input IJ index above valid range");
+
+        const auto nx = this->getNX();
+        const auto ny = this->getNY();
+        const auto nz = this->getNZ();
+        const std::array<Pillar, 4> pillars {{
+            makePillar(this->m_coord, i + j*(nx + 1)),
+            makePillar(this->m_coord, i + 1 + j*(nx + 1)),
+            makePillar(this->m_coord, i + (j + 1)*(nx + 1)),
+            makePillar(this->m_coord, i + 1 + (j + 1)*(nx + 1)),
+        }};
+
+        CellGeometry geometry;
+        resizeGeometry(geometry, nz);
+
+        std::vector<double> X(8*nz);
+        std::vector<double> Y(8*nz);
+        std::vector<double> Z(8*nz);
+        for (std::size_t k = 0; k < nz; ++k)
+            cellCorners(&pillars[0], &pillars[2], this->m_zcorn, nx, ny, i, j, k,
+                        &X[8*k], &Y[8*k], &Z[8*k]);
+
+        if (m_rv && m_thetav) {
+            const auto& r = *m_rv;
+            const auto& t = *m_thetav;
+            for (std::size_t k = 0; k < nz; ++k)
+                geometry.volume[k] = calculateCylindricalCellVol(r[i], r[i+1], t[j],
+                                                                 Z[8*k + 4] - Z[8*k]);
+        } else
+            calculateCellVol(nz, X.data(), Y.data(), Z.data(), geometry.volume.data());
+
+        for (std::size_t k = 0; k < nz; ++k) {
+            setCellGeometry(&X[8*k], &Y[8*k], &Z[8*k], k, geometry);
+
+            auto it = this->m_aquifer_cell_depths.find(i + j*nx + k*nx*ny);
+            if (it != this->m_aquifer_cell_depths.end())
+                geometry.depth[k] = it->second;
+        }
+
+        return geometry;
+    }
+
     const std::map<size_t, std::array<int,2>>& EclipseGrid::getAquiferCellTabnums() const {
         return m_aquifer_cell_tabnums;
     }
@@ -195,6 +195,28 @@ namespace Opm {
 
         double getCellDepth(size_t i,size_t j, size_t k) const;
         double getCellDepth(size_t globalIndex) const;
+
+        /// Geometric properties of a range of cells.  Each vector has one
+        /// element per cell, and the values are the same as those returned
+        /// by getCellVolume(), getCellCenter(), getCellDepth() and
+        /// getCellThickness() for the individual cells.
+        struct CellGeometry
+        {
+            std::vector<double> volume{};
+            std::vector<std::array<double, 3>> center{};
+            std::vector<double> depth{};
+            std::vector<double> thickness{};
+        };
+
+        /// Geometry of all cells in layers k_begin, ..., k_end - 1, in order
+        /// of increasing global index.  Much faster than querying the cells
+        /// one by one, since the pillar geometry is only evaluated once for
+        /// all cells and the cells are processed by multiple threads.
+        CellGeometry getLayerGeometry(size_t k_begin, size_t k_end) const;
+
+        /// Geometry of all cells in pillar column (i,j), in order of
+        /// increasing k.
+        CellGeometry getColumnGeometry(size_t i, size_t j) const;
         ZcornMapper zcornMapper() const;
 
         const std::vector<double>& getCOORD() const;
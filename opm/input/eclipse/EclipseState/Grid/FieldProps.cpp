@@ -88,6 +88,35 @@ namespace {
         return (keyword == "PCW")  || (keyword == "PCG")
             || (keyword == "IPCG") || (keyword == "IPCW");
     }
+
+    // Arrays of the PROPS and SOLUTION sections whose operations may be
+    // deferred in lazy mode.
+    bool is_deferrable(const std::string& keyword)
+    {
+        namespace kw = Opm::Fieldprops::keywords;
+
+        return (kw::PROPS::double_keywords.count(keyword) == 1)
+            || (kw::PROPS::satfunc.count(keyword) == 1)
+            || (kw::SOLUTION::double_keywords.count(keyword) == 1)
+            || (kw::SOLUTION::composition_keywords.count(keyword) == 1);
+    }
+
+    // Region arrays which are read when the default values of a deferrable
+    // array are initialised.
+    std::vector<std::string> default_value_sources(const std::string& keyword)
+    {
+        if (keyword == Opm::ParserKeywords::TEMPI::keywordName) {
+            return { "EQLNUM" };
+        }
+
+        if ((Opm::Fieldprops::keywords::PROPS::satfunc.count(keyword) == 1) ||
+            is_capillary_pressure(keyword))
+        {
+            return { "ENDNUM", "IMBNUM", "SATNUM" };
+        }
+
+        return {};
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -307,7 +336,7 @@ void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
                  const DeckKeyword& keyword,
                  Fieldprops::FieldData<T>& field_data,
                  const std::vector<T>& deck_data,
-                 const std::vector<value::status>& deck_status,
+                 const DeckItem& deck_item,
                  const Box& box)
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
@@ -317,12 +346,13 @@ void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         auto data_index = cell_index.data_index;
         for (size_t i = 0; i < kw_info.num_value; ++i) {
             auto deck_data_index = i* box.size() + data_index;
-            if (value::has_value(deck_status[deck_data_index])) {
+            const auto deck_status = deck_item.getValueStatus(deck_data_index);
+            if (value::has_value(deck_status)) {
                 auto data_active_index = i * box.size() + active_index;
-                if (deck_status[deck_data_index] == value::status::deck_value ||
+                if (deck_status == value::status::deck_value ||
                     field_data.value_status[data_active_index] == value::status::uninitialized) {
                     field_data.data[data_active_index] = deck_data[deck_data_index];
-                    field_data.value_status[data_active_index] = deck_status[deck_data_index];
+                    field_data.value_status[data_active_index] = deck_status;
                 }
             }
         }
@@ -334,11 +364,12 @@ void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         const auto& index_list = box.global_index_list();
 
         for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
+            const auto deck_status = deck_item.getValueStatus(cell.data_index);
+            if ((deck_status == value::status::deck_value) ||
                 (global_status[cell.global_index] == value::status::uninitialized))
             {
                 global_data[cell.global_index] = deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+                global_status[cell.global_index] = deck_status;
             }
         }
     }
@@ -349,7 +380,7 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
                    const DeckKeyword& keyword,
                    Fieldprops::FieldData<T>& field_data,
                    const std::vector<T>& deck_data,
-                   const std::vector<value::status>& deck_status,
+                   const DeckItem& deck_item,
                    const Box& box)
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
@@ -357,11 +388,12 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         auto active_index = cell_index.active_index;
         auto data_index = cell_index.data_index;
 
-        if (value::has_value(deck_status[data_index]) &&
+        const auto deck_status = deck_item.getValueStatus(data_index);
+        if (value::has_value(deck_status) &&
             value::has_value(field_data.value_status[active_index]))
         {
             field_data.data[active_index] *= deck_data[data_index];
-            field_data.value_status[active_index] = deck_status[data_index];
+            field_data.value_status[active_index] = deck_status;
         }
     }
 
@@ -371,11 +403,12 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         const auto& index_list = box.global_index_list();
 
         for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
+            const auto deck_status = deck_item.getValueStatus(cell.data_index);
+            if ((deck_status == value::status::deck_value) ||
                 (global_status[cell.global_index] == value::status::uninitialized))
             {
                 global_data[cell.global_index] *= deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+                global_status[cell.global_index] = deck_status;
             }
         }
     }
@@ -734,7 +767,8 @@ FieldProps::FieldProps(const Deck& deck,
                        const Phases& phases,
                        EclipseGrid& grid,
                        const TableManager& tables_arg,
-                       const std::size_t ncomps)
+                       const std::size_t ncomps,
+                       const bool lazy)
     : active_size(grid.getNumActive())
     , global_size(grid.getCartesianSize())
     , unit_system(deck.getActiveUnitSystem())
@@ -749,6 +783,7 @@ FieldProps::FieldProps(const Deck& deck,
     , m_default_region(default_region_keyword(deck))
     , grid_ptr(&grid)
     , tables(tables_arg)
+    , m_lazy(lazy)
 {
     this->tran.emplace("TRANX", "TRANX");
     this->tran.emplace("TRANY", "TRANY");
@@ -847,6 +882,9 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum)
         return;
     }
 
+    // Deferred operations refer to the current active cells.
+    this->apply_deferred_operations();
+
     std::vector<bool> active_map(this->active_size, true);
     std::size_t active_index = 0;
     std::size_t new_active_size = 0;
@@ -991,6 +1029,10 @@ FieldProps::init_get(const std::string& keyword_name,
     const auto keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
     const auto mult_keyword = std::string(multiplier_in_edit ? getMultiplierPrefix() : "") + keyword;
 
+    if (! this->deferred_ops.empty()) {
+        this->apply_deferred_operations(keyword);
+    }
+
     auto iter = this->double_data.find(mult_keyword);
     if (iter != this->double_data.end()) {
         return iter->second;
@@ -1040,6 +1082,10 @@ FieldProps::init_get(const std::string&                             keyword,
                      const Fieldprops::keywords::keyword_info<int>& kw_info,
                      const bool)
 {
+    if (! this->deferred_ops.empty()) {
+        this->apply_deferred_operations(keyword);
+    }
+
     auto iter = this->int_data.find(keyword);
     if (iter != this->int_data.end()) {
         return iter->second;
@@ -1102,7 +1148,8 @@ bool FieldProps::has<double>(const std::string& keyword_name) const
 {
     const auto keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
 
-    return this->double_data.find(keyword) != this->double_data.end();
+    return (this->double_data.find(keyword) != this->double_data.end())
+        || (this->deferred_targets.find(keyword) != this->deferred_targets.end());
 }
 
 template <>
@@ -1186,6 +1233,8 @@ void FieldProps::apply_multipliers()
 template <>
 std::vector<std::string> FieldProps::keys<double>() const
 {
+    this->apply_deferred_operations();
+
     std::vector<std::string> klist;
 
     for (const auto& [key, field] : this->double_data) {
@@ -1287,9 +1336,9 @@ void FieldProps::handle_int_keyword(const Fieldprops::keywords::keyword_info<int
     auto& field_data = this->init_get<int>(keyword.name());
 
     const auto& deck_data = keyword.getIntData();
-    const auto& deck_status = keyword.getValueStatus();
+    const auto& deck_item = keyword.getDataRecord().getDataItem();
 
-    assign_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
+    assign_deck(kw_info, keyword, field_data, deck_data, deck_item, box);
 }
 
 void FieldProps::handle_double_keyword(const Section section,
@@ -1305,15 +1354,15 @@ void FieldProps::handle_double_keyword(const Section section,
         (keyword_name, kw_info, (section == Section::EDIT) && kw_info.multiplier);
 
     const auto& deck_data = keyword.getSIDoubleData();
-    const auto& deck_status = keyword.getValueStatus();
+    const auto& deck_item = keyword.getDataRecord().getDataItem();
 
     if ((section == Section::SCHEDULE) && kw_info.multiplier) {
         // Apply all multipliers cumulatively
-        multiply_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
+        multiply_deck(kw_info, keyword, field_data, deck_data, deck_item, box);
     }
     else {
         // Apply only latest multiplier (overwrite these previous one)
-        assign_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
+        assign_deck(kw_info, keyword, field_data, deck_data, deck_item, box);
     }
 
     if (section == Section::GRID) {
@@ -2129,14 +2178,18 @@ void FieldProps::scanPROPSSection(const PROPSSection& props_section)
         const std::string& name = keyword.name();
         if (Fieldprops::keywords::PROPS::satfunc.count(name) == 1) {
             Fieldprops::keywords::keyword_info<double> sat_info{};
-            this->handle_double_keyword(Section::PROPS, sat_info, keyword, box);
+            if (! this->defer_double_keyword(Section::PROPS, sat_info, keyword)) {
+                this->handle_double_keyword(Section::PROPS, sat_info, keyword, box);
+            }
             continue;
         }
 
         if (auto kwPos = Fieldprops::keywords::PROPS::double_keywords.find(name);
             kwPos != Fieldprops::keywords::PROPS::double_keywords.end())
         {
-            this->handle_double_keyword(Section::PROPS, kwPos->second, keyword, box);
+            if (! this->defer_double_keyword(Section::PROPS, kwPos->second, keyword)) {
+                this->handle_double_keyword(Section::PROPS, kwPos->second, keyword, box);
+            }
             continue;
         }
 
@@ -2147,7 +2200,7 @@ void FieldProps::scanPROPSSection(const PROPSSection& props_section)
             continue;
         }
 
-        this->handle_keyword(Section::PROPS, keyword, box);
+        this->handle_deferrable_keyword(Section::PROPS, keyword, box);
     }
 }
 
@@ -2187,7 +2240,9 @@ void FieldProps::scanSOLUTIONSection(const SOLUTIONSection& solution_section,
         if (auto kwPos = Fieldprops::keywords::SOLUTION::double_keywords.find(name);
             kwPos != Fieldprops::keywords::SOLUTION::double_keywords.end())
         {
-            this->handle_double_keyword(Section::SOLUTION, kwPos->second, keyword, box);
+            if (! this->defer_double_keyword(Section::SOLUTION, kwPos->second, keyword)) {
+                this->handle_double_keyword(Section::SOLUTION, kwPos->second, keyword, box);
+            }
             continue;
         }
 
@@ -2203,11 +2258,209 @@ void FieldProps::scanSOLUTIONSection(const SOLUTIONSection& solution_section,
 
             // TODO: maybe we should go to the function handle_keyword for more flexibility
             const auto& kw_info = kwPos->second.num_value_per_cell(ncomps);
-            this->handle_double_keyword(Section::SOLUTION, kw_info, keyword, box);
+            if (! this->defer_double_keyword(Section::SOLUTION, kw_info, keyword)) {
+                this->handle_double_keyword(Section::SOLUTION, kw_info, keyword, box);
+            }
             continue;
         }
 
-        this->handle_keyword(Section::SOLUTION, keyword, box);
+        this->handle_deferrable_keyword(Section::SOLUTION, keyword, box);
+    }
+}
+
+bool FieldProps::defer_double_keyword(const Section section,
+                                      const Fieldprops::keywords::keyword_info<double>& kw_info,
+                                      const DeckKeyword& keyword)
+{
+    if (! this->m_lazy) {
+        return false;
+    }
+
+    const auto target = Fieldprops::keywords::get_keyword_from_alias(keyword.name());
+
+    this->deferred_ops.push_back({ section, &keyword, std::nullopt, kw_info, target, default_value_sources(target) });
+    this->deferred_targets.insert(target);
+
+    return true;
+}
+
+void FieldProps::handle_deferrable_keyword(const Section      section,
+                                           const DeckKeyword& keyword,
+                                           Box&               box)
+{
+    const auto& name = keyword.name();
+
+    if (! this->m_lazy) {
+        this->handle_keyword(section, keyword, box);
+        return;
+    }
+
+    if (Fieldprops::keywords::box_keywords.count(name) == 1) {
+        // The box is needed both here, for operations which are applied
+        // immediately, and when replaying the deferred operations.
+        handle_box_keyword(keyword, box);
+        this->deferred_ops.push_back({ section, &keyword });
+        return;
+    }
+
+    auto arrayName = [](const DeckItem& item)
+    {
+        return Fieldprops::keywords::get_keyword_from_alias(item.getTrimmedString(0));
+    };
+
+    // Split the keyword into one operation per record, recording the
+    // target array and the arrays read by each of them.
+    auto operations = std::vector<DeferredOperation>{};
+    for (std::size_t record_index = 0; record_index < keyword.size(); ++record_index) {
+        const auto& record = keyword.getRecord(record_index);
+        auto op = DeferredOperation { section, &keyword, record_index };
+
+        if ((name == ParserKeywords::COPY::keywordName) ||
+            (name == ParserKeywords::COPYREG::keywordName))
+        {
+            op.target = arrayName(record.getItem(1));
+            op.sources.push_back(arrayName(record.getItem(0)));
+
+            if (name == ParserKeywords::COPYREG::keywordName) {
+                op.sources.push_back(this->region_name
+                                     (record.getItem<ParserKeywords::COPYREG::REGION_NAME>()));
+            }
+        }
+        else if (name == ParserKeywords::OPERATE::keywordName) {
+            op.target = arrayName(record.getItem(0));
+            op.sources.push_back(record.getItem("ARRAY").getTrimmedString(0));
+        }
+        else if (name == ParserKeywords::OPERATER::keywordName) {
+            op.target = arrayName(record.getItem(0));
+            op.sources.push_back(record.getItem("ARRAY_PARAMETER").getTrimmedString(0));
+            op.sources.push_back(record.getItem("REGION_NAME").getTrimmedString(0));
+        }
+        else if (Fieldprops::keywords::region_oper_keywords.count(name) == 1) {
+            op.target = arrayName(record.getItem(0));
+            op.sources.push_back(this->region_name(record.getItem("REGION_NAME")));
+        }
+        else if (Fieldprops::keywords::oper_keywords.count(name) == 1) {
+            op.target = arrayName(record.getItem(0));
+        }
+
+        if (! is_deferrable(op.target)) {
+            // Keywords which touch any other array are applied immediately.
+            // Deferred operations that are connected to those arrays are
+            // applied first through init_get().
+            this->handle_keyword(section, keyword, box);
+            return;
+        }
+
+        const auto defaults = default_value_sources(op.target);
+        op.sources.insert(op.sources.end(), defaults.begin(), defaults.end());
+
+        operations.push_back(std::move(op));
+    }
+
+    for (auto& op : operations) {
+        this->deferred_targets.insert(op.target);
+        this->deferred_ops.push_back(std::move(op));
+    }
+}
+
+void FieldProps::apply_deferred_operations() const
+{
+    if (! this->deferred_ops.empty()) {
+        // Replaying only fills in arrays that would otherwise be evaluated
+        // on first request, i.e., it does not change the logical state.
+        const_cast<FieldProps*>(this)->replay_deferred_operations
+            (std::vector<bool>(this->deferred_ops.size(), true));
+    }
+}
+
+void FieldProps::apply_deferred_operations(const std::string& keyword)
+{
+    // Select the operations on all arrays which are connected to 'keyword'
+    // through the arrays read by deferred operations.  Replaying these in
+    // deck order gives every operation the same input as when processing
+    // the deck eagerly.
+    auto arrays = std::unordered_set<std::string> { keyword };
+    auto selected = std::vector<bool>(this->deferred_ops.size(), false);
+    auto any_selected = false;
+
+    for (auto grown = true; grown; ) {
+        grown = false;
+
+        for (std::size_t i = 0; i < this->deferred_ops.size(); ++i) {
+            const auto& op = this->deferred_ops[i];
+            if (selected[i] || op.target.empty()) {
+                continue;
+            }
+
+            const auto connected = (arrays.count(op.target) == 1)
+                || std::any_of(op.sources.begin(), op.sources.end(),
+                               [&arrays](const std::string& source)
+                               { return arrays.count(source) == 1; });
+
+            if (connected) {
+                arrays.insert(op.target);
+                arrays.insert(op.sources.begin(), op.sources.end());
+
+                selected[i] = true;
+                grown = any_selected = true;
+            }
+        }
+    }
+
+    if (any_selected) {
+        this->replay_deferred_operations(selected);
+    }
+}
+
+void FieldProps::replay_deferred_operations(const std::vector<bool>& selected)
+{
+    // Detach the pending operations while replaying, such that lookups
+    // from the keyword handlers see the arrays as they would when
+    // processing the deck eagerly.
+    auto ops = std::move(this->deferred_ops);
+    this->deferred_ops.clear();
+    this->deferred_targets.clear();
+
+    auto remaining = std::vector<DeferredOperation>{};
+    auto has_remaining = false;
+
+    auto box = makeGlobalGridBox(this->grid_ptr);
+    auto section = ops.front().section;
+
+    for (std::size_t i = 0; i < ops.size(); ++i) {
+        auto& op = ops[i];
+
+        if (op.section != section) {
+            box.reset();
+            section = op.section;
+        }
+
+        if (op.target.empty()) {
+            handle_box_keyword(*op.keyword, box);
+            remaining.push_back(std::move(op));
+        }
+        else if (! selected[i]) {
+            remaining.push_back(std::move(op));
+            has_remaining = true;
+        }
+        else if (op.kw_info.has_value()) {
+            this->handle_double_keyword(op.section, *op.kw_info, *op.keyword, box);
+        }
+        else {
+            // Operation keywords are applied one record at a time.
+            auto keyword = DeckKeyword { op.keyword->location(), op.keyword->name() };
+            keyword.addRecord(DeckRecord { op.keyword->getRecord(*op.record) });
+            this->handle_keyword(op.section, keyword, box);
+        }
+    }
+
+    if (has_remaining) {
+        this->deferred_ops = std::move(remaining);
+        for (const auto& op : this->deferred_ops) {
+            if (! op.target.empty()) {
+                this->deferred_targets.insert(op.target);
+            }
+        }
     }
 }
 
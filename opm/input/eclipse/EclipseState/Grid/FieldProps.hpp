@@ -522,8 +522,18 @@ public:
     };
 
     /// Normal constructor for FieldProps.
+    ///
+    /// If \p lazy is true, operations on the arrays of the PROPS and
+    /// SOLUTION sections are only recorded during construction.  Each such
+    /// array is then evaluated when it is first requested, together with
+    /// the arrays it depends on through COPY, OPERATE and similar
+    /// operations.  Input errors in these operations are consequently not
+    /// reported until the affected array is requested.  The recorded
+    /// operations refer to the keywords of \p deck, which must therefore
+    /// outlive this object unless apply_deferred_operations() is called
+    /// first.
     FieldProps(const Deck& deck, const Phases& phases, EclipseGrid& grid, const TableManager& table_arg,
-               const std::size_t ncomps);
+               const std::size_t ncomps, const bool lazy = false);
 
     /// Special case constructor used to process ACTNUM only.
     FieldProps(const Deck& deck, const EclipseGrid& grid);
@@ -534,6 +544,12 @@ public:
 
     void apply_numerical_aquifers(const NumericalAquifers& numerical_aquifers);
 
+    /// Evaluate all arrays with operations recorded in lazy mode.
+    ///
+    /// This only fills in arrays which would otherwise be evaluated on
+    /// first request, so it is available on const objects too.
+    void apply_deferred_operations() const;
+
     const std::string& default_region() const;
 
     std::vector<int> actnum();
@@ -708,6 +724,29 @@ public:
     void deleteMINPVV();
 
 private:
+    /// Operation on a PROPS or SOLUTION section array which has been
+    /// recorded in lazy mode, but not yet applied.
+    struct DeferredOperation
+    {
+        Section section;
+
+        /// Data keyword, operation keyword, or BOX/ENDBOX in the deck.
+        const DeckKeyword* keyword{nullptr};
+
+        /// Index of the record of an operation keyword which makes up
+        /// this operation.  Unset for data keywords and BOX/ENDBOX.
+        std::optional<std::size_t> record{};
+
+        /// Property description if keyword is a data keyword.
+        std::optional<Fieldprops::keywords::keyword_info<double>> kw_info{};
+
+        /// Array modified by the operation.  Empty for BOX/ENDBOX.
+        std::string target{};
+
+        /// Other arrays which are read by the operation.
+        std::vector<std::string> sources{};
+    };
+
     void processMULTREGP(const Deck& deck);
     void scanGRIDSection(const GRIDSection& grid_section);
     void scanGRIDSectionOnlyACTNUM(const GRIDSection& grid_section);
@@ -790,6 +829,13 @@ private:
                             const DeckKeyword& keyword,
                             const Box& box);
 
+    bool defer_double_keyword(Section section,
+                              const Fieldprops::keywords::keyword_info<double>& kw_info,
+                              const DeckKeyword& keyword);
+    void handle_deferrable_keyword(Section section, const DeckKeyword& keyword, Box& box);
+    void apply_deferred_operations(const std::string& keyword);
+    void replay_deferred_operations(const std::vector<bool>& selected);
+
     void init_satfunc(const std::string& keyword, Fieldprops::FieldData<double>& satfunc);
     void init_porv(Fieldprops::FieldData<double>& porv);
     void init_tempi(Fieldprops::FieldData<double>& tempi);
@@ -834,6 +880,15 @@ private:
     /// This list is used in apply_multipliers, where the multipliers will actually
     /// be applied.
     std::unordered_map<std::string,Fieldprops::keywords::keyword_info<double>> multiplier_kw_infos_;
+
+    /// Whether or not to defer operations on PROPS and SOLUTION arrays.
+    bool m_lazy{false};
+
+    /// Operations recorded in lazy mode, in deck order.
+    std::vector<DeferredOperation> deferred_ops{};
+
+    /// Arrays modified by at least one of the deferred operations.
+    std::unordered_set<std::string> deferred_targets{};
 };
 
 }
@@ -28,16 +28,21 @@
 namespace Opm {
 
 bool FieldPropsManager::operator==(const FieldPropsManager& other) const {
+    this->fp->apply_deferred_operations();
+    other.fp->apply_deferred_operations();
     return *this->fp == *other.fp;
 }
 
 bool FieldPropsManager::rst_cmp(const FieldPropsManager& full_arg, const FieldPropsManager& rst_arg) {
+    full_arg.fp->apply_deferred_operations();
+    rst_arg.fp->apply_deferred_operations();
     return FieldProps::rst_cmp(*full_arg.fp, *rst_arg.fp);
 }
 
 FieldPropsManager::FieldPropsManager(const Deck& deck, const Phases& phases, EclipseGrid& grid_arg,
-                                     const TableManager& tables, const std::size_t ncomps) :
-    fp(std::make_shared<FieldProps>(deck, phases, grid_arg, tables, ncomps))
+                                     const TableManager& tables, const std::size_t ncomps,
+                                     const bool lazy) :
+    fp(std::make_shared<FieldProps>(deck, phases, grid_arg, tables, ncomps, lazy))
 {}
 
 void FieldPropsManager::deleteMINPVV() {
@@ -57,6 +62,10 @@ void FieldPropsManager::apply_schedule_keywords(const std::vector<DeckKeyword>&
     this->fp->handle_schedule_keywords(keywords);
 }
 
+void FieldPropsManager::apply_deferred_operations() const {
+    this->fp->apply_deferred_operations();
+}
+
 
 template <typename T>
 const std::vector<T>& FieldPropsManager::get(const std::string& keyword) const {
@@ -46,8 +46,13 @@ public:
     // The default constructor should be removed when the FieldPropsManager is mandatory
     // The default constructed fieldProps object is **NOT** usable
     FieldPropsManager() = default;
+    //
+    // With lazy = true the PROPS and SOLUTION section arrays are only
+    // evaluated when first requested, see FieldProps.  The deck must then
+    // outlive the FieldPropsManager.
     FieldPropsManager(const Deck& deck, const Phases& ph, EclipseGrid& grid, const TableManager& tables,
-                      const std::size_t ncomps = 0); // TODO: removing the default value for ncomps
+                      const std::size_t ncomps = 0, // TODO: removing the default value for ncomps
+                      const bool lazy = false);
     virtual ~FieldPropsManager() = default;
 
     virtual void reset_actnum(const std::vector<int>& actnum);
@@ -59,6 +64,11 @@ public:
 
     void apply_schedule_keywords(const std::vector<DeckKeyword>& keywords);
 
+    // Evaluate all arrays which are still pending in lazy mode.  The deck
+    // is not referenced afterwards, so e.g. Deck::releaseArrayData() may be
+    // called.
+    void apply_deferred_operations() const;
+
     /// \brief Whether we can call methods on the manager
     bool is_usable() const;
 
@@ -35,6 +35,7 @@
 #include <cmath>
 #include <cstddef>
 #include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -78,6 +79,100 @@ bool is_adjacent(const Opm::GridDims& gridDims,
         || is_adjacent(ijk1, ijk2, {2, 0, 1}); // (I,J,K) <-> (I,J,K+1)
 }
 
+// Region pair lookup for a single region set, stored as dense tables
+// indexed by region ID instead of the search maps of the scanner.
+class DenseRegionLookup
+{
+public:
+    template <class SearchMaps>
+    static std::optional<DenseRegionLookup>
+    create(const std::vector<int>& region_data, const SearchMaps& regMaps)
+    {
+        // Limits the size of the pair table to 32 MiB.
+        constexpr std::size_t maxPairs = std::size_t{1} << 23;
+
+        if (region_data.empty())
+            return std::nullopt;
+
+        const auto [minPos, maxPos] = std::minmax_element(region_data.begin(), region_data.end());
+        if (*minPos < 0)
+            return std::nullopt;
+
+        const auto numRegions = static_cast<std::size_t>(*maxPos) + 1;
+        if (numRegions * numRegions > maxPairs)
+            return std::nullopt;
+
+        auto lookup = DenseRegionLookup{};
+        lookup.region_data_ = &region_data;
+        lookup.numRegions_ = numRegions;
+        lookup.different_.assign(numRegions * numRegions, -1);
+        lookup.same_.assign(numRegions, -1);
+
+        // Pairs referring to regions which do not occur in the region set
+        // never match a connection.
+        const auto inRange = [numRegions](const int region)
+        {
+            return (region >= 0) && (static_cast<std::size_t>(region) < numRegions);
+        };
+
+        for (const auto& [regPair, recordIx] : std::get<0>(regMaps)) {
+            if (inRange(regPair.first) && inRange(regPair.second))
+                lookup.different_[regPair.first*numRegions + regPair.second] = static_cast<int>(recordIx);
+        }
+
+        for (const auto& [regPair, recordIx] : std::get<1>(regMaps)) {
+            if (inRange(regPair.first))
+                lookup.same_[regPair.first] = static_cast<int>(recordIx);
+        }
+
+        return lookup;
+    }
+
+    // Ordered region IDs of the cells of a connection.
+    std::pair<int, int> regions(const std::size_t globalCellIdx1,
+                                const std::size_t globalCellIdx2) const
+    {
+        const auto regionId1 = (*this->region_data_)[globalCellIdx1];
+        const auto regionId2 = (*this->region_data_)[globalCellIdx2];
+
+        return std::minmax(regionId1, regionId2);
+    }
+
+    int differentRecord(const int regionId1, const int regionId2) const
+    {
+        return this->different_[regionId1*this->numRegions_ + regionId2];
+    }
+
+    int sameRecord(const int regionId) const
+    {
+        return this->same_[regionId];
+    }
+
+private:
+    const std::vector<int>* region_data_{nullptr};
+    std::size_t numRegions_{0};
+    std::vector<int> different_{};
+    std::vector<int> same_{};
+};
+
+template <class SearchMap, class RegionMap>
+std::optional<std::vector<DenseRegionLookup>>
+makeDenseLookups(const SearchMap& searchMap, const RegionMap& regions)
+{
+    auto lookups = std::vector<DenseRegionLookup>{};
+    lookups.reserve(searchMap.size());
+
+    for (const auto& [regName, regMaps] : searchMap) {
+        auto lookup = DenseRegionLookup::create(regions.at(regName), regMaps);
+        if (!lookup.has_value())
+            return std::nullopt;
+
+        lookups.push_back(std::move(*lookup));
+    }
+
+    return lookups;
+}
+
 } // Anonymous namespace
 
 namespace Opm {
@@ -413,6 +508,143 @@ namespace Opm {
         return multiplier;
     }
 
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<std::pair<std::size_t, std::size_t>>& connections,
+                                          const std::vector<FaceDir::DirEnum>& faceDirs) const
+    {
+        if (faceDirs.size() != connections.size()) {
+            throw std::invalid_argument {
+                "Number of face directions does not match number of connections"
+            };
+        }
+
+        auto multipliers = std::vector<double>(connections.size(), 1.0);
+        if (this->m_searchMap.empty()) {
+            return multipliers;
+        }
+
+        const auto lookups = makeDenseLookups(this->m_searchMap, this->regions);
+        if (!lookups.has_value()) {
+            // Region IDs not suitable for dense tables.
+            #pragma omp parallel for schedule(static)
+            for (std::size_t connIx = 0; connIx < connections.size(); ++connIx) {
+                const auto& [cell1, cell2] = connections[connIx];
+                multipliers[connIx] = this->getRegionMultiplier(cell1, cell2, faceDirs[connIx]);
+            }
+
+            return multipliers;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t connIx = 0; connIx < connections.size(); ++connIx) {
+            const auto& [cell1, cell2] = connections[connIx];
+            const auto faceDir = faceDirs[connIx];
+
+            const auto is_adj = is_adjacent(this->gridDims, cell1, cell2);
+            const auto is_aqu = this->isAquNNC(cell1, cell2);
+
+            // Same conditions as in getRegionMultiplier().
+            const auto applyMultiplier = [is_adj, is_aqu, faceDir](const MULTREGTRecord& record)
+            {
+                if ((record.directions & faceDir) == 0) {
+                    return false;
+                }
+
+                const auto nnc_behaviour = record.nnc_behaviour;
+                return (nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL)
+                    || !(((is_adj && !is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
+                         || ((!is_adj || is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC))
+                         || (is_aqu              && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC)));
+            };
+
+            auto multiplier = 1.0;
+            for (const auto& lookup : *lookups) {
+                const auto [regionId1, regionId2] = lookup.regions(cell1, cell2);
+
+                const auto different = lookup.differentRecord(regionId1, regionId2);
+                if ((different >= 0) && applyMultiplier(this->m_records[different])) {
+                    multiplier *= this->m_records[different].trans_mult;
+                }
+
+                const auto same1 = lookup.sameRecord(regionId1);
+                if ((same1 >= 0) && applyMultiplier(this->m_records_same[same1])) {
+                    multiplier *= this->m_records_same[same1].trans_mult;
+                }
+
+                if (regionId1 != regionId2) {
+                    const auto same2 = lookup.sameRecord(regionId2);
+                    if ((same2 >= 0) && applyMultiplier(this->m_records_same[same2])) {
+                        multiplier *= this->m_records_same[same2].trans_mult;
+                    }
+                }
+            }
+
+            multipliers[connIx] = multiplier;
+        }
+
+        return multipliers;
+    }
+
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& connections) const
+    {
+        auto multipliers = std::vector<double>(connections.size(), 1.0);
+        if (this->m_searchMap.empty()) {
+            return multipliers;
+        }
+
+        const auto lookups = makeDenseLookups(this->m_searchMap, this->regions);
+        if (!lookups.has_value()) {
+            // Region IDs not suitable for dense tables.
+            #pragma omp parallel for schedule(static)
+            for (std::size_t connIx = 0; connIx < connections.size(); ++connIx) {
+                const auto& [cell1, cell2] = connections[connIx];
+                multipliers[connIx] = this->getRegionMultiplierNNC(cell1, cell2);
+            }
+
+            return multipliers;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t connIx = 0; connIx < connections.size(); ++connIx) {
+            const auto& [cell1, cell2] = connections[connIx];
+            const auto is_aqu = this->isAquNNC(cell1, cell2);
+
+            // Same conditions as in getRegionMultiplierNNC().
+            const auto applyMultiplier = [is_aqu](const MULTREGTRecord& record)
+            {
+                return !((record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC)
+                         || (is_aqu && (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC)));
+            };
+
+            auto multiplier = 1.0;
+            for (const auto& lookup : *lookups) {
+                const auto [regionId1, regionId2] = lookup.regions(cell1, cell2);
+
+                const auto same1 = lookup.sameRecord(regionId1);
+                if ((same1 >= 0) && applyMultiplier(this->m_records_same[same1])) {
+                    multiplier *= this->m_records_same[same1].trans_mult;
+                }
+
+                if (regionId1 != regionId2) {
+                    const auto same2 = lookup.sameRecord(regionId2);
+                    if ((same2 >= 0) && applyMultiplier(this->m_records_same[same2])) {
+                        multiplier *= this->m_records_same[same2].trans_mult;
+                    }
+                }
+
+                const auto different = lookup.differentRecord(regionId1, regionId2);
+                if ((different >= 0) && applyMultiplier(this->m_records[different])) {
+                    multiplier *= this->m_records[different].trans_mult;
+                }
+            }
+
+            multipliers[connIx] = multiplier;
+        }
+
+        return multipliers;
+    }
+
     template<typename ApplyDecision, typename RegPairFound>
     double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
                                                            double multiplier,
@@ -109,6 +109,26 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// \brief Region multipliers for a sequence of connections.
+        ///
+        /// Equivalent to calling getRegionMultiplier() for each connection,
+        /// but the region pairs are looked up in dense tables and the
+        /// connections are processed in parallel.
+        ///
+        /// \param connections Global cell indices of the connected cells.
+        /// \param faceDirs Face direction of each connection.
+        /// \return Multiplier of each connection.
+        std::vector<double>
+        getRegionMultipliers(const std::vector<std::pair<std::size_t, std::size_t>>& connections,
+                             const std::vector<FaceDir::DirEnum>& faceDirs) const;
+
+        /// \brief Region multipliers for a sequence of NNCs.
+        ///
+        /// Equivalent to calling getRegionMultiplierNNC() for each
+        /// connection.
+        std::vector<double>
+        getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& connections) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
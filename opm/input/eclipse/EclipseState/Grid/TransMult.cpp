@@ -121,6 +121,15 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    std::vector<double> TransMult::getRegionMultipliers(const std::vector<std::pair<std::size_t, std::size_t>>& connections,
+                                                        const std::vector<FaceDir::DirEnum>& faceDirs) const {
+        return m_multregtScanner.getRegionMultipliers(connections, faceDirs);
+    }
+
+    std::vector<double> TransMult::getRegionMultipliersNNC(const std::vector<std::pair<std::size_t, std::size_t>>& connections) const {
+        return m_multregtScanner.getRegionMultipliersNNC(connections);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -27,8 +27,15 @@
 #include <opm/json/JsonObject.hpp>
 #include <opm/input/eclipse/Generator/KeywordGenerator.hpp>
 #include <opm/input/eclipse/Generator/KeywordLoader.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywords.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -40,6 +47,73 @@ const std::string sourceHeader = R"(
 
 
 )";
+
+// Builds a minimal perfect hash function for the deck names, in the form
+// used by BuiltinKeywords::find().  The names are distributed over buckets,
+// and for each bucket, starting with the largest ones, a seed is searched
+// which maps all names in the bucket to free slots.  Returns the deck names
+// in slot order, and the seed of each bucket.
+std::pair<std::vector<std::string>, std::vector<std::uint32_t>>
+perfectHash(const std::map<std::string, std::size_t>& deckNames)
+{
+    using Opm::ParserKeywords::BuiltinKeywords;
+
+    const auto numSlots = deckNames.size();
+    const auto numBuckets = numSlots / 2 + 1;
+
+    std::vector<std::vector<std::string>> buckets(numBuckets);
+    for (const auto& [name, keyword] : deckNames)
+        buckets[BuiltinKeywords::hash(name, 0) % numBuckets].push_back(name);
+
+    std::vector<std::size_t> order(numBuckets);
+    for (std::size_t bucket = 0; bucket < numBuckets; ++bucket)
+        order[bucket] = bucket;
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&buckets](const auto b1, const auto b2)
+                     { return buckets[b1].size() > buckets[b2].size(); });
+
+    std::vector<std::string> slots(numSlots);
+    std::vector<bool> occupied(numSlots, false);
+    std::vector<std::uint32_t> seeds(numBuckets, 0);
+    std::vector<std::size_t> candidates;
+
+    for (const auto bucket : order) {
+        const auto& names = buckets[bucket];
+        if (names.empty())
+            break;
+
+        std::uint32_t seed = 1;
+        for (; seed < 10000000; ++seed) {
+            candidates.clear();
+            for (const auto& name : names) {
+                const auto slot = BuiltinKeywords::hash(name, seed) % numSlots;
+                if (occupied[slot] ||
+                    (std::find(candidates.begin(), candidates.end(), slot) != candidates.end()))
+                {
+                    break;
+                }
+
+                candidates.push_back(slot);
+            }
+
+            if (candidates.size() == names.size())
+                break;
+        }
+
+        if (candidates.size() != names.size())
+            throw std::runtime_error("Unable to build perfect hash of builtin keywords");
+
+        seeds[bucket] = seed;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            occupied[candidates[i]] = true;
+            slots[candidates[i]] = names[i];
+        }
+    }
+
+    return { std::move(slots), std::move(seeds) };
+}
+
 }
 
 namespace Opm {
@@ -186,20 +260,29 @@ void Builtin::emplace{}() const {{
         std::filesystem::path parserInitSource(sourceFile);
         std::stringstream newSource;
         newSource << R"(
-#include <opm/input/eclipse/Parser/Parser.hpp>
-#include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywords.hpp>
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 )";
 
+        std::stringstream keywordTable;
+        std::map<std::string, std::size_t> deckNames;
+        std::vector<std::size_t> wildcards;
+        std::vector<std::pair<std::string, std::string>> codeKeywords;
+        std::size_t numKeywords = 0;
+        auto definitionsHash = ParserKeywords::BuiltinKeywords::hashDefinition({});
+
         for(const auto& kw_pair : loader) {
             const auto& first_char = kw_pair.first;
             const std::string header = fmt::format(R"(
 #ifndef OPM_PARSER_INIT_{0}_HH
 #define OPM_PARSER_INIT_{0}_HH
 
+#include <cstddef>
+
 namespace Opm {{
-class Parser;
+class ParserKeyword;
 namespace ParserKeywords {{
-void addDefaultKeywords{0}(Parser& p);
+ParserKeyword createBuiltin{0}(std::size_t index);
 }}
 }}
 #endif
@@ -211,25 +294,47 @@ void addDefaultKeywords{0}(Parser& p);
             write_file(header, charHeaderFile, m_verbose, fmt::format("init header for {}", first_char));
             std::stringstream sourceStr;
             sourceStr << fmt::format(R"(
-#include <opm/input/eclipse/Parser/Parser.hpp>
-#include<opm/input/eclipse/Parser/ParserKeywords/ParserInit{0}.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/ParserInit{0}.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/{0}.hpp>
 
+#include <stdexcept>
+#include <string>
+
 namespace Opm {{
 namespace ParserKeywords {{
-void addDefaultKeywords{0}([[maybe_unused]] Parser& p){{
-    //Builtin keywords;
+ParserKeyword createBuiltin{0}(const std::size_t index) {{
+    switch (index) {{
 )",
                                      first_char);
                 const auto& keywords = kw_pair.second;
-                for (const auto& kw : keywords)
-                    sourceStr << fmt::format("    p.addParserKeyword( {}() );", kw.className()) << std::endl;
-            sourceStr << R"(
+                for (std::size_t index = 0; index < keywords.size(); ++index) {
+                    const auto& kw = keywords[index];
+                    sourceStr << fmt::format("    case {}: return {}();", index, kw.className()) << std::endl;
 
-}
-}
-}
-)";
+                    // Later keywords take precedence for the same deck name,
+                    // as when adding the keywords to the parser one by one.
+                    keywordTable << fmt::format("    BuiltinKeyword {{ \"{}\", &createBuiltin{}, {} }},\n",
+                                                kw.getName(), first_char, index);
+                    for (const auto& deck_name : kw.deck_names())
+                        deckNames[deck_name] = numKeywords;
+
+                    if (kw.hasMatchRegex())
+                        wildcards.push_back(numKeywords);
+
+                    if (kw.isCodeKeyword())
+                        codeKeywords.emplace_back(kw.getName(), kw.codeEnd());
+
+                    definitionsHash = ParserKeywords::BuiltinKeywords::hashDefinition(kw.createCode(), definitionsHash);
+                    ++numKeywords;
+                }
+            sourceStr << fmt::format(R"(    }}
+
+    throw std::invalid_argument("No builtin keyword " + std::to_string(index) + " starting with {0}");
+}}
+}}
+}}
+)",
+                                     first_char);
             auto charSourceFile = std::filesystem::path(sourcePath) / fmt::format("ParserInit{}.cpp", first_char);
             write_file(sourceStr, charSourceFile, m_verbose, fmt::format("init source for {}", first_char));
 
@@ -237,23 +342,59 @@ void addDefaultKeywords{0}([[maybe_unused]] Parser& p){{
                                      first_char);
         }
 
+        const auto [slots, seeds] = perfectHash(deckNames);
+
         newSource << R"(
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace Opm {
 namespace ParserKeywords {
-void addDefaultKeywords(Parser& p);
-void addDefaultKeywords(Parser& p) {
+namespace {
 )";
 
-        for(const auto& [first_char, keywords] : loader) {
-                newSource << fmt::format("    addDefaultKeywords{}(p);", first_char) << std::endl;
-        }
+        newSource << fmt::format("const std::array<BuiltinKeyword, {}> keywords = {{{{\n", numKeywords)
+                  << keywordTable.str() << "}};\n\n";
+
+        newSource << fmt::format("const std::array<BuiltinDeckName, {}> deck_names = {{{{\n", slots.size());
+        for (const auto& deck_name : slots)
+            newSource << fmt::format("    BuiltinDeckName {{ \"{}\", {} }},\n", deck_name, deckNames.at(deck_name));
+        newSource << "}};\n\n";
+
+        newSource << fmt::format("const std::array<std::uint32_t, {}> seeds = {{{{\n", seeds.size());
+        for (const auto& seed : seeds)
+            newSource << fmt::format("    {}U,\n", seed);
+        newSource << "}};\n\n";
+
+        newSource << fmt::format("const std::array<std::size_t, {}> wildcard_keywords = {{{{\n", wildcards.size());
+        for (const auto& wildcard : wildcards)
+            newSource << fmt::format("    {},\n", wildcard);
+        newSource << "}};\n\n";
+
+        newSource << fmt::format("const std::array<BuiltinCodeKeyword, {}> code_keywords = {{{{\n", codeKeywords.size());
+        for (const auto& [name, end] : codeKeywords)
+            newSource << fmt::format("    BuiltinCodeKeyword {{ \"{}\", \"{}\" }},\n", name, end);
+        newSource << "}};\n";
 
         newSource << R"(
+} // Anonymous namespace
+
+const BuiltinKeywords& builtinKeywords()
+{
+    static const auto builtin = BuiltinKeywords {
+        keywords.data(), keywords.size(),
+        deck_names.data(), deck_names.size(),
+        seeds.data(), seeds.size(),
+        wildcard_keywords.data(), wildcard_keywords.size(),
+        code_keywords.data(), code_keywords.size(),
+)";
+        newSource << fmt::format("        {}ULL,\n", definitionsHash);
+        newSource << R"(    };
+
+    return builtin;
 }
 }
-void Parser::addDefaultKeywords() {
-    ParserKeywords::addDefaultKeywords(*this);
-}
 }
 )";
 
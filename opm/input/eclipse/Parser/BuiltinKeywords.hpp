@@ -0,0 +1,143 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_BUILTIN_KEYWORDS_HPP
+#define OPM_BUILTIN_KEYWORDS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace Opm {
+
+class ParserKeyword;
+
+namespace ParserKeywords {
+
+/// Descriptor of a builtin keyword.  The ParserKeyword object itself is
+/// only created when the keyword is first used.
+struct BuiltinKeyword
+{
+    /// Internal name of the keyword.
+    std::string_view name;
+
+    /// Creates the keyword when called with index.
+    ParserKeyword (*create)(std::size_t index);
+    std::size_t index;
+};
+
+/// Deck name of a builtin keyword, with the position of the keyword in
+/// BuiltinKeywords::keywords.
+struct BuiltinDeckName
+{
+    std::string_view name;
+    std::size_t keyword;
+};
+
+/// Code keyword, with the string terminating its content.
+struct BuiltinCodeKeyword
+{
+    std::string_view name;
+    std::string_view end;
+};
+
+/// Table of all builtin keywords, generated by the build system.
+///
+/// The deck names are stored in the slots of a minimal perfect hash
+/// function built by the keyword generator: the bucket of a name selects a
+/// seed, and the hash of the name with that seed is its slot.  Looking up a
+/// name hence never probes more than one slot, and does not allocate.
+struct BuiltinKeywords
+{
+    const BuiltinKeyword* keywords;
+    std::size_t num_keywords;
+
+    const BuiltinDeckName* deck_names;
+    std::size_t num_deck_names;
+
+    const std::uint32_t* seeds;
+    std::size_t num_buckets;
+
+    /// Positions of the keywords which match deck names by regular
+    /// expression.
+    const std::size_t* wildcard_keywords;
+    std::size_t num_wildcard_keywords;
+
+    const BuiltinCodeKeyword* code_keywords;
+    std::size_t num_code_keywords;
+
+    /// Combined hashDefinition() of the generated code of all keywords,
+    /// in the order of keywords.
+    std::uint64_t definitions_hash;
+
+    /// Position in keywords of the keyword with deck name \p name, if any.
+    std::optional<std::size_t> find(std::string_view name) const
+    {
+        if (this->num_deck_names == 0)
+            return std::nullopt;
+
+        const auto seed = this->seeds[hash(name, 0) % this->num_buckets];
+        const auto& slot = this->deck_names[hash(name, seed) % this->num_deck_names];
+        if (slot.name != name)
+            return std::nullopt;
+
+        return slot.keyword;
+    }
+
+    /// Seeded string hash shared by the keyword generator and the lookup.
+    static constexpr std::uint32_t hash(std::string_view name, std::uint32_t seed)
+    {
+        // FNV-1a followed by the Murmur3 finalizer.
+        std::uint32_t h = 2166136261U ^ (seed * 0x9e3779b1U);
+        for (const auto c : name) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619U;
+        }
+
+        h ^= h >> 16;
+        h *= 0x85ebca6bU;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35U;
+        h ^= h >> 16;
+
+        return h;
+    }
+
+    /// Hash of the definition of a keyword, as given by
+    /// ParserKeyword::createCode(), chained to the hash \p h of the
+    /// preceding definitions.  FNV-1a, 64 bits.
+    static constexpr std::uint64_t hashDefinition(std::string_view code,
+                                                  std::uint64_t h = 14695981039346656037ULL)
+    {
+        for (const auto c : code) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ULL;
+        }
+
+        return h;
+    }
+};
+
+/// The builtin keywords of this build.
+const BuiltinKeywords& builtinKeywords();
+
+} // namespace ParserKeywords
+} // namespace Opm
+
+#endif // OPM_BUILTIN_KEYWORDS_HPP
@@ -0,0 +1,247 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <array>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Must be incremented whenever the serialized layout of the Deck changes.
+constexpr std::uint32_t formatVersion = 2;
+
+constexpr std::array<char, 8> magic = { 'O', 'P', 'M', 'D', 'E', 'C', 'K', '\0' };
+
+struct CacheHeader
+{
+    std::array<char, 8> magic{};
+    std::uint32_t version = 0;
+    std::uint32_t reserved = 0;
+    std::uint64_t keySize = 0;
+    std::uint64_t keyChecksum = 0;
+    std::uint64_t deckSize = 0;
+    std::uint64_t deckChecksum = 0;
+};
+
+// File name, size and content hash.
+using FileKey = std::tuple<std::string, std::uint64_t, std::uint64_t>;
+
+class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+{
+public:
+    explicit BufferSerializer(const Opm::Serialization::MemPacker& packer)
+        : Opm::Serializer<Opm::Serialization::MemPacker>(packer)
+    {}
+
+    std::vector<char>& buffer()
+    {
+        return this->m_buffer;
+    }
+};
+
+std::optional<FileKey> fileKey(const std::filesystem::path& fileName)
+{
+    std::ifstream is(fileName, std::ios::binary);
+    if (!is)
+        return std::nullopt;
+
+    // Chunks are multiples of the word size used by the hash, so hashing
+    // chunk by chunk gives the same result for the same content.
+    std::vector<char> chunk(std::size_t{1} << 20);
+    std::uint64_t size = 0;
+    std::uint64_t hash = 0;
+
+    while (is) {
+        is.read(chunk.data(), chunk.size());
+        const auto count = static_cast<std::size_t>(is.gcount());
+        hash = Opm::DeckCache::hash(chunk.data(), count, hash);
+        size += count;
+    }
+
+    if (!is.eof())
+        return std::nullopt;
+
+    return FileKey { std::filesystem::absolute(fileName).string(), size, hash };
+}
+
+bool readBlock(std::istream& is, std::uint64_t size,
+               std::uint64_t checksum, std::vector<char>& buffer)
+{
+    buffer.resize(size);
+    return is.read(buffer.data(), size)
+        && (Opm::DeckCache::hash(buffer.data(), buffer.size()) == checksum);
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+DeckCache::DeckCache(const std::string& cacheFile, const std::string& fingerprint)
+    : cacheFile_  (cacheFile)
+    , fingerprint_(fingerprint)
+{}
+
+std::optional<Deck> DeckCache::load() const
+{
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(this->cacheFile_, ec);
+    if (ec)
+        return std::nullopt;
+
+    std::ifstream is(this->cacheFile_, std::ios::binary);
+    CacheHeader header;
+    if (!is.read(reinterpret_cast<char*>(&header), sizeof header) ||
+        (header.magic != magic) ||
+        (header.version != formatVersion) ||
+        (sizeof header + header.keySize + header.deckSize != fileSize))
+    {
+        return std::nullopt;
+    }
+
+    try {
+        Serialization::MemPacker packer;
+        BufferSerializer serializer(packer);
+
+        if (!readBlock(is, header.keySize, header.keyChecksum, serializer.buffer()))
+            return std::nullopt;
+
+        std::string fingerprint;
+        std::vector<FileKey> inputFiles;
+        serializer.unpack(fingerprint, inputFiles);
+
+        if (fingerprint != this->fingerprint_)
+            return std::nullopt;
+
+        for (const auto& inputFile : inputFiles) {
+            if (fileKey(std::get<0>(inputFile)) != inputFile)
+                return std::nullopt;
+        }
+
+        if (!readBlock(is, header.deckSize, header.deckChecksum, serializer.buffer()))
+            return std::nullopt;
+
+        Deck deck;
+        serializer.unpack(deck);
+        return deck;
+    }
+    catch (const std::exception&) {
+        // A cache file which can not be decoded is as good as no cache.
+        return std::nullopt;
+    }
+}
+
+void DeckCache::store(const Deck& deck,
+                      const std::vector<std::filesystem::path>& inputFiles) const
+{
+    std::vector<FileKey> fileKeys;
+    for (const auto& inputFile : inputFiles) {
+        auto key = fileKey(inputFile);
+        if (!key.has_value())
+            throw std::runtime_error {
+                fmt::format("Unable to read {} for deck cache", inputFile.string())
+            };
+
+        fileKeys.push_back(std::move(*key));
+    }
+
+    Serialization::MemPacker packer;
+    BufferSerializer serializer(packer);
+
+    serializer.pack(this->fingerprint_, fileKeys);
+    const auto key = std::move(serializer.buffer());
+
+    serializer.pack(deck);
+    const auto& data = serializer.buffer();
+
+    CacheHeader header;
+    header.magic = magic;
+    header.version = formatVersion;
+    header.keySize = key.size();
+    header.keyChecksum = hash(key.data(), key.size());
+    header.deckSize = data.size();
+    header.deckChecksum = hash(data.data(), data.size());
+
+    // Write to a temporary file first, so that concurrent runs never see a
+    // partially written cache.
+    auto tmpFile = this->cacheFile_;
+    tmpFile += fmt::format(".{}.tmp", std::random_device{}());
+
+    try {
+        {
+            std::ofstream os(tmpFile, std::ios::binary);
+            os.write(reinterpret_cast<const char*>(&header), sizeof header);
+            os.write(key.data(), key.size());
+            os.write(data.data(), data.size());
+
+            if (!os)
+                throw std::runtime_error {
+                    fmt::format("Unable to write deck cache {}", tmpFile.string())
+                };
+        }
+
+        std::filesystem::rename(tmpFile, this->cacheFile_);
+    }
+    catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(tmpFile, ec);
+        throw;
+    }
+}
+
+std::uint64_t DeckCache::hash(const char* data, std::size_t size, std::uint64_t seed)
+{
+    // Word-wise multiplicative hash.  Each step is a bijection of both the
+    // state and the input word, so a single modified word always changes
+    // the result.
+    constexpr std::uint64_t k = 0x517cc1b727220a95ULL;
+    const auto mix = [](std::uint64_t h, std::uint64_t word)
+    {
+        return (((h << 5) | (h >> 59)) ^ word) * k;
+    };
+
+    std::uint64_t h = seed;
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof word);
+        h = mix(h, word);
+    }
+
+    std::uint64_t tail = 0;
+    if (i < size)
+        std::memcpy(&tail, data + i, size - i);
+
+    return mix(mix(h, tail), size);
+}
+
+} // namespace Opm
@@ -0,0 +1,72 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class Deck;
+
+/// Binary cache of a parsed Deck.
+///
+/// The deck is stored in serialized form, together with the size and a
+/// content hash of every file which was read while parsing it.  The cache
+/// is only used if all of these files are unchanged, and if the
+/// fingerprint of the parser configuration matches the one the cache was
+/// created with.  Both the key and the deck data are checksummed, so a
+/// truncated or otherwise damaged cache file is detected and ignored.
+class DeckCache
+{
+public:
+    /// \param[in] cacheFile Name of cache file.
+    /// \param[in] fingerprint Description of everything besides the input
+    ///    files which affects the parse result, e.g., the parse context.
+    DeckCache(const std::string& cacheFile, const std::string& fingerprint);
+
+    /// Load the cached deck.  Returns nullopt if there is no cache file,
+    /// if it is damaged, or if it is out of date.
+    std::optional<Deck> load() const;
+
+    /// Write deck to the cache file, replacing any existing one.
+    ///
+    /// \param[in] deck Parse result.
+    /// \param[in] inputFiles All files which were read to create deck.
+    void store(const Deck& deck,
+               const std::vector<std::filesystem::path>& inputFiles) const;
+
+    /// Content hash used for both the input files and the checksums.
+    static std::uint64_t hash(const char* data, std::size_t size,
+                              std::uint64_t seed = 0);
+
+private:
+    std::filesystem::path cacheFile_;
+    std::string fingerprint_;
+};
+
+} // namespace Opm
+
+#endif // OPM_DECK_CACHE_HPP
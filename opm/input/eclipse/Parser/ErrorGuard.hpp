@@ -22,6 +22,7 @@
 #define ERROR_GUARD_HPP
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -34,6 +35,9 @@ public:
 
     explicit operator bool() const { return !this->error_list.empty(); }
 
+    const std::vector<std::pair<std::string, std::string>>& warnings() const
+    { return this->warning_list; }
+
     /*
       Observe that this desctructor has a somewhat special semantics. If there
       are errors in the error list it will print all warnings and errors on
@@ -23,7 +23,10 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywords.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
@@ -60,10 +63,14 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
+#include <exception>
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <stack>
 #include <stdexcept>
 #include <string>
@@ -73,6 +80,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
     /// \brief Whether a keyword is a global keyword.
     ///
@@ -157,6 +168,37 @@ namespace {
             ? targetSizeRockFromTabdims(deck)
             : defaultTargetSizeRock();
     }
+
+    /// \brief Builtin keyword at position \p index of the builtin table.
+    ///
+    /// The keyword is created on first use, and shared between all parsers
+    /// and threads afterwards.
+    const Opm::ParserKeyword&
+    builtinKeyword(const Opm::ParserKeywords::BuiltinKeywords& builtin,
+                   const std::size_t index)
+    {
+        struct KeywordCache
+        {
+            explicit KeywordCache(const std::size_t size)
+                : created(size)
+                , keywords(size)
+            {}
+
+            std::vector<std::once_flag> created;
+            std::vector<std::unique_ptr<const Opm::ParserKeyword>> keywords;
+        };
+
+        static KeywordCache cache(builtin.num_keywords);
+
+        std::call_once(cache.created[index], [&builtin, index]()
+        {
+            const auto& keyword = builtin.keywords[index];
+            cache.keywords[index] =
+                std::make_unique<const Opm::ParserKeyword>(keyword.create(keyword.index));
+        });
+
+        return *cache.keywords[index];
+    }
 }
 
 namespace Opm {
@@ -455,6 +497,46 @@ void InputStack::push( std::string&& input, std::filesystem::path p ) {
     this->emplace( p, this->string_storage.back() );
 }
 
+// Called with an exception raised while converting a keyword to deck data.
+// The parser is quite confused at this state and we should not be tempted to
+// continue the parsing.
+//
+// We log a error message with the name of the problematic keyword and the
+// location in the input deck. We rethrow the same exception without updating
+// the what() message of the exception.
+[[noreturn]] void rethrowKeywordError(const std::exception_ptr& error,
+                                      const KeywordLocation& location)
+{
+    try {
+        std::rethrow_exception(error);
+    } catch (const OpmInputError&) {
+        throw;
+    } catch (const std::exception& e) {
+        const OpmInputError opm_error { e, location } ;
+
+        OpmLog::error(opm_error.what());
+
+        std::throw_with_nested(opm_error);
+    }
+}
+
+// Data keywords like ZCORN, PERMX and PORO make up the bulk of large decks.
+// Converting them to deck data does not depend on any other keyword, so it
+// can be postponed and done concurrently for several keywords.
+bool deferrableKeyword(const ParserKeyword& parserKeyword)
+{
+    return parserKeyword.isDataKeyword()
+        && parserKeyword.requiredKeywords().empty()
+        && parserKeyword.prohibitedKeywords().empty();
+}
+
+struct DeferredKeyword {
+    std::unique_ptr<RawKeyword> raw_keyword;
+    const ParserKeyword* parser_keyword;
+    UnitSystem* active_unitsystem;
+    UnitSystem* default_unitsystem;
+};
+
 class ParserState {
     public:
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
@@ -484,9 +566,14 @@ class ParserState {
         const std::set<Opm::Ecl::SectionType>& get_ignore() {return ignore_sections; };
         bool check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary);
 
+        void deferKeyword(std::unique_ptr<RawKeyword> rawKeyword, const ParserKeyword& parserKeyword);
+        void addDeferredKeywords();
+        std::size_t numKeywords() const;
+
     private:
         const std::vector<std::pair<std::string, std::string>> code_keywords;
         InputStack input_stack;
+        std::vector<DeferredKeyword> deferred_keywords;
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
         std::map< std::string, std::string > pathMap;
@@ -501,6 +588,14 @@ class ParserState {
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
+
+        // All files read while parsing, and whether the resulting deck is
+        // fully determined by them.
+        std::vector<std::filesystem::path> input_files;
+        bool cacheable = true;
+
+        // Number of threads used by addDeferredKeywords().
+        int num_threads = 1;
 };
 
 const std::filesystem::path& ParserState::current_path() const {
@@ -547,6 +642,106 @@ void ParserState::closeFile() {
     this->input_stack.pop();
 }
 
+void ParserState::deferKeyword(std::unique_ptr<RawKeyword> rawKeyword,
+                               const ParserKeyword& parserKeyword)
+{
+    // No keyword is added to the deck while keywords are deferred, hence
+    // they all see the same unit systems.
+    this->deferred_keywords.push_back({ std::move(rawKeyword),
+                                        &parserKeyword,
+                                        &this->deck.getActiveUnitSystem(),
+                                        &this->deck.getDefaultUnitSystem() });
+}
+
+/*
+  Convert the deferred keywords to DeckKeyword instances, in parallel, and
+  add them to the deck in input order. This must be called before anything
+  else is added to - or looked up in - the deck.
+*/
+void ParserState::addDeferredKeywords()
+{
+    if (this->deferred_keywords.empty())
+        return;
+
+    auto deferred = std::move(this->deferred_keywords);
+    this->deferred_keywords.clear();
+
+    const int num_keywords = static_cast<int>(deferred.size());
+    std::vector<std::optional<DeckKeyword>> deck_keywords(num_keywords);
+    std::vector<std::exception_ptr> failures(num_keywords);
+
+    const UnitSystem& active_unitsystem = *deferred.front().active_unitsystem;
+    const UnitSystem& default_unitsystem = *deferred.front().default_unitsystem;
+
+    // The workers only record input errors, with every action set to
+    // IGNORE such that nothing is logged and nothing is thrown.  The
+    // recorded errors are handled with the real parse context afterwards,
+    // in input order.
+    auto recordingContext = this->parseContext;
+    recordingContext.update(InputErrorAction::IGNORE);
+    std::vector<ErrorGuard> keyword_errors(num_keywords);
+
+    [[maybe_unused]] const int numThreads = std::max(1, std::min(this->num_threads, num_keywords));
+
+#pragma omp parallel num_threads(numThreads) if(numThreads > 1)
+    {
+        // Parsing registers dimensions in the unit systems, so every thread
+        // works on private copies.
+        UnitSystem active_units = active_unitsystem;
+        UnitSystem default_units = default_unitsystem;
+
+#pragma omp for schedule(dynamic)
+        for (int i = 0; i < num_keywords; ++i) {
+            try {
+                deck_keywords[i] = deferred[i].parser_keyword->parse(recordingContext,
+                                                                     keyword_errors[i],
+                                                                     *deferred[i].raw_keyword,
+                                                                     active_units,
+                                                                     default_units);
+            } catch (...) {
+                failures[i] = std::current_exception();
+            }
+        }
+    }
+
+    for (int i = 0; i < num_keywords; ++i) {
+        const auto& location = deferred[i].raw_keyword->location();
+        for (const auto& [key, msg] : keyword_errors[i].warnings()) {
+            try {
+                this->parseContext.handleError(key, msg, std::nullopt, this->errors);
+            } catch (const OpmInputError&) {
+                // Same exception as when parsing the keyword directly.
+                throw OpmInputError(msg, location);
+            }
+        }
+        keyword_errors[i].clear();
+
+        if (failures[i])
+            rethrowKeywordError(failures[i], location);
+
+        // Register the dimensions in the deck's unit systems exactly as
+        // serial parsing would have done.
+        const auto& parser_keyword = *deferred[i].parser_keyword;
+        for (std::size_t record_nr = 0; record_nr < deck_keywords[i]->size(); ++record_nr) {
+            for (const auto& item : parser_keyword.getRecord(record_nr)) {
+                if ((item.dataType() != type_tag::fdouble) && (item.dataType() != type_tag::uda))
+                    continue;
+
+                for (const auto& dim : item.dimensions()) {
+                    deferred[i].active_unitsystem->getNewDimension(dim);
+                    deferred[i].default_unitsystem->getNewDimension(dim);
+                }
+            }
+        }
+
+        this->deck.addKeyword(std::move(*deck_keywords[i]));
+    }
+}
+
+std::size_t ParserState::numKeywords() const {
+    return this->deck.size() + this->deferred_keywords.size();
+}
+
 ParserState::ParserState(const std::vector<std::pair<std::string, std::string>>& code_keywords_arg,
                          const ParseContext& __parseContext,
                          ErrorGuard& errors_arg,
@@ -630,6 +825,7 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
     if( !ufp ) {
         std::string msg = "Could not read from file: " + inputFile.string();
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
+        this->cacheable = false;
         return;
     }
 
@@ -651,6 +847,7 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
                                   + inputFile.string() + "'" );
 
     this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    this->input_files.push_back( inputFile );
 }
 
 /*
@@ -744,6 +941,9 @@ newRawKeyword(const ParserKeyword& parserKeyword,
               ParserState&         parserState,
               const Parser&        parser)
 {
+    if (!deferrableKeyword(parserKeyword))
+        parserState.addDeferredKeywords();
+
     for (const auto& keyword : parserKeyword.prohibitedKeywords()) {
         if (parserState.deck.hasKeyword(keyword)) {
             parserState
@@ -1363,8 +1563,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             return true;
         }
         
-        if (rawKeyword->getKeywordName() == Opm::RawConsts::end)
+        if (rawKeyword->getKeywordName() == Opm::RawConsts::end) {
+            parserState.addDeferredKeywords();
             return true;
+        }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::endinclude) {
             parserState.closeFile();
@@ -1391,6 +1593,8 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                 deck_tree.add_include(std::filesystem::absolute(parserState.current_path()), includeFile.value() );
                 parserState.loadFile( includeFile.value() );
             }
+            else
+                parserState.cacheable = false;
             continue;
         }
 
@@ -1399,11 +1603,18 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
             {
                 const auto& location = rawKeyword->location();
-                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
+                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.numKeywords(), rawKeyword->getKeywordName(), location.filename, location.lineno);
                 OpmLog::info(msg);
             }
+
+            if (!do_not_add && deferrableKeyword(parserKeyword)) {
+                parserState.deferKeyword(std::move(rawKeyword), parserKeyword);
+                continue;
+            }
+
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
+                    parserState.cacheable = false;
                     if (parserState.python) {
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
                         parserState.python->exec(python_string, parser, parserState.deck);
@@ -1423,30 +1634,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                         const auto& import_file = parserState.getIncludeFilePath(deck_keyword.getRecord(0).getItem(0).getTrimmedString(0));
 
                         ImportContainer import(parser, parserState.deck.getActiveUnitSystem(), import_file.value().string(), formatted, parserState.deck.size());
+                        parserState.input_files.push_back(import_file.value());
                         for (auto kw : import)
                             parserState.deck.addKeyword(std::move(kw));
                     } else
                         if (!do_not_add)
                             parserState.deck.addKeyword( std::move(deck_keyword) );
                 }
-            } catch (const OpmInputError& opm_error) {
-                throw;
-            } catch (const std::exception& e) {
-                /*
-                  This catch-all of parsing errors is to be able to write a good
-                  error message; the parser is quite confused at this state and
-                  we should not be tempted to continue the parsing.
-
-                  We log a error message with the name of the problematic
-                  keyword and the location in the input deck. We rethrow the
-                  same exception without updating the what() message of the
-                  exception.
-                */
-                const OpmInputError opm_error { e, rawKeyword->location() } ;
-
-                OpmLog::error(opm_error.what());
-
-                std::throw_with_nested(opm_error);
+            } catch (const std::exception&) {
+                rethrowKeywordError(std::current_exception(), rawKeyword->location());
             }
         } else {
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
@@ -1455,9 +1651,46 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
     }
 
+    parserState.addDeferredKeywords();
     return true;
 }
 
+/*
+  The following rules apply to the .DATA file argument which is
+  internalized in the deck:
+
+   1. It is normalized by removing uneccessary '.' characters and
+      resolving symlinks.
+
+   2. The relative/abolute status of the path is retained.
+*/
+std::string normalizeDataFile(const std::string& dataFileName) {
+    if (dataFileName[0] == '/')
+        return std::filesystem::canonical(dataFileName).string();
+    else
+        return std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
+}
+
+/*
+  Everything besides the input files which determines the deck: the data
+  file name as stored in the deck, the working directory relative paths
+  are resolved against, the definitions of the parser keywords and the
+  parse context.
+*/
+std::string deckCacheFingerprint(const Parser& parser,
+                                 const std::string& data_file,
+                                 const ParseContext& parseContext) {
+    auto fingerprint = fmt::format("{}\n{}\n{:016x}\n",
+                                   data_file,
+                                   std::filesystem::current_path().string(),
+                                   parser.keywordsFingerprint());
+
+    for (const auto& [key, action] : parseContext)
+        fingerprint += fmt::format("{}={}\n", key, static_cast<int>(action));
+
+    return fingerprint;
+}
+
 }
 
 
@@ -1470,14 +1703,34 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     }
 
     Parser::Parser(bool addDefault) {
-        // The addDefaultKeywords() method is implemented in a source file
-        // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the build
-        // system.
+#ifdef _OPENMP
+        this->num_threads = omp_get_max_threads();
+#endif
 
         if (addDefault)
             this->addDefaultKeywords();
     }
 
+    void Parser::setNumThreads(int numThreads) {
+        if (numThreads < 1)
+            throw std::invalid_argument("Number of threads must be positive");
+
+        this->num_threads = numThreads;
+    }
+
+    void Parser::addDefaultKeywords() {
+        // The table of builtin keywords is generated by the build system in
+        // ${PROJECT_BINARY_DIR}/ParserInit.cpp.  The keywords themselves are
+        // only created when they are first looked up.
+        this->builtin_keywords = &ParserKeywords::builtinKeywords();
+
+        const auto& builtin = *this->builtin_keywords;
+        for (std::size_t i = 0; i < builtin.num_code_keywords; ++i) {
+            const auto& code_keyword = builtin.code_keywords[i];
+            this->code_keywords.emplace_back(code_keyword.name, code_keyword.end);
+        }
+    }
+
 
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
@@ -1552,23 +1805,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                             std::inserter(ignore_sections, ignore_sections.end()));
         }
 
-        /*
-          The following rules apply to the .DATA file argument which is
-          internalized in the deck:
-
-           1. It is normalized by removing uneccessary '.' characters and
-              resolving symlinks.
-
-           2. The relative/abolute status of the path is retained.
-        */
-        
-        std::string data_file;
-        if (dataFileName[0] == '/')
-            data_file = std::filesystem::canonical(dataFileName).string();
-        else
-            data_file = std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
-
+        const auto data_file = normalizeDataFile(dataFileName);
         ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
+        parserState.num_threads = this->num_threads;
         parseState( parserState, *this );
         
         auto ignore = parserState.get_ignore();
@@ -1597,11 +1836,46 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseFile(dataFileName, ParseContext(), errors);
     }
 
+    Deck Parser::parseFileCached(const std::string& dataFileName,
+                                 const std::string& cacheFileName,
+                                 const ParseContext& parseContext,
+                                 ErrorGuard& errors) const {
+        const auto data_file = normalizeDataFile(dataFileName);
+        const DeckCache cache(cacheFileName, deckCacheFingerprint(*this, data_file, parseContext));
+
+        if (auto deck = cache.load(); deck.has_value()) {
+            OpmLog::info(fmt::format("Loaded deck {} from cache {}", data_file, cacheFileName));
+            return std::move(*deck);
+        }
+
+        ParserState parserState( this->codeKeywords(), parseContext, errors, data_file );
+        parserState.num_threads = this->num_threads;
+        parseState( parserState, *this );
+
+        if (parserState.cacheable && !errors) {
+            try {
+                cache.store(parserState.deck, parserState.input_files);
+            }
+            catch (const std::exception& e) {
+                OpmLog::warning(fmt::format("Deck cache {} not written: {}", cacheFileName, e.what()));
+            }
+        }
+
+        return std::move( parserState.deck );
+    }
+
+    Deck Parser::parseFileCached(const std::string& dataFileName,
+                                 const std::string& cacheFileName) const {
+        ErrorGuard errors;
+        return this->parseFileCached(dataFileName, cacheFileName, ParseContext(), errors);
+    }
+
 
 
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
         ParserState parserState( this->codeKeywords(), parseContext, errors );
+        parserState.num_threads = this->num_threads;
         parserState.loadString( data );
         parseState( parserState, *this );
         return std::move( parserState.deck );
@@ -1617,8 +1891,52 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    std::uint64_t Parser::keywordsFingerprint() const {
+        auto fingerprint = ParserKeywords::BuiltinKeywords::hashDefinition({});
+        if (this->builtin_keywords != nullptr)
+            fingerprint = this->builtin_keywords->definitions_hash;
+
+        for (const auto& keyword : this->keyword_storage)
+            fingerprint = ParserKeywords::BuiltinKeywords::hashDefinition(keyword.createCode(), fingerprint);
+
+        return fingerprint;
+    }
+
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        if (this->builtin_keywords == nullptr)
+            return m_deckParserKeywords.size();
+
+        const auto added = std::count_if(m_deckParserKeywords.begin(),
+                                         m_deckParserKeywords.end(),
+                                         [this](const auto& deck_name)
+                                         {
+                                             return !this->builtin_keywords->find(deck_name.first).has_value();
+                                         });
+
+        return this->builtin_keywords->num_deck_names + added;
+    }
+
+    bool Parser::hasDeckName(const std::string_view& name) const
+    {
+        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || ((this->builtin_keywords != nullptr) && this->builtin_keywords->find(name).has_value());
+    }
+
+    const ParserKeyword* Parser::deckKeyword(const std::string_view& name) const
+    {
+        // Keywords added to the parser take precedence over the builtin
+        // keywords.
+        const auto it = this->m_deckParserKeywords.find(name);
+        if (it != this->m_deckParserKeywords.end())
+            return it->second;
+
+        if (this->builtin_keywords == nullptr)
+            return nullptr;
+
+        const auto keyword = this->builtin_keywords->find(name);
+        return keyword.has_value()
+            ? &builtinKeyword(*this->builtin_keywords, *keyword)
+            : nullptr;
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
@@ -1629,11 +1947,40 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                                      {
                                          return wild.second->matches(name);
                                      });
-        return it != m_wildCardKeywords.end() ? it->second : nullptr;
+        if (it != m_wildCardKeywords.end())
+            return it->second;
+
+        if (this->builtin_keywords == nullptr)
+            return nullptr;
+
+        const auto& builtin = *this->builtin_keywords;
+        for (std::size_t i = 0; i < builtin.num_wildcard_keywords; ++i) {
+            const auto index = builtin.wildcard_keywords[i];
+            if (m_wildCardKeywords.count(builtin.keywords[index].name) > 0)
+                continue;
+
+            const auto& keyword = builtinKeyword(builtin, index);
+            if (keyword.matches(name))
+                return &keyword;
+        }
+
+        return nullptr;
     }
 
     bool Parser::hasWildCardKeyword(const std::string& internalKeywordName) const {
-        return (m_wildCardKeywords.count(internalKeywordName) > 0);
+        if (m_wildCardKeywords.count(internalKeywordName) > 0)
+            return true;
+
+        if (this->builtin_keywords == nullptr)
+            return false;
+
+        const auto& builtin = *this->builtin_keywords;
+        return std::any_of(builtin.wildcard_keywords,
+                           builtin.wildcard_keywords + builtin.num_wildcard_keywords,
+                           [&builtin, &internalKeywordName](const auto index)
+                           {
+                               return builtin.keywords[index].name == internalKeywordName;
+                           });
     }
 
     bool Parser::isRecognizedKeyword(std::string_view name) const
@@ -1642,14 +1989,14 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             return false;
         }
 
-        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+        return this->hasDeckName(name)
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && this->hasDeckName(name);
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1692,8 +2039,7 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return this->hasDeckName( std::string_view( name ) );
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1701,9 +2047,9 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 }
 
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
-    auto candidate = m_deckParserKeywords.find( name );
+    const auto* candidate = this->deckKeyword( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate != nullptr ) return *candidate;
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1714,13 +2060,27 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view
 }
 
 std::vector<std::string> Parser::getAllDeckNames () const {
-    std::vector<std::string> keywords;
-    for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
-        keywords.push_back(std::string(iterator->first));
+    std::set<std::string_view> deck_names;
+    std::set<std::string_view> wildcard_names;
+    for (const auto& deck_name : m_deckParserKeywords) {
+        deck_names.insert(deck_name.first);
     }
-    for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
-        keywords.push_back(std::string(iterator->first));
+    for (const auto& wildcard : m_wildCardKeywords) {
+        wildcard_names.insert(wildcard.first);
     }
+
+    if (this->builtin_keywords != nullptr) {
+        const auto& builtin = *this->builtin_keywords;
+        for (std::size_t i = 0; i < builtin.num_deck_names; ++i) {
+            deck_names.insert(builtin.deck_names[i].name);
+        }
+        for (std::size_t i = 0; i < builtin.num_wildcard_keywords; ++i) {
+            wildcard_names.insert(builtin.keywords[builtin.wildcard_keywords[i]].name);
+        }
+    }
+
+    std::vector<std::string> keywords(deck_names.begin(), deck_names.end());
+    keywords.insert(keywords.end(), wildcard_names.begin(), wildcard_names.end());
     return keywords;
 }
 
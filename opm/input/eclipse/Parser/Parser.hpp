@@ -20,6 +20,7 @@
 #ifndef OPM_PARSER_HPP
 #define OPM_PARSER_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <iosfwd>
 #include <list>
@@ -53,6 +54,10 @@ namespace Opm {
     class ErrorGuard;
     class RawKeyword;
 
+    namespace ParserKeywords {
+        struct BuiltinKeywords;
+    }
+
     /// The hub of the parsing process.
     /// An input file in the eclipse data format is specified, several steps of parsing is performed
     /// and the semantically parsed result is returned.
@@ -79,6 +84,19 @@ namespace Opm {
 
         Deck parseFile(const std::string& datafile) const;
 
+        /// Like parseFile(), but reuses the deck stored in cacheFile by an
+        /// earlier run if neither the input files nor the parse context have
+        /// changed since.  Otherwise the deck is parsed and the cache file is
+        /// (re)written.  Note that diagnostics from the original parse are
+        /// not repeated when the cached deck is used.
+        Deck parseFileCached(const std::string& dataFile,
+                             const std::string& cacheFile,
+                             const ParseContext&,
+                             ErrorGuard& errors) const;
+
+        Deck parseFileCached(const std::string& dataFile,
+                             const std::string& cacheFile) const;
+
         Deck parseString(const std::string &data,
                          const ParseContext&,
                          ErrorGuard& errors) const;
@@ -137,6 +155,24 @@ namespace Opm {
          */
         size_t size() const;
 
+        /*!
+         * \brief Hash of the definitions of all keywords of the parser
+         *
+         * The hash covers the builtin keywords, if they were added, and all
+         * keywords added later, so it changes whenever the parser would
+         * read a deck differently because of a changed keyword definition.
+         */
+        std::uint64_t keywordsFingerprint() const;
+
+        /*!
+         * \brief Number of threads used to convert data keywords, like ZCORN
+         *        and PERMX, to deck data
+         *
+         * Defaults to the OpenMP default, i.e., OMP_NUM_THREADS if set.
+         */
+        void setNumThreads(int numThreads);
+        int numThreads() const { return num_threads; }
+
         template <class T>
         void addKeyword() {
             addParserKeyword( T() );
@@ -170,13 +206,21 @@ namespace Opm {
 
     private:
         bool hasWildCardKeyword(const std::string& keyword) const;
+        bool hasDeckName(const std::string_view& deckKeywordName) const;
+        const ParserKeyword* deckKeyword(const std::string_view& deckKeywordName) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
         void addDefaultKeywords();
 
+        // Table of the builtin keywords, if they were added.  The builtin
+        // ParserKeyword objects are shared by all parsers, and created on
+        // first use.
+        const ParserKeywords::BuiltinKeywords* builtin_keywords{nullptr};
+
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage;
 
-        // associative map of deck names and the corresponding ParserKeyword object
+        // associative map of deck names and the corresponding ParserKeyword
+        // object, for keywords added in addition to the builtin keywords
         std::map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
 
         // associative map of the parser internal names and the corresponding
@@ -184,6 +228,7 @@ namespace Opm {
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+        int num_threads = 1;
     };
 
 } // namespace Opm
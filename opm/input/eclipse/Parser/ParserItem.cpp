@@ -17,10 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <numeric>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <string_view>
+#include <type_traits>
 
 #include <opm/json/JsonObject.hpp>
 
@@ -29,6 +33,7 @@
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 #include "raw/StarToken.hpp"
 
@@ -457,6 +462,52 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+/*
+ * Scan a single token of an ALL sized item, possibly of the form N*value or
+ * N*.  The common forms are handled without allocating; anything unusual is
+ * left to StarToken, which also diagnoses malformed tokens.
+ */
+template< typename T >
+void scan_token( DeckItem& deck_item, const ParserItem& parser_item, std::string_view token ) {
+    const auto star = std::find_if( token.begin(), token.end(),
+                                    []( char c ) { return (c < '0') || (c > '9'); } );
+
+    if( (star == token.end()) || (*star != '*') ) {
+        deck_item.push_back( readValueToken< T >( token ) );
+        return;
+    }
+
+    std::size_t count = 0;
+    if( (star != token.begin()) && (star - token.begin() <= 9) )
+        count = std::accumulate( token.begin(), star, std::size_t{0},
+                                 []( std::size_t n, char c ) { return 10*n + (c - '0'); } );
+
+    std::string_view value;
+    if( count > 0 ) {
+        value = token.substr( star - token.begin() + 1 );
+    } else {
+        std::string countString;
+        std::string valueString;
+        isStarToken( token, countString, valueString );
+
+        StarToken st(token, countString, valueString);
+        count = st.count();
+        value = token.substr( token.size() - st.valueString().size() );
+    }
+
+    if( !value.empty() ) {
+        deck_item.push_back( readValueToken< T >( value ), count );
+        return;
+    }
+
+    if (parser_item.hasDefault()) {
+        auto value_default = parser_item.getDefault< T >();
+        deck_item.push_backDefault( value_default, count );
+    } else {
+        deck_item.push_backDummyDefault<T>( count );
+    }
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
     bool parse_raw = parser_item.parseRaw();
@@ -472,32 +523,34 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
-        while( record.size() > 0 ) {
-            auto token = record.pop_front();
-
-            std::string countString;
-            std::string valueString;
-
-            if( !isStarToken( token, countString, valueString ) ) {
-                deck_item.push_back( readValueToken< T >( token ) );
-                continue;
-            }
-
-            StarToken st(token, countString, valueString);
-
-            if( st.hasValue() ) {
-                deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
-                continue;
-            }
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, double>) {
+            // Bulk numeric data like ZCORN and PERMX: scan the tokens
+            // directly from the record string instead of splitting the
+            // record into items first.
+            const auto input = record.unsplitRecordString();
+            if (input.has_value() && (input->find(RawConsts::quote) == std::string_view::npos)) {
+                const RawConsts::is_separator is_separator{};
+                auto current = input->begin();
+                const auto end = input->end();
+
+                record.clear();
+                while (true) {
+                    current = std::find_if_not(current, end, is_separator);
+                    if (current == end)
+                        break;
+
+                    const auto token_end = std::find_if(current, end, is_separator);
+                    scan_token<T>(deck_item, parser_item, { &*current, static_cast<std::size_t>(token_end - current) });
+                    current = token_end;
+                }
 
-            if (parser_item.hasDefault()) {
-                auto value = parser_item.getDefault< T >();
-                deck_item.push_backDefault( value, st.count());
-            } else {
-                deck_item.push_backDummyDefault<T>(st.count());
+                return;
             }
         }
 
+        while( record.size() > 0 )
+            scan_token<T>( deck_item, parser_item, record.pop_front() );
+
         return;
     }
 
@@ -84,24 +84,52 @@ inline bool even_quotes( const T& str ) {
         m_sanitizedRecordString( singleRecordString )
     {
 
-        if (text)
+        if (text) {
             this->m_recordItems.push_back(this->m_sanitizedRecordString);
-        else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
-            if( !even_quotes( singleRecordString ) ) {
-                std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
-                throw OpmInputError(error, location);
-            }
+            this->m_max_size = this->m_recordItems.size();
+            this->m_split = true;
+        }
+        else if( !even_quotes( singleRecordString ) ) {
+            std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
+            throw OpmInputError(error, location);
         }
-        this->m_max_size = this->m_recordItems.size();
     }
 
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location) :
         RawRecord(singleRecordString, location, false)
     {}
 
+    void RawRecord::split() const {
+        this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
+        this->m_max_size = this->m_recordItems.size();
+        this->m_split = true;
+    }
+
+    bool RawRecord::empty() const {
+        if (this->m_split)
+            return this->m_recordItems.empty();
+
+        return std::find_if_not(this->m_sanitizedRecordString.begin(),
+                                this->m_sanitizedRecordString.end(),
+                                RawConsts::is_separator()) == this->m_sanitizedRecordString.end();
+    }
+
+    std::optional<std::string_view> RawRecord::unsplitRecordString() const {
+        if (this->m_split)
+            return std::nullopt;
+
+        return this->m_sanitizedRecordString;
+    }
+
+    void RawRecord::clear() {
+        // Consumers which scanned the record string themselves discard it
+        // here, so there is no point in splitting it first.
+        this->m_recordItems.clear();
+        this->m_split = true;
+    }
+
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
+        if (!this->m_split) this->split();
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
         this->m_max_size += count;
     }
@@ -111,6 +139,7 @@ inline bool even_quotes( const T& str ) {
     }
 
     std::size_t RawRecord::max_size() const {
+        if (!this->m_split) this->split();
         return this->m_max_size;
     }
 }
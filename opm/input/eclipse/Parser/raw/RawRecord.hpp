@@ -25,6 +25,7 @@
 #include <string>
 #include <string_view>
 #include <list>
+#include <optional>
 
 namespace Opm {
 class KeywordLocation;
@@ -32,6 +33,8 @@ class KeywordLocation;
     /// Class representing the lowest level of the Raw datatypes, a record. A record is simply
     /// a vector containing the record elements, represented as strings. Some logic is present
     /// to handle special elements in a record string, particularly with quote characters.
+    /// The record string is split into elements on first access, such that this work is
+    /// done by whoever converts the record to deck data.
 
     class RawRecord {
     public:
@@ -42,15 +45,24 @@ class KeywordLocation;
         inline std::string_view front() const;
         void push_front( std::string_view token, std::size_t count );
         inline size_t size() const;
+        bool empty() const;
         std::size_t max_size() const;
 
         std::string getRecordString() const;
         inline std::string_view getItem(size_t index) const;
 
+        /// The record string, for consumers which scan the items
+        /// themselves.  Empty if the items have already been accessed.
+        std::optional<std::string_view> unsplitRecordString() const;
+        void clear();
+
     private:
+        void split() const;
+
         std::string_view m_sanitizedRecordString;
-        std::deque< std::string_view > m_recordItems;
-        std::size_t m_max_size;
+        mutable std::deque< std::string_view > m_recordItems;
+        mutable std::size_t m_max_size = 0;
+        mutable bool m_split = false;
     };
 
     /*
@@ -58,20 +70,24 @@ class KeywordLocation;
      * inlining the calls gives a decent low-effort performance benefit.
      */
     std::string_view RawRecord::pop_front() {
+        if (!this->m_split) this->split();
         auto result = m_recordItems.front();
         this->m_recordItems.pop_front();
         return result;
     }
 
     std::string_view RawRecord::front() const {
+        if (!this->m_split) this->split();
         return this->m_recordItems.front();
     }
 
     size_t RawRecord::size() const {
+        if (!this->m_split) this->split();
         return m_recordItems.size();
     }
 
     std::string_view RawRecord::getItem(size_t index) const {
+        if (!this->m_split) this->split();
         return this->m_recordItems.at( index );
     }
 }
@@ -20,7 +20,9 @@
 #include <array>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <cstdlib>
 
@@ -32,6 +34,126 @@
 
 namespace qi = boost::spirit::qi;
 
+namespace {
+
+    // Fast paths for the plain decimal numbers which make up the bulk of
+    // numeric deck data.  They return false for anything else, which is
+    // then handled by the general Spirit based parsers below.
+
+    bool readSign(std::string_view::const_iterator& cursor,
+                  const std::string_view::const_iterator& end)
+    {
+        if ((cursor != end) && ((*cursor == '-') || (*cursor == '+')))
+            return *cursor++ == '-';
+
+        return false;
+    }
+
+    bool fastReadInt(std::string_view view, int& value)
+    {
+        auto cursor = view.begin();
+        const bool negative = readSign(cursor, view.end());
+
+        // Up to nine digits can not overflow
+        const auto num_digits = view.end() - cursor;
+        if ((num_digits < 1) || (num_digits > 9))
+            return false;
+
+        int n = 0;
+        for (; cursor != view.end(); ++cursor) {
+            const auto digit = static_cast<unsigned>(*cursor - '0');
+            if (digit > 9)
+                return false;
+
+            n = 10*n + static_cast<int>(digit);
+        }
+
+        value = negative ? -n : n;
+        return true;
+    }
+
+    // With at most 15 digits the mantissa, and with a decimal
+    // exponent in [-22, 22] the power of ten, are exactly representable.  A
+    // single multiplication or division then yields the correctly rounded
+    // result, which is also what the Spirit parser computes in this case.
+    bool fastReadDouble(std::string_view view, double& value)
+    {
+        static constexpr std::array<double, 23> pow10 = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        auto cursor = view.begin();
+        const auto end = view.end();
+        const bool negative = readSign(cursor, end);
+
+        std::uint64_t mantissa = 0;
+        int total_digits = 0;
+        int exponent = 0;
+
+        auto read_digits = [&cursor, &end, &mantissa, &total_digits]()
+        {
+            const auto start = cursor;
+            for (; cursor != end; ++cursor) {
+                const auto digit = static_cast<unsigned>(*cursor - '0');
+                if (digit > 9)
+                    break;
+
+                mantissa = 10*mantissa + digit;
+            }
+
+            const auto num_digits = static_cast<int>(cursor - start);
+            total_digits += num_digits;
+            return num_digits;
+        };
+
+        if (read_digits() == 0)
+            return false;
+
+        if ((cursor != end) && (*cursor == '.')) {
+            ++cursor;
+            exponent -= read_digits();
+        }
+
+        // Leading zeros count as well, to round exactly like Spirit does
+        if (total_digits > 15)
+            return false;
+
+        if ((cursor != end) && ((*cursor == 'e') || (*cursor == 'E') ||
+                                (*cursor == 'd') || (*cursor == 'D')))
+        {
+            ++cursor;
+            const bool negative_exp = readSign(cursor, end);
+
+            const auto num_digits = end - cursor;
+            if ((num_digits < 1) || (num_digits > 4))
+                return false;
+
+            int exp = 0;
+            for (; cursor != end; ++cursor) {
+                const auto digit = static_cast<unsigned>(*cursor - '0');
+                if (digit > 9)
+                    return false;
+
+                exp = 10*exp + static_cast<int>(digit);
+            }
+
+            exponent += negative_exp ? -exp : exp;
+        }
+
+        if ((cursor != end) || (exponent < -22) || (exponent > 22))
+            return false;
+
+        const double n = (exponent < 0)
+            ? static_cast<double>(mantissa) / pow10[-exponent]
+            : static_cast<double>(mantissa) * pow10[exponent];
+
+        value = negative ? -n : n;
+        return true;
+    }
+
+}
+
 namespace Opm {
 
     bool isStarToken(const std::string_view& token,
@@ -73,6 +195,9 @@ namespace Opm {
     template<>
     int readValueToken< int >( std::string_view view ) {
         int n = 0;
+        if (fastReadInt(view, n))
+            return n;
+
         auto cursor = view.begin();
         const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
 
@@ -98,6 +223,9 @@ namespace Opm {
     template<>
     double readValueToken< double >( std::string_view view ) {
         double n = 0;
+        if (fastReadDouble(view, n))
+            return n;
+
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
         const auto ok = qi::parse( cursor, view.end(), double_, n );
@@ -127,6 +255,9 @@ namespace Opm {
     template<>
     UDAValue readValueToken< UDAValue >( std::string_view view ) {
         double n = 0;
+        if (fastReadDouble(view, n))
+            return UDAValue(n);
+
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
         const auto ok = qi::parse( cursor, view.end(), double_, n );
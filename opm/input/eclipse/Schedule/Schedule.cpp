@@ -94,13 +94,16 @@
 #include "KeywordHandlers.hpp"
 #include "MSW/Compsegs.hpp"
 #include "MSW/WelSegsSet.hpp"
+#include "ScheduleReplay.hpp"
 #include "Well/injection.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -555,7 +558,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix,
                                       const bool keepKeywords,
-                                      const bool log_to_debug)
+                                      const bool log_to_debug,
+                                      const ScheduleReplay* replay)
 {
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
@@ -634,6 +638,24 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                        block.location().lineno));
                 }
             }
+            if (replay != nullptr) {
+                // Report steps which were not affected by an action are
+                // taken from the snapshots computed before it was applied.
+                auto state = replay->reuse(report_step, block, this->snapshots.back());
+                if (state.has_value()) {
+                    this->snapshots.push_back(std::move(*state));
+
+                    if (this->must_write_rst_file(report_step)) {
+                        this->restart_output.addRestartOutput(report_step);
+                    }
+
+                    if (!keepKeywords) {
+                        this->m_sched_deck.clearKeywords(report_step);
+                    }
+                    continue;
+                }
+            }
+
             this->create_next(block);
 
             std::unordered_map<std::string, double> wpimult_global_factor;
@@ -887,6 +909,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
         auto events = this->snapshots[report_step].events();
         events.clearEvent(event);
         this->snapshots[report_step].update_events(events);
+        this->newGeneration();
     }
 
 
@@ -1495,6 +1518,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 well.get().filterConnections(grid);
             }
         }
+
+        this->newGeneration();
     }
 
 
@@ -1542,6 +1567,24 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         return std::chrono::duration_cast<std::chrono::seconds>(end_time - start_time).count();
     }
 
+    ScheduleReplay Schedule::truncateForReplay(const std::size_t reportStep) {
+        // The snapshots following reportStep are discarded and recomputed
+        // after the keywords have been applied, but kept for reuse where
+        // they are not affected.
+        auto previous = std::vector<ScheduleState>{};
+        if (reportStep < this->snapshots.size()) {
+            previous.reserve(this->snapshots.size() - reportStep);
+            previous.push_back(this->snapshots[reportStep]);
+            std::move(this->snapshots.begin() + reportStep + 1, this->snapshots.end(),
+                      std::back_inserter(previous));
+        }
+
+        this->snapshots.resize(reportStep + 1);
+        this->newGeneration();
+
+        return ScheduleReplay { reportStep + 1, std::move(previous) };
+    }
+
     void Schedule::applyKeywords(std::vector<std::unique_ptr<DeckKeyword>>& keywords) {
         Schedule::applyKeywords(keywords, this->current_report_step);
     }
@@ -1560,7 +1603,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         std::unordered_map<std::string, double> target_wellpi;
         std::vector<std::string> matching_wells;
         const std::string prefix = "| "; /* logger prefix string */
-        this->snapshots.resize(reportStep + 1);
+        const auto replay = this->truncateForReplay(reportStep);
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
         ScheduleLogger logger(ScheduleLogger::select_stream(false, false), // will log to OpmLog::info
@@ -1599,7 +1642,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 errors,
                 grid,
                 &target_wellpi,
-                prefix, true);
+                prefix, true, false, &replay);
         }
         this->simUpdateFromPython->append(sim_update);
     }
@@ -1641,7 +1684,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                   "keywords and\n{0}rerun Schedule section.\n{0}",
                                   prefix, action.name()));
 
-        this->snapshots.resize(reportStep + 1);
+        const auto replay = this->truncateForReplay(reportStep);
         auto& input_block = this->m_sched_deck[reportStep];
 
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1685,7 +1728,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             const auto log_to_debug = true;
             this->iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(),
                                          parseContext, errors, grid, &target_wellpi,
-                                         prefix, keepKeywords, log_to_debug);
+                                         prefix, keepKeywords, log_to_debug, &replay);
         }
 
         OpmLog::debug("\\----------------------------------------------------------------------");
@@ -1828,6 +1871,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 prev_well = wellPtr;
             }
         }
+
+        this->newGeneration();
     }
 
     bool Schedule::write_rst_file(const std::size_t report_step) const
@@ -1876,6 +1921,12 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         return keywords;
     }
 
+    std::size_t Schedule::nextGeneration()
+    {
+        static std::atomic<std::size_t> generation{0};
+        return generation++;
+    }
+
     bool Schedule::operator==(const Schedule& data) const {
         // If this has a simUpdateFromPython pointer and data does not
         // (or the other way round), then they are *not* equal.
@@ -2457,6 +2508,7 @@ std::vector<ScheduleState>::const_iterator Schedule::end() const {
 }
 
 void Schedule::create_first(const time_point& start_time, const std::optional<time_point>& end_time) {
+    this->newGeneration();
     if (end_time.has_value())
         this->snapshots.emplace_back( start_time, end_time.value() );
     else
@@ -2502,6 +2554,7 @@ void Schedule::create_next(const time_point& start_time, const std::optional<tim
     if (this->snapshots.empty())
         this->create_first(start_time, end_time);
     else {
+        this->newGeneration();
         const auto& last = this->snapshots.back();
         if (end_time.has_value())
             this->snapshots.emplace_back( last, start_time, end_time.value() );
@@ -71,6 +71,7 @@ namespace Opm
     class Runspec;
     class RPTConfig;
     class ScheduleGrid;
+    class ScheduleReplay;
     class SCHEDULESection;
     class SegmentMatcher;
     class SummaryState;
@@ -196,6 +197,12 @@ namespace Opm
         const UnitSystem& getUnits() const { return this->m_static.m_unit_system; }
         const Runspec& runspec() const { return this->m_static.m_runspec; }
 
+        // Identifies the current contents of the schedule snapshots.  The
+        // value changes whenever snapshot contents may have been replaced
+        // after construction, e.g., by ACTIONX, PYACTION or WELPI, so
+        // clients holding pointers into the snapshots know to refresh them.
+        std::size_t generation() const { return this->m_generation; }
+
         std::size_t numWells() const;
         std::size_t numWells(std::size_t timestep) const;
         bool hasWell(const std::string& wellName) const;
@@ -371,6 +378,8 @@ namespace Opm
                         well.second->updateUnitSystem(&m_static.m_unit_system);
                     }
                 }
+
+                this->newGeneration();
             }
         }
 
@@ -545,6 +554,12 @@ namespace Opm
         // It is a shared_ptr, so a Schedule can be constructed using the copy constructor sharing the simUpdateFromPython.
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
+        // Process-wide unique snapshot generation, see generation().  Not
+        // part of operator==() or serialization.
+        std::size_t m_generation{nextGeneration()};
+
+        static std::size_t nextGeneration();
+        void newGeneration() { this->m_generation = nextGeneration(); }
 
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
@@ -579,7 +594,9 @@ namespace Opm
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix,
                                     const bool keepKeywords,
-                                    const bool log_to_debug = false);
+                                    const bool log_to_debug = false,
+                                    const ScheduleReplay* replay = nullptr);
+        ScheduleReplay truncateForReplay(std::size_t reportStep);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -0,0 +1,265 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ScheduleReplay.hpp"
+
+#include <opm/input/eclipse/Deck/DeckItem.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckRecord.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
+#include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
+#include <opm/input/eclipse/Schedule/Network/Balance.hpp>
+#include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
+#include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
+#include <opm/input/eclipse/Schedule/RFTConfig.hpp>
+#include <opm/input/eclipse/Schedule/RPTConfig.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleBlock.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+
+// Wells and groups in which two snapshots differ.  Differences in any other
+// member are not tracked individually.
+struct StateDifference
+{
+    std::unordered_set<std::string> wells{};
+    std::unordered_set<std::string> groups{};
+
+    bool empty() const
+    {
+        return this->wells.empty() && this->groups.empty();
+    }
+};
+
+template <typename T>
+bool same(const Opm::ScheduleState::ptr_member<T>& member1,
+          const Opm::ScheduleState::ptr_member<T>& member2)
+{
+    // Members which were not updated share the same instance.
+    return (&member1.get() == &member2.get())
+        || (member1.get() == member2.get());
+}
+
+// Collects the keys of the elements which differ, returns false if the
+// maps do not have the same keys.
+template <typename K, typename T>
+bool collect_differences(const Opm::ScheduleState::map_member<K, T>& member1,
+                         const Opm::ScheduleState::map_member<K, T>& member2,
+                         std::unordered_set<K>& keys)
+{
+    if (member1.size() != member2.size())
+        return false;
+
+    for (const auto& [key, ptr1] : member1) {
+        const auto ptr2 = member2.get_ptr(key);
+        if (ptr2 == nullptr)
+            return false;
+
+        if ((ptr1 != ptr2) && !(*ptr1 == *ptr2))
+            keys.insert(key);
+    }
+
+    return true;
+}
+
+template <typename K, typename T>
+bool same(const Opm::ScheduleState::map_member<K, T>& member1,
+          const Opm::ScheduleState::map_member<K, T>& member2)
+{
+    auto keys = std::unordered_set<K>{};
+    return collect_differences(member1, member2, keys) && keys.empty();
+}
+
+// The difference between two snapshots of the same report step, or nullopt
+// if they differ in other members than individual wells and groups.  The
+// members which only apply to a single report step, like the events, are
+// ignored since they are not carried over to the next report step.
+std::optional<StateDifference> difference(const Opm::ScheduleState& state1,
+                                          const Opm::ScheduleState& state2)
+{
+    const auto same_members =
+        (state1.start_time() == state2.start_time())
+        && (state1.sim_step() == state2.sim_step())
+        && (state1.tuning() == state2.tuning())
+        && (state1.nupcol() == state2.nupcol())
+        && (state1.oilvap() == state2.oilvap())
+        && (state1.message_limits() == state2.message_limits())
+        && (state1.whistctl() == state2.whistctl())
+        && (state1.sumthin() == state2.sumthin())
+        && (state1.rptonly() == state2.rptonly())
+        && (state1.next_tstep == state2.next_tstep)
+        && (state1.aqufluxs == state2.aqufluxs)
+        && (state1.bcprop == state2.bcprop)
+        && same(state1.gconsale, state2.gconsale)
+        && same(state1.gconsump, state2.gconsump)
+        && same(state1.gecon, state2.gecon)
+        && same(state1.guide_rate, state2.guide_rate)
+        && same(state1.wlist_manager, state2.wlist_manager)
+        && same(state1.well_order, state2.well_order)
+        && same(state1.group_order, state2.group_order)
+        && same(state1.actions, state2.actions)
+        && same(state1.udq, state2.udq)
+        && same(state1.udq_active, state2.udq_active)
+        && same(state1.pavg, state2.pavg)
+        && same(state1.wtest_config, state2.wtest_config)
+        && same(state1.glo, state2.glo)
+        && same(state1.network, state2.network)
+        && same(state1.network_balance, state2.network_balance)
+        && same(state1.rescoup, state2.rescoup)
+        && same(state1.rpt_config, state2.rpt_config)
+        && same(state1.rft_config, state2.rft_config)
+        && same(state1.rst_config, state2.rst_config)
+        && same(state1.bhp_defaults, state2.bhp_defaults)
+        && same(state1.source, state2.source)
+        && same(state1.vfpprod, state2.vfpprod)
+        && same(state1.vfpinj, state2.vfpinj);
+
+    if (!same_members)
+        return std::nullopt;
+
+    auto diff = StateDifference{};
+    if (!collect_differences(state1.wells, state2.wells, diff.wells) ||
+        !collect_differences(state1.groups, state2.groups, diff.groups))
+    {
+        return std::nullopt;
+    }
+
+    return diff;
+}
+
+// Whether the keywords of a report step are known to leave the wells and
+// groups in the difference untouched, and to not depend on them.  Only a
+// few common well control keywords which refer to wells by explicit name
+// qualify; these only access the named wells, besides members like the
+// UDQ configuration which must not differ in the first place.
+bool independent(const Opm::ScheduleBlock& block, const StateDifference& diff)
+{
+    static const auto well_keywords = std::unordered_set<std::string> {
+        "WCONHIST", "WCONINJE", "WCONINJH", "WCONPROD", "WELOPEN", "WELTARG",
+    };
+
+    for (const auto& keyword : block) {
+        if (well_keywords.count(keyword.name()) == 0)
+            return false;
+
+        for (const auto& record : keyword) {
+            const auto& well = record.getItem("WELL").getTrimmedString(0);
+
+            // Patterns, well lists and ACTIONX matching wells.
+            if (well.find_first_of("*?[") != std::string::npos)
+                return false;
+
+            if (diff.wells.count(well) > 0)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Whether the keywords of a report step must be processed even if the
+// snapshot they are applied to is unchanged.  WELPI uses the target
+// productivity indices passed along with the action, and WELSEGS and
+// COMPSEGS feed the consistency check of multisegment wells, which spans
+// all report steps which are processed again.
+bool must_process(const Opm::ScheduleBlock& block)
+{
+    static const auto keywords = std::unordered_set<std::string> {
+        "COMPSEGS", "WELPI", "WELSEGS",
+    };
+
+    return std::any_of(block.begin(), block.end(),
+                       [](const auto& keyword) { return keywords.count(keyword.name()) > 0; });
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+ScheduleReplay::ScheduleReplay(const std::size_t first_step,
+                               std::vector<ScheduleState> previous)
+    : first_step_(first_step)
+    , previous_  (std::move(previous))
+{}
+
+std::optional<ScheduleState>
+ScheduleReplay::reuse(const std::size_t report_step,
+                      const ScheduleBlock& block,
+                      const ScheduleState& current) const
+{
+    if ((report_step < this->first_step_) ||
+        (report_step - this->first_step_ + 1 >= this->previous_.size()))
+    {
+        return std::nullopt;
+    }
+
+    if (must_process(block))
+        return std::nullopt;
+
+    const auto& previous_state = this->previous_[report_step - this->first_step_];
+    const auto& previous_next = this->previous_[report_step - this->first_step_ + 1];
+
+    const auto diff = difference(current, previous_state);
+    if (!diff.has_value())
+        return std::nullopt;
+
+    if (diff->empty())
+        return previous_next;
+
+    if (!independent(block, *diff))
+        return std::nullopt;
+
+    // The differing wells and groups must have been carried over unchanged
+    // to the next report step.
+    for (const auto& well : diff->wells) {
+        if (previous_next.wells.get_ptr(well) != previous_state.wells.get_ptr(well))
+            return std::nullopt;
+    }
+
+    for (const auto& group : diff->groups) {
+        if (previous_next.groups.get_ptr(group) != previous_state.groups.get_ptr(group))
+            return std::nullopt;
+    }
+
+    auto state = previous_next;
+    for (const auto& well : diff->wells)
+        state.wells.update(well, current.wells);
+
+    for (const auto& group : diff->groups)
+        state.groups.update(group, current.groups);
+
+    return state;
+}
+
+} // namespace Opm
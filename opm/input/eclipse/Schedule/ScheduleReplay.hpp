@@ -0,0 +1,71 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef SCHEDULE_REPLAY_HPP
+#define SCHEDULE_REPLAY_HPP
+
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Opm {
+
+class ScheduleBlock;
+
+/// Reuse of the snapshots computed before an action was applied, when the
+/// remaining report steps of the Schedule section are processed again.
+///
+/// The snapshot of a report step is taken from the previous snapshots
+/// when the state it is derived from does not differ from the previous
+/// one, or only differs in individual wells and groups which none of the
+/// keywords of the report step refer to.  All other report steps must be
+/// processed from the keywords as usual, as must report steps with WELPI,
+/// WELSEGS or COMPSEGS keywords.
+class ScheduleReplay
+{
+public:
+    /// \param first_step First report step which is processed again.
+    ///
+    /// \param previous Snapshots from before the action was applied, for
+    ///        report steps first_step - 1 and later.
+    ScheduleReplay(std::size_t first_step, std::vector<ScheduleState> previous);
+
+    /// Snapshot of a report step which was not affected by the action.
+    ///
+    /// \param report_step Report step which is about to be processed.
+    ///
+    /// \param block Keywords of the report step.
+    ///
+    /// \param current Final snapshot of the preceding report step.
+    ///
+    /// \return Snapshot of report_step, or nullopt if the report step must
+    ///         be processed from its keywords.
+    std::optional<ScheduleState> reuse(std::size_t report_step,
+                                       const ScheduleBlock& block,
+                                       const ScheduleState& current) const;
+
+private:
+    std::size_t first_step_;
+    std::vector<ScheduleState> previous_;
+};
+
+} // namespace Opm
+
+#endif // SCHEDULE_REPLAY_HPP
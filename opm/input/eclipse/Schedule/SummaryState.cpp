@@ -26,7 +26,9 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
@@ -36,6 +38,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -168,6 +171,31 @@ namespace {
         return l;
     }
 
+    template <class Index>
+    bool equal_values(const std::vector<double>& slots1, const Index& index1,
+                      const std::vector<double>& slots2, const Index& index2)
+    {
+        // Compare the values, not the slot numbers, as these depend on the
+        // order in which the entries were created.
+        if (index1.size() != index2.size())
+            return false;
+
+        for (const auto& [key, slot1] : index1) {
+            auto pos2 = index2.find(key);
+            if (pos2 == index2.end())
+                return false;
+
+            if constexpr (std::is_same_v<typename Index::mapped_type, std::size_t>) {
+                if (slots1[slot1] != slots2[pos2->second])
+                    return false;
+            }
+            else if (! equal_values(slots1, slot1, slots2, pos2->second))
+                return false;
+        }
+
+        return true;
+    }
+
     std::string normalise_region_set_name(const std::string& regSet)
     {
         if (regSet.empty()) {
@@ -209,10 +237,18 @@ namespace {
 namespace Opm
 {
 
+    SummaryState::VarHandle::VarHandle(const std::string& wgname,
+                                       const std::string& var)
+        : wgname_   { wgname }
+        , var_      { var }
+        , is_total_ { is_total(var) }
+    {}
+
     SummaryState::SummaryState(const time_point sim_start_arg,
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
         , udq_undefined { udqUndefined }
+        , layout_id     { next_layout_id() }
     {
         this->update_elapsed(0);
     }
@@ -222,13 +258,97 @@ namespace Opm
                          std::numeric_limits<double>::lowest() }
     {}
 
+    std::uint64_t SummaryState::next_layout_id()
+    {
+        // Zero is never used, so that new handles are always unbound.
+        static std::atomic<std::uint64_t> counter{0};
+        return ++counter;
+    }
+
+    std::size_t SummaryState::slot(std::unordered_map<std::string, std::size_t>& index,
+                                   const std::string& key)
+    {
+        auto [pos, inserted] = index.try_emplace(key, this->slots.size());
+        if (inserted) {
+            this->slots.push_back(0.0);
+            this->layout_id = next_layout_id();
+        }
+
+        return pos->second;
+    }
+
+    void SummaryState::bind(const VarHandle& handle,
+                            std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& wg_values,
+                            std::set<std::string>& wg_names,
+                            std::optional<std::vector<std::string>>& wg_name_cache)
+    {
+        const auto key_slot = this->slot(this->values, fmt::format("{}:{}", handle.var_, handle.wgname_));
+        const auto var_slot = this->slot(wg_values[handle.var_], handle.wgname_);
+
+        if (wg_names.insert(handle.wgname_).second) {
+            wg_name_cache.reset();
+        }
+
+        handle.layout_ = this->layout_id;
+        handle.key_slot_ = key_slot;
+        handle.var_slot_ = var_slot;
+    }
+
+    bool SummaryState::bind(const VarHandle& handle,
+                            const std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& wg_values) const
+    {
+        if (handle.layout_ == this->layout_id) {
+            return true;
+        }
+
+        auto varPos = wg_values.find(handle.var_);
+        if (varPos == wg_values.end()) {
+            return false;
+        }
+
+        auto wgPos = varPos->second.find(handle.wgname_);
+        if (wgPos == varPos->second.end()) {
+            return false;
+        }
+
+        auto keyPos = this->values.find(fmt::format("{}:{}", handle.var_, handle.wgname_));
+        if (keyPos == this->values.end()) {
+            return false;
+        }
+
+        handle.layout_ = this->layout_id;
+        handle.key_slot_ = keyPos->second;
+        handle.var_slot_ = wgPos->second;
+        return true;
+    }
+
+    void SummaryState::update_slots(const VarHandle& handle, const double value)
+    {
+        auto& val_ref  = this->slots[handle.key_slot_];
+        auto& wgval_ref = this->slots[handle.var_slot_];
+
+        if (handle.is_total_) {
+            val_ref   += value;
+            wgval_ref += value;
+        }
+        else {
+            val_ref = wgval_ref = value;
+        }
+    }
+
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        const auto key_slot = this->slot(this->values, key);
+        this->slots[key_slot] = value;
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        if (this->values.erase(key) == 0) {
+            return false;
+        }
+
+        this->layout_id = next_layout_id();
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -341,7 +461,7 @@ namespace Opm
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
+        auto& val_ref = this->slots[this->slot(this->values, key)];
 
         if (is_total(key)) {
             val_ref += value;
@@ -355,42 +475,34 @@ namespace Opm
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
+        this->update_well_var(WellVarHandle { well, var }, value);
+    }
 
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
+    void SummaryState::update_well_var(const WellVarHandle& handle,
+                                       const double         value)
+    {
+        if (handle.layout_ != this->layout_id) {
+            this->bind(handle, this->well_values, this->m_wells, this->well_names);
         }
 
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update_slots(handle, value);
     }
 
     void SummaryState::update_group_var(const std::string& group,
                                         const std::string& var,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
+        this->update_group_var(GroupVarHandle { group, var }, value);
+    }
 
-        if (is_total(var)) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
+    void SummaryState::update_group_var(const GroupVarHandle& handle,
+                                        const double          value)
+    {
+        if (handle.layout_ != this->layout_id) {
+            this->bind(handle, this->group_values, this->m_groups, this->group_names);
         }
 
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update_slots(handle, value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -430,7 +542,7 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, global_index)];
+        auto& val_ref  = this->slots[this->slot(this->values, fmt::format("{}:{}:{}", var, well, global_index))];
         auto& cval_ref = this->conn_values[var][well][global_index];
 
         if (is_total(var)) {
@@ -447,7 +559,7 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
+        auto& val_ref  = this->slots[this->slot(this->values, fmt::format("{}:{}:{}", var, well, segment))];
         auto& sval_ref = this->segment_values[var][well][segment];
 
         if (is_total(var)) {
@@ -466,7 +578,7 @@ namespace Opm
     {
         const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
 
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
+        auto& val_ref  = this->slots[this->slot(this->values, region_key(regKw, regSet, region))];
         auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
 
         if (is_total(regKw)) {
@@ -482,7 +594,7 @@ namespace Opm
     {
         auto iter = this->values.find(key);
         if (iter != this->values.end()) {
-            return iter->second;
+            return this->slots[iter->second];
         }
 
         if (is_udq(key)) {
@@ -499,7 +611,7 @@ namespace Opm
     {
         auto iter = this->values.find(key);
         if (iter != this->values.end()) {
-            return iter->second;
+            return this->slots[iter->second];
         }
 
         if (is_udq(key)) {
@@ -544,7 +656,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return wellPos->second;
+        return this->slots[wellPos->second];
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -577,7 +689,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return groupPos->second;
+        return this->slots[groupPos->second];
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -715,7 +827,7 @@ namespace Opm
         auto wellPos = varPos->second.find(well);
         return (wellPos == varPos->second.end())
             ? fallback
-            : wellPos->second;
+            : this->slots[wellPos->second];
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -734,7 +846,37 @@ namespace Opm
         auto groupPos = varPos->second.find(group);
         return (groupPos == varPos->second.end())
             ? fallback
-            : groupPos->second;
+            : this->slots[groupPos->second];
+    }
+
+    double SummaryState::get_well_var(const WellVarHandle& handle) const
+    {
+        return this->bind(handle, this->well_values)
+            ? this->slots[handle.var_slot_]
+            : this->get_well_var(handle.wgname_, handle.var_);
+    }
+
+    double SummaryState::get_group_var(const GroupVarHandle& handle) const
+    {
+        return this->bind(handle, this->group_values)
+            ? this->slots[handle.var_slot_]
+            : this->get_group_var(handle.wgname_, handle.var_);
+    }
+
+    double SummaryState::get_well_var(const WellVarHandle& handle,
+                                      const double         default_value) const
+    {
+        return this->bind(handle, this->well_values)
+            ? this->slots[handle.var_slot_]
+            : this->get_well_var(handle.wgname_, handle.var_, default_value);
+    }
+
+    double SummaryState::get_group_var(const GroupVarHandle& handle,
+                                       const double          default_value) const
+    {
+        return this->bind(handle, this->group_values)
+            ? this->slots[handle.var_slot_]
+            : this->get_group_var(handle.wgname_, handle.var_, default_value);
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -809,21 +951,54 @@ namespace Opm
 
     void SummaryState::append(const SummaryState& buffer)
     {
+        // Build a new, compact slot array.  Entries of this object which
+        // are replaced by those of the buffer are dropped.
+        auto new_slots = std::vector<double>{};
+        auto copy = [&new_slots](const auto& index, const std::vector<double>& src)
+        {
+            auto new_index = std::unordered_map<std::string, std::size_t>{};
+            for (const auto& [key, slot_idx] : index) {
+                new_index.emplace(key, new_slots.size());
+                new_slots.push_back(src[slot_idx]);
+            }
+
+            return new_index;
+        };
+
+        auto new_values = copy(buffer.values, buffer.slots);
+
+        auto new_well_values = decltype(this->well_values){};
+        for (const auto& [var, vals] : this->well_values) {
+            if (buffer.well_values.count(var) == 0) {
+                new_well_values.emplace(var, copy(vals, this->slots));
+            }
+        }
+        for (const auto& [var, vals] : buffer.well_values) {
+            new_well_values.emplace(var, copy(vals, buffer.slots));
+        }
+
+        auto new_group_values = decltype(this->group_values){};
+        for (const auto& [var, vals] : this->group_values) {
+            if (buffer.group_values.count(var) == 0) {
+                new_group_values.emplace(var, copy(vals, this->slots));
+            }
+        }
+        for (const auto& [var, vals] : buffer.group_values) {
+            new_group_values.emplace(var, copy(vals, buffer.slots));
+        }
+
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
+        this->slots = std::move(new_slots);
+        this->values = std::move(new_values);
+        this->well_values = std::move(new_well_values);
+        this->group_values = std::move(new_group_values);
+        this->layout_id = next_layout_id();
         this->well_names.reset();
         this->group_names.reset();
 
         this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
-        }
-
         this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
-        }
 
         for (const auto& [var, vals] : buffer.conn_values) {
             this->conn_values.insert_or_assign(var, vals);
@@ -836,12 +1011,12 @@ namespace Opm
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this->values.begin(), this->slots };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this->values.end(), this->slots };
     }
 
     std::size_t SummaryState::num_wells() const
@@ -859,11 +1034,11 @@ namespace Opm
         return (this->sim_start == other.sim_start)
             && (this->udq_undefined == other.udq_undefined)
             && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
+            && equal_values(this->slots, this->values, other.slots, other.values)
+            && equal_values(this->slots, this->well_values, other.slots, other.well_values)
             && (this->m_wells == other.m_wells)
             && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
+            && equal_values(this->slots, this->group_values, other.slots, other.group_values)
             && (this->m_groups == other.m_groups)
             && (this->groups() == other.groups())
             && (this->conn_values == other.conn_values)
@@ -877,11 +1052,11 @@ namespace Opm
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
 
         st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
+        st.set("test1", 2.0);
+        st.update_well_var("test3", "test2", 3.0);
         st.m_wells = {"test4"};
         st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
+        st.update_group_var("test7", "test6", 4.0);
         st.m_groups = {"test7"};
         st.group_names = {"test8"},
         st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
@@ -23,12 +23,15 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -65,13 +68,94 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// All values are stored in a contiguous array of slots, and the string keyed
+// structures only map keys to slot indices.  Code which updates or reads the
+// same well or group variables repeatedly, e.g., at every report step, may
+// create a WellVarHandle or GroupVarHandle once and use that instead of the
+// names.  The handle remembers the slots of the variable, so subsequent
+// accesses do not need to hash or format any strings:
+//
+//     const auto wwct = SummaryState::WellVarHandle { "OPX", "WWCT" };
+//     st.update_well_var(wwct, 0.75);
+//     st.get_well_var(wwct) => 0.75
 
 namespace Opm {
 
 class SummaryState
 {
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    // Cached location of a single well or group level variable.  A handle
+    // is bound to the storage layout of the SummaryState object it was last
+    // used with, and is transparently rebound by name whenever it is used
+    // with an object of a different layout.  Copies of a SummaryState share
+    // the layout of the original until either of them creates new entries.
+    // Handles are cheap to copy, but must not be shared between threads.
+    class VarHandle
+    {
+    public:
+        VarHandle(const std::string& wgname, const std::string& var);
+
+        const std::string& name() const { return this->wgname_; }
+        const std::string& variable() const { return this->var_; }
+
+    private:
+        friend class SummaryState;
+
+        std::string wgname_{};
+        std::string var_{};
+        bool is_total_{false};
+
+        mutable std::uint64_t layout_{0};
+        mutable std::size_t key_slot_{0};
+        mutable std::size_t var_slot_{0};
+    };
+
+    class WellVarHandle : public VarHandle
+    {
+    public:
+        using VarHandle::VarHandle;
+    };
+
+    class GroupVarHandle : public VarHandle
+    {
+    public:
+        using VarHandle::VarHandle;
+    };
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const std::string&, double>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        struct pointer
+        {
+            value_type value;
+            const value_type* operator->() const { return &this->value; }
+        };
+
+        const_iterator(std::unordered_map<std::string, std::size_t>::const_iterator pos,
+                       const std::vector<double>& slots)
+            : pos_  { pos }
+            , slots_{ &slots }
+        {}
+
+        reference operator*() const { return { this->pos_->first, (*this->slots_)[this->pos_->second] }; }
+        pointer operator->() const { return { **this }; }
+
+        const_iterator& operator++() { ++this->pos_; return *this; }
+        const_iterator operator++(int) { auto i = *this; ++this->pos_; return i; }
+
+        bool operator==(const const_iterator& that) const { return this->pos_ == that.pos_; }
+        bool operator!=(const const_iterator& that) const { return this->pos_ != that.pos_; }
+
+    private:
+        std::unordered_map<std::string, std::size_t>::const_iterator pos_;
+        const std::vector<double>* slots_;
+    };
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -104,7 +188,9 @@ public:
 
     void update(const std::string& key, double value);
     void update_well_var(const std::string& well, const std::string& var, double value);
+    void update_well_var(const WellVarHandle& handle, double value);
     void update_group_var(const std::string& group, const std::string& var, double value);
+    void update_group_var(const GroupVarHandle& handle, double value);
     void update_elapsed(double delta);
     void update_udq(const UDQSet& udq_set);
     void update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value);
@@ -121,6 +207,10 @@ public:
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
     double get_well_var(const std::string& well, const std::string& var, double) const;
     double get_group_var(const std::string& group, const std::string& var, double) const;
+    double get_well_var(const WellVarHandle& handle) const;
+    double get_group_var(const GroupVarHandle& handle) const;
+    double get_well_var(const WellVarHandle& handle, double) const;
+    double get_group_var(const GroupVarHandle& handle, double) const;
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region, double) const;
@@ -142,6 +232,7 @@ public:
         serializer(sim_start);
         serializer(this->udq_undefined);
         serializer(elapsed);
+        serializer(slots);
         serializer(values);
         serializer(well_values);
         serializer(m_wells);
@@ -152,6 +243,9 @@ public:
         serializer(conn_values);
         serializer(segment_values);
         serializer(this->region_values);
+
+        // Handles bound to the layout before unpacking must be rebound.
+        this->layout_id = next_layout_id();
     }
 
     static SummaryState serializationTestObject();
@@ -160,15 +254,25 @@ private:
     time_point sim_start;
     double udq_undefined{};
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
+
+    // Values of all entries in 'values', 'well_values' and 'group_values'.
+    // The maps store indices into this array.  Slots are never reused or
+    // moved, so erased entries leave unused slots behind.
+    std::vector<double> slots{};
+
+    // Identifies the mapping from keys to slots.  Changed whenever entries
+    // are created or erased.
+    std::uint64_t layout_id{};
+
+    std::unordered_map<std::string, std::size_t> values;
 
     // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> well_values;
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
     // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> group_values;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
@@ -183,6 +287,21 @@ private:
     // First key is variable (e.g., ROIP), second key is region set (e.g.,
     // FIPNUM, FIPABC), and the third key is the one-based region number.
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+
+    static std::uint64_t next_layout_id();
+
+    std::size_t slot(std::unordered_map<std::string, std::size_t>& index,
+                     const std::string& key);
+
+    void bind(const VarHandle& handle,
+              std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& wg_values,
+              std::set<std::string>& wg_names,
+              std::optional<std::vector<std::string>>& wg_name_cache);
+
+    bool bind(const VarHandle& handle,
+              const std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& wg_values) const;
+
+    void update_slots(const VarHandle& handle, double value);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -21,6 +21,7 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/FileSystem.hpp>
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -408,6 +409,9 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
 
     nSpecFiles = static_cast<int>(smryArray.size());
+
+    for (const auto& smry : smryArray)
+        smspecFileList.push_back(std::get<0>(smry));
     nParamsSpecFile.resize(nSpecFiles, 0);
 
     // arrayPos std::vector of std::map, mapping position in summary file[n]
@@ -555,15 +559,23 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
         std::vector<ArrSourceEntry> arraySourceList;
 
-        for (std::string fileName : resultsFileList)
+        for (const std::string& fileName : resultsFileList)
         {
-            std::vector<std::tuple <std::string, std::uint64_t>> arrayList;
-            arrayList = this->getListOfArrays(fileName, formattedFiles[specInd]);
+            auto arrayList = this->getListOfArrays(fileName, formattedFiles[specInd]);
+
+            // A ministep is only complete once its PARAMS array is on disk
+            if (!arrayList.empty() && (std::get<0>(arrayList.back()) == "MINISTEP"))
+                arrayList.pop_back();
 
             for (size_t n = 0; n < arrayList.size(); n++) {
                 ArrSourceEntry  t1 = std::make_tuple(std::get<0>(arrayList[n]), fileName, n, std::get<1>(arrayList[n]));
                 arraySourceList.push_back(t1);
             }
+
+            if (specInd == 0) {
+                followFile = fileName;
+                followPos = arrayList.empty() ? 0 : std::get<2>(arrayList.back());
+            }
         }
 
         // loop through arrays and for each ministep, store data file, location of params table
@@ -573,7 +585,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
         //       else : MINISTEP and PARAMS
 
 
-        size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
+        size_t i = (!arraySourceList.empty() && (std::get<0>(arraySourceList[0]) == "SEQHDR")) ? 1 : 0 ;
 
         while  (i < arraySourceList.size()) {
 
@@ -623,6 +635,13 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
         fromReportStepNumber = toReportStepNumber;
 
+        if (specInd == 0) {
+            // The last ministep was registered as the end of a report step
+            // above.  follow() revisits that if more ministeps are appended.
+            followAtReportEnd = !arraySourceList.empty()
+                && (std::get<0>(arraySourceList.back()) == "PARAMS");
+        }
+
         specInd--;
 
         nTstep = timeStepList.size();
@@ -632,10 +651,13 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     m_io_opening += elapsed_seconds.count();
 }
 
-void ESmry::read_ministeps_from_disk()
+void ESmry::read_ministeps_from_disk(std::size_t firstStep)
 {
-    auto specInd = std::get<0>(miniStepList[0]);
-    auto dataFileIndex = std::get<1>(miniStepList[0]);
+    if (firstStep >= miniStepList.size())
+        return;
+
+    auto specInd = std::get<0>(miniStepList[firstStep]);
+    auto dataFileIndex = std::get<1>(miniStepList[firstStep]);
 
     std::fstream fileH;
 
@@ -646,7 +668,7 @@ void ESmry::read_ministeps_from_disk()
 
     int ministep_value;
 
-    for (size_t n = 0; n < miniStepList.size(); n++) {
+    for (size_t n = firstStep; n < miniStepList.size(); n++) {
 
         if (dataFileIndex != std::get<1>(miniStepList[n])) {
             fileH.close();
@@ -680,7 +702,7 @@ void ESmry::read_ministeps_from_disk()
 bool ESmry::all_steps_available()
 {
     if (mini_steps.size() == 0)
-        this->read_ministeps_from_disk();
+        this->read_ministeps_from_disk(0);
 
     for (size_t n = 1; n < mini_steps.size(); n++)
         if ((mini_steps[n] - mini_steps[n-1]) > 1)
@@ -730,13 +752,38 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
             keywIndVect.push_back(it->second);
     }
 
+    if (columnCache) {
+        for (auto ind : keywIndVect) {
+            vectorData[ind] = columnCache->view<float>(fmt::format("V{}", ind)).toVector();
+            vectorLoaded[ind] = true;
+        }
+
+        std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+        m_io_loading += elapsed_seconds.count();
+        return;
+    }
+
     for (auto ind : keywIndVect)
         vectorData[ind].reserve(nTstep);
 
+    this->loadTimeSteps(keywIndVect, 0);
+
+    for (const auto& ind : keywIndVect)
+        vectorLoaded[ind] = true;
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
+
+void ESmry::loadTimeSteps(const std::vector<int>& keywIndVect, std::size_t firstStep) const
+{
+    if ((firstStep >= timeStepList.size()) || keywIndVect.empty())
+        return;
+
     std::fstream fileH;
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
+    auto specInd = std::get<0>(timeStepList[firstStep]);
+    auto dataFileIndex = std::get<1>(timeStepList[firstStep]);
     std::uint64_t blockSize_f;
 
     {
@@ -751,11 +798,11 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
     else
         fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
 
-    for (const auto& ministep : timeStepList) {
-        if (dataFileIndex != std::get<1>(ministep)) {
+    for (auto ministep = timeStepList.begin() + firstStep; ministep != timeStepList.end(); ++ministep) {
+        if (dataFileIndex != std::get<1>(*ministep)) {
             fileH.close();
-            specInd = std::get<0>(ministep);
-            dataFileIndex = std::get<1>(ministep);
+            specInd = std::get<0>(*ministep);
+            dataFileIndex = std::get<1>(*ministep);
 
             if (formattedFiles[specInd])
                 fileH.open(dataFileList[dataFileIndex], std::ios::in );
@@ -763,7 +810,7 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                 fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
         }
 
-        const auto stepFilePos = std::get<2>(ministep);;
+        const auto stepFilePos = std::get<2>(*ministep);
 
         for (auto ind : keywIndVect) {
             auto it = arrayPos[specInd].find(ind);
@@ -810,12 +857,6 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
     }
 
     fileH.close();
-
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
-
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_loading += elapsed_seconds.count();
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -842,6 +883,11 @@ std::vector<int> ESmry::makeKeywPosVector(int specInd) const
 
 void ESmry::loadData() const
 {
+    if (columnCache) {
+        this->loadData(keyword);
+        return;
+    }
+
     std::fstream fileH;
 
     auto specInd = std::get<0>(timeStepList[0]);
@@ -950,10 +996,124 @@ void ESmry::loadData() const
 }
 
 
-std::vector<std::tuple <std::string, uint64_t>>
-ESmry::getListOfArrays(const std::string& filename, bool formatted)
+std::size_t ESmry::follow()
 {
-    std::vector<std::tuple <std::string, uint64_t>> resultVect;
+    if (followFile.empty())
+        return 0;
+
+    auto start = std::chrono::system_clock::now();
+
+    const bool formatted = formattedFiles[0];
+
+    // Rest of the file we stopped in, and for non-unified output any
+    // summary files created since then.
+    std::vector<std::string> fileList { followFile };
+
+    const auto followExt = std::filesystem::path(followFile).extension();
+    if ((followExt != ".UNSMRY") && (followExt != ".FUNSMRY")) {
+        const std::filesystem::path smspecFile(smspecFileList[0]);
+
+        for (const auto& fileName : checkForMultipleResultFiles(smspecFile.parent_path() / smspecFile.stem(), formatted))
+            if (fileName > followFile)
+                fileList.push_back(fileName);
+    }
+
+    std::vector<ArrSourceEntry> arraySourceList;
+    std::vector<uint64_t> arrayEndList;
+
+    for (size_t f = 0; f < fileList.size(); f++) {
+        const auto arrayList = this->getListOfArrays(fileList[f], formatted, f == 0 ? followPos : 0);
+
+        for (size_t n = 0; n < arrayList.size(); n++) {
+            arraySourceList.push_back(std::make_tuple(std::get<0>(arrayList[n]), fileList[f], n, std::get<1>(arrayList[n])));
+            arrayEndList.push_back(std::get<2>(arrayList[n]));
+        }
+    }
+
+    const size_t firstNewStep = timeStepList.size();
+
+    size_t i = 0;
+
+    while (i < arraySourceList.size()) {
+
+        if (std::get<0>(arraySourceList[i]) == "SEQHDR") {
+            // Confirms that the previous ministep ended a report step
+            followAtReportEnd = false;
+        }
+        else if (std::get<0>(arraySourceList[i]) == "MINISTEP") {
+
+            // PARAMS not written yet, pick up this ministep next time
+            if (i + 1 == arraySourceList.size())
+                break;
+
+            if (std::get<0>(arraySourceList[i+1]) != "PARAMS") {
+                std::string message="Reading summary file, expecting keyword PARAMS, found '" + std::get<0>(arraySourceList[i+1]) + "'";
+                throw std::invalid_argument(message);
+            }
+
+            if (followAtReportEnd) {
+                seqIndex.pop_back();
+                followAtReportEnd = false;
+            }
+
+            const auto& fileName = std::get<1>(arraySourceList[i+1]);
+            auto it = std::find(dataFileList.begin(), dataFileList.end(), fileName);
+
+            if (it == dataFileList.end())
+                it = dataFileList.insert(dataFileList.end(), fileName);
+
+            const int dataFileIndex = static_cast<int>(std::distance(dataFileList.begin(), it));
+
+            miniStepList.push_back(std::make_tuple(0, dataFileIndex, std::get<3>(arraySourceList[i])));
+            timeStepList.push_back(std::make_tuple(0, dataFileIndex, std::get<3>(arraySourceList[i+1])));
+
+            // Treated as the end of a report step until more data shows up
+            seqIndex.push_back(static_cast<int>(timeStepList.size()) - 1);
+            followAtReportEnd = true;
+
+            i++;
+        }
+        else {
+            std::string message="Reading summary file, expecting keyword MINISTEP, found '" + std::get<0>(arraySourceList[i]) + "'";
+            throw std::invalid_argument(message);
+        }
+
+        followFile = std::get<1>(arraySourceList[i]);
+        followPos = arrayEndList[i];
+
+        i++;
+    }
+
+    nTstep = timeStepList.size();
+
+    const size_t numNewSteps = nTstep - firstNewStep;
+
+    if (numNewSteps > 0) {
+        // The transposed cache no longer covers all time steps
+        columnCache.reset();
+
+        std::vector<int> loadedVect;
+
+        for (size_t n = 0; n < nVect; n++)
+            if (vectorLoaded[n])
+                loadedVect.push_back(static_cast<int>(n));
+
+        this->loadTimeSteps(loadedVect, firstNewStep);
+
+        if (!mini_steps.empty())
+            this->read_ministeps_from_disk(firstNewStep);
+    }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return numNewSteps;
+}
+
+std::vector<std::tuple <std::string, uint64_t, uint64_t>>
+ESmry::getListOfArrays(const std::string& filename, bool formatted, uint64_t startPos) const
+{
+    std::vector<std::tuple <std::string, uint64_t, uint64_t>> resultVect;
 
     FILE *ptr;
     char arrName[9];
@@ -966,12 +1126,26 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
     else
         ptr = fopen(filename.c_str(),"rb");  // r for read, b for binary
 
-    bool endOfFile = false;
+    if (ptr == nullptr)
+        throw std::runtime_error("Could not open summary data file " + filename);
+
+    fseek(ptr, 0, SEEK_END);
+    const uint64_t fileSize = static_cast<uint64_t>(ftell(ptr));
+
+    // ' 'NAME    '     NUM 'TYPE'' + newline, or binary
+    // marker + name + size + type + marker
+    const uint64_t headerSize = formatted ? 31 : 24;
+
+    uint64_t arrayStart = startPos;
 
-    while (!endOfFile)
+    // The simulator may still be writing the file.  Arrays which are not
+    // yet completely on disk are left for a later call to follow().
+    while (arrayStart + headerSize <= fileSize)
     {
         Opm::EclIO::eclArrType arrType;
 
+        fseek(ptr, static_cast<long int>(arrayStart), SEEK_SET);
+
         if (formatted)
         {
             fseek(ptr, 2, SEEK_CUR);
@@ -1027,26 +1201,22 @@ ESmry::getListOfArrays(const std::string& filename, bool formatted)
             }
         }
 
-        uint64_t filePos = static_cast<uint64_t>(ftell(ptr));
-
-        std::tuple <std::string, uint64_t> t1;
-        t1 = std::make_tuple(Opm::EclIO::trimr(arrName), filePos);
-        resultVect.push_back(t1);
+        uint64_t filePos = arrayStart + headerSize;
+        uint64_t arrayEnd = filePos;
 
         if (num > 0) {
-            if (formatted) {
-                uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            } else {
-                uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, 4);
-                fseek(ptr, static_cast<long int>(sizeOfNextArray), SEEK_CUR);
-            }
+            if (formatted)
+                arrayEnd += sizeOnDiskFormatted(num, arrType, 4);
+            else
+                arrayEnd += sizeOnDiskBinary(num, arrType, 4);
         }
 
-        if (fgetc(ptr) == EOF)
-            endOfFile = true;
-        else
-            fseek(ptr, -1, SEEK_CUR);
+        if (arrayEnd > fileSize)
+            break;
+
+        resultVect.emplace_back(Opm::EclIO::trimr(arrName), filePos, arrayEnd);
+
+        arrayStart = arrayEnd;
     }
 
     fclose(ptr);
@@ -1064,7 +1234,7 @@ bool ESmry::make_esmry_file()
         OPM_THROW(std::invalid_argument, "creating esmry file only possible when loadBaseRunData=false");
 
     if (mini_steps.size() == 0)
-        this->read_ministeps_from_disk();
+        this->read_ministeps_from_disk(0);
 
     const std::filesystem::path path = inputFileName.parent_path();
     const std::filesystem::path rootName = inputFileName.stem();
@@ -1131,6 +1301,127 @@ bool ESmry::make_esmry_file()
     }
 }
 
+std::filesystem::path ESmry::columnCacheFile() const
+{
+    std::filesystem::path cacheFile = inputFileName.parent_path() / inputFileName.stem();
+    cacheFile += fromSingleRun ? ".SMRYCACHE" : ".SMRYCACHE_BASE";
+
+    return cacheFile;
+}
+
+std::vector<double> ESmry::columnCacheSignature() const
+{
+    // Size and modification time of every file the vectors are loaded
+    // from.  Stored as doubles which represent file sizes exactly, and
+    // modification times deterministically.
+
+    std::vector<double> signature;
+    signature.reserve(2*(smspecFileList.size() + dataFileList.size()) + 1);
+
+    signature.push_back(static_cast<double>(smspecFileList.size() + dataFileList.size()));
+
+    auto add_file = [&signature](const std::string& fileName)
+    {
+        const auto mtime = std::filesystem::last_write_time(fileName);
+        signature.push_back(static_cast<double>(std::filesystem::file_size(fileName)));
+        signature.push_back(static_cast<double>(mtime.time_since_epoch().count()));
+    };
+
+    std::for_each(smspecFileList.begin(), smspecFileList.end(), add_file);
+    std::for_each(dataFileList.begin(), dataFileList.end(), add_file);
+
+    return signature;
+}
+
+bool ESmry::open_column_cache(const std::filesystem::path& cacheFile,
+                              const std::vector<double>& signature)
+{
+    if (!std::filesystem::exists(cacheFile))
+        return false;
+
+    try {
+        auto cache = std::make_shared<EclFile>(cacheFile.string());
+
+        if (cache->formattedInput() || !cache->hasKey("SIGNATUR") ||
+            !cache->hasKey("KEYCHECK") || !cache->hasKey("NTSTEP"))
+            return false;
+
+        if ((cache->get<double>("SIGNATUR") != signature) ||
+            (cache->get<std::string>("KEYCHECK") != keyword) ||
+            (cache->get<int>("NTSTEP") != std::vector<int> { static_cast<int>(nTstep) }))
+            return false;
+
+        if (cache->size() != 3 + nVect)
+            return false;
+
+        cache->enableMemoryMapping();
+        columnCache = std::move(cache);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+
+    return true;
+}
+
+bool ESmry::write_column_cache(const std::filesystem::path& cacheFile,
+                               const std::vector<double>& signature) const
+{
+    // Write to a temporary file which is then renamed, such that
+    // concurrent readers never observe a partially written cache.
+
+    auto tmpFile = cacheFile;
+    tmpFile += Opm::unique_path(".%%%%%%%%");
+
+    try {
+        {
+            Opm::EclIO::EclOutput outFile(tmpFile.string(), false, std::ios::out);
+
+            outFile.write<double>("SIGNATUR", signature);
+            outFile.write("KEYCHECK", keyword);
+            outFile.write<int>("NTSTEP", { static_cast<int>(nTstep) });
+
+            for (size_t n = 0; n < vectorData.size(); n++)
+                outFile.write<float>(fmt::format("V{}", n), vectorData[n]);
+        }
+
+        std::filesystem::rename(tmpFile, cacheFile);
+    }
+    catch (const std::exception&) {
+        std::error_code ec;
+        std::filesystem::remove(tmpFile, ec);
+        return false;
+    }
+
+    return true;
+}
+
+bool ESmry::use_column_cache()
+{
+    if (columnCache)
+        return true;
+
+    std::vector<double> signature;
+
+    try {
+        signature = this->columnCacheSignature();
+    }
+    catch (const std::filesystem::filesystem_error&) {
+        return false;
+    }
+
+    const auto cacheFile = this->columnCacheFile();
+
+    if (this->open_column_cache(cacheFile, signature))
+        return true;
+
+    // Missing or stale cache.  Load all vectors in a single pass over the
+    // summary files and store them transposed.
+    this->loadData();
+
+    return this->write_column_cache(cacheFile, signature);
+}
+
 std::vector<std::string> ESmry::checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const {
 
     std::vector<std::string> fileList;
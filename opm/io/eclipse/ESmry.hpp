@@ -23,6 +23,7 @@
 #include <chrono>
 #include <filesystem>
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,6 +35,8 @@
 
 namespace Opm { namespace EclIO {
 
+class EclFile;
+
 using ArrSourceEntry = std::tuple<std::string, std::string, int, uint64_t>;
 using TimeStepEntry = std::tuple<int, int, uint64_t>;
 using RstEntry = std::tuple<std::string, int>;
@@ -62,6 +65,22 @@ public:
 
     bool make_esmry_file();
 
+    // Pick up ministeps which the simulator has appended to the summary
+    // data files of this run since construction or since the previous
+    // call.  Only the new part of the files is scanned, and the new
+    // values are appended to the vectors already loaded.  Returns the
+    // number of new time steps.
+    std::size_t follow();
+
+    // Load vectors from a transposed cache file (<root>.SMRYCACHE, or
+    // <root>.SMRYCACHE_BASE when base run data is included) holding one
+    // contiguous record per vector.  The cache is created from the summary
+    // files on first use and rebuilt whenever the size or modification
+    // time of any of the SMSPEC or summary data files has changed.
+    // Returns false, and leaves loading unchanged, if the cache could
+    // neither be used nor written.
+    bool use_column_cache();
+
     time_point startdate() const { return tp_startdat; }
     const std::vector<int>& start_v() const { return start_vect; }
 
@@ -92,7 +111,9 @@ private:
     size_t nVect, nTstep;
 
     std::vector<bool> formattedFiles;
+    std::vector<std::string> smspecFileList;
     std::vector<std::string> dataFileList;
+    std::shared_ptr<EclFile> columnCache;
     mutable std::vector<std::vector<float>> vectorData;
     mutable std::vector<bool> vectorLoaded;
     std::vector<TimeStepEntry> timeStepList;
@@ -107,6 +128,10 @@ private:
     std::vector<int> seqIndex;
     std::vector<int> mini_steps;
 
+    std::string followFile;
+    uint64_t followPos = 0;
+    bool followAtReportEnd = false;
+
     void ijk_from_global_index(int glob, int &i, int &j, int &k) const;
 
     std::vector<SummaryNode> summaryNodes;
@@ -151,13 +176,22 @@ private:
         return result;
     }
 
-    std::vector<std::tuple <std::string, uint64_t>>
-    getListOfArrays(const std::string& filename, bool formatted);
+    std::vector<std::tuple <std::string, uint64_t, uint64_t>>
+    getListOfArrays(const std::string& filename, bool formatted, uint64_t startPos = 0) const;
+
+    void loadTimeSteps(const std::vector<int>& keywIndVect, std::size_t firstStep) const;
 
     std::vector<int> makeKeywPosVector(int speInd) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
 
-    void read_ministeps_from_disk();
+    std::filesystem::path columnCacheFile() const;
+    std::vector<double> columnCacheSignature() const;
+    bool open_column_cache(const std::filesystem::path& cacheFile,
+                           const std::vector<double>& signature);
+    bool write_column_cache(const std::filesystem::path& cacheFile,
+                            const std::vector<double>& signature) const;
+
+    void read_ministeps_from_disk(std::size_t firstStep);
     int read_ministep_formatted(std::fstream& fileH);
 };
 
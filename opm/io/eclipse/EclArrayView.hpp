@@ -0,0 +1,246 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+namespace detail {
+
+    template <typename Raw>
+    Raw fromBigEndian(Raw value)
+    {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        return value;
+#else
+        if constexpr (sizeof(Raw) == 8) {
+            return __builtin_bswap64(value);
+        } else {
+            return __builtin_bswap32(value);
+        }
+#endif
+    }
+
+    template <typename T>
+    using RawType = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+
+    template <typename T>
+    T decodeElement(const char* src)
+    {
+        RawType<T> raw;
+        std::memcpy(&raw, src, sizeof raw);
+        raw = fromBigEndian(raw);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            if ((raw == true_value_ecl) || (raw == true_value_ix)) {
+                return true;
+            }
+            if (raw != false_value) {
+                throw std::runtime_error("Error reading logi value");
+            }
+            return false;
+        } else {
+            T value;
+            std::memcpy(&value, &raw, sizeof value);
+            return value;
+        }
+    }
+
+    // Decode 'num' consecutive big-endian elements.  The loop has no
+    // cross-iteration dependencies and is vectorised by the compiler for
+    // the arithmetic types.
+    template <typename T>
+    void decodeBlock(const char* src, std::size_t num, T* dest)
+    {
+        for (std::size_t i = 0; i < num; ++i) {
+            dest[i] = decodeElement<T>(src + i*sizeof(RawType<T>));
+        }
+    }
+
+} // namespace detail
+
+/// Lazy, typed view of a single array in a memory mapped, unformatted
+/// ECLIPSE file.
+///
+/// Elements are decoded from the mapped Fortran records on access, so
+/// only the pages that are actually touched are read from disk.  The view
+/// keeps the underlying mapping alive.  Supported element types are int,
+/// float, double and bool.
+template <typename T>
+class EclArrayView
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+        const_iterator(const EclArrayView* view, size_type i)
+            : view_(view), i_(i)
+        {}
+
+        T operator*() const { return (*this->view_)[this->i_]; }
+
+        const_iterator& operator++() { ++this->i_; return *this; }
+        const_iterator operator++(int) { auto tmp = *this; ++this->i_; return tmp; }
+
+        bool operator==(const const_iterator& rhs) const { return this->i_ == rhs.i_; }
+        bool operator!=(const const_iterator& rhs) const { return this->i_ != rhs.i_; }
+
+    private:
+        const EclArrayView* view_ = nullptr;
+        size_type i_ = 0;
+    };
+
+    EclArrayView() = default;
+
+    /// \param[in] file Mapping containing the array.
+    /// \param[in] record Start of the first data record, i.e. the
+    ///    position of the leading record marker.
+    /// \param[in] size Number of elements in array.
+    /// \param[in] blockLength Maximum number of elements per record.
+    EclArrayView(std::shared_ptr<const MappedFile> file,
+                 const char* record, size_type size, size_type blockLength)
+        : file_(std::move(file))
+        , record_(record)
+        , size_(size)
+        , blockLength_(blockLength)
+    {}
+
+    size_type size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    T operator[](size_type i) const
+    {
+        return detail::decodeElement<T>(this->address(i));
+    }
+
+    T at(size_type i) const
+    {
+        if (i >= this->size_) {
+            throw std::out_of_range("Array view index " + std::to_string(i)
+                                    + " out of range");
+        }
+        return (*this)[i];
+    }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+
+    /// Decode all elements into 'dest', which must have room for size()
+    /// elements.  Record markers are validated along the way.
+    void copyTo(T* dest) const
+    {
+        constexpr size_type markerSize = sizeof(std::uint32_t);
+        constexpr size_type elemSize = sizeof(detail::RawType<T>);
+
+        this->file_->willNeed(this->record_ - this->file_->data(),
+                              this->diskSize());
+
+        const char* rec = this->record_;
+        size_type rest = this->size_;
+
+        while (rest > 0) {
+            const size_type num = std::min(rest, this->blockLength_);
+            const auto head = detail::decodeElement<int>(rec);
+            const auto tail = detail::decodeElement<int>(rec + markerSize + num*elemSize);
+
+            if ((head < 0) || (static_cast<size_type>(head) != num*elemSize) || (head != tail)) {
+                throw std::runtime_error("Error reading binary data, inconsistent record markers");
+            }
+
+            detail::decodeBlock(rec + markerSize, num, dest);
+
+            dest += num;
+            rest -= num;
+            rec += num*elemSize + 2*markerSize;
+        }
+    }
+
+    std::vector<T> toVector() const
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            std::vector<T> result;
+            result.reserve(this->size_);
+            for (size_type i = 0; i < this->size_; ++i) {
+                result.push_back((*this)[i]);
+            }
+            return result;
+        } else {
+            std::vector<T> result(this->size_);
+            this->copyTo(result.data());
+            return result;
+        }
+    }
+
+private:
+    std::shared_ptr<const MappedFile> file_{};
+    const char* record_ = nullptr;
+    size_type size_ = 0;
+    size_type blockLength_ = 1;
+
+    const char* address(size_type i) const
+    {
+        constexpr size_type markerSize = sizeof(std::uint32_t);
+        constexpr size_type elemSize = sizeof(detail::RawType<T>);
+
+        const size_type block = i / this->blockLength_;
+        const size_type pos = i % this->blockLength_;
+
+        return this->record_
+            + block*(this->blockLength_*elemSize + 2*markerSize)
+            + markerSize + pos*elemSize;
+    }
+
+    size_type diskSize() const
+    {
+        constexpr size_type markerSize = sizeof(std::uint32_t);
+        constexpr size_type elemSize = sizeof(detail::RawType<T>);
+
+        const size_type numBlocks = (this->size_ + this->blockLength_ - 1) / this->blockLength_;
+        return this->size_*elemSize + numBlocks*2*markerSize;
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
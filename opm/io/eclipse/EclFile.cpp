@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cstring>
 #include <cstddef>
+#include <exception>
 #include <fstream>
 #include <string>
 #include <numeric>
@@ -115,65 +116,140 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
-void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+void EclFile::enableMemoryMapping()
+{
+    if (formatted) {
+        OPM_THROW(std::runtime_error, "Memory mapping is only supported for unformatted files");
+    }
+
+    if (!mappedFile) {
+        mappedFile = std::make_shared<const MappedFile>(inputFilename);
+    }
+}
+
+
+void EclFile::setNumThreads(int numThreads)
+{
+    if (numThreads < 1) {
+        OPM_THROW(std::invalid_argument, "Number of threads must be positive");
+    }
+
+    num_threads = numThreads;
+}
+
+
+std::fstream EclFile::openInputFile() const
+{
+    std::fstream fileH;
+
+    if (formatted) {
+        fileH.open(inputFilename, std::ios::in);
+    } else {
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    }
+
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    return fileH;
+}
+
+
+EclFile::ArrayData EclFile::readBinaryArrayData(std::fstream& fileH, std::size_t arrIndex)
 {
+    if (mappedFile) {
+        switch (array_type[arrIndex]) {
+        case INTE:
+            return viewImpl<int>(arrIndex, INTE, "integer").toVector();
+        case REAL:
+            return viewImpl<float>(arrIndex, REAL, "float").toVector();
+        case DOUB:
+            return viewImpl<double>(arrIndex, DOUB, "double").toVector();
+        case LOGI:
+            return viewImpl<bool>(arrIndex, LOGI, "bool").toVector();
+        default:
+            break;
+        }
+    }
+
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryInteArray(fileH, array_size[arrIndex]);
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryRealArray(fileH, array_size[arrIndex]);
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryDoubArray(fileH, array_size[arrIndex]);
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryLogiArray(fileH, array_size[arrIndex]);
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
-        break;
+        return readBinaryCharArray(fileH, array_size[arrIndex]);
     case C0NN:
-        char_array[arrIndex] = readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
-        break;
+        return readBinaryC0nnArray(fileH, array_size[arrIndex], array_element_size[arrIndex]);
     case MESS:
-        break;
+        return {};
     default:
         OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-        break;
     }
-
-    arrayLoaded[arrIndex] = true;
 }
 
-void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
+
+EclFile::ArrayData EclFile::readFormattedArrayData(std::fstream& fileH, std::size_t arrIndex) const
 {
+    fileH.seekg(ifStreamPos[arrIndex]);
+
+    std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
+                                                array_type[arrIndex],
+                                                array_element_size[arrIndex]) + 1;
+    std::vector<char> buffer(disk_size);
+    fileH.read (buffer.data(), disk_size);
+
+    std::string fileStr = std::string(buffer.data(), disk_size);
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readFormattedInteArray(fileStr, array_size[arrIndex], fromPos);
+        return readFormattedInteArray(fileStr, array_size[arrIndex], 0);
+    case REAL:
+        return readFormattedRealArray(fileStr, array_size[arrIndex], 0);
+    case DOUB:
+        return readFormattedDoubArray(fileStr, array_size[arrIndex], 0);
+    case LOGI:
+        return readFormattedLogiArray(fileStr, array_size[arrIndex], 0);
+    case CHAR:
+        return readFormattedCharArray(fileStr, array_size[arrIndex], 0, sizeOfChar);
+    case C0NN:
+        return readFormattedCharArray(fileStr, array_size[arrIndex], 0, array_element_size[arrIndex]);
+    case MESS:
+        return {};
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+    }
+}
+
+
+void EclFile::storeArrayData(std::size_t arrIndex, ArrayData&& data)
+{
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = std::get<std::vector<int>>(std::move(data));
         break;
     case REAL:
-        real_array[arrIndex] = readFormattedRealArray(fileStr, array_size[arrIndex], fromPos);
+        real_array[arrIndex] = std::get<std::vector<float>>(std::move(data));
         break;
     case DOUB:
-        doub_array[arrIndex] = readFormattedDoubArray(fileStr, array_size[arrIndex], fromPos);
+        doub_array[arrIndex] = std::get<std::vector<double>>(std::move(data));
         break;
     case LOGI:
-        logi_array[arrIndex] = readFormattedLogiArray(fileStr, array_size[arrIndex], fromPos);
+        logi_array[arrIndex] = std::get<std::vector<bool>>(std::move(data));
         break;
     case CHAR:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, sizeOfChar);
-        break;
     case C0NN:
-        char_array[arrIndex] = readFormattedCharArray(fileStr, array_size[arrIndex], fromPos, array_element_size[arrIndex]);
-        break;
-    case MESS:
+        char_array[arrIndex] = std::get<std::vector<std::string>>(std::move(data));
         break;
     default:
-        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
         break;
     }
 
@@ -181,152 +257,94 @@ void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrInde
 }
 
 
-void EclFile::loadData()
+void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
+    storeArrayData(arrIndex, readBinaryArrayData(fileH, arrIndex));
+}
 
-    if (formatted) {
-
-        std::vector<int> arrIndices(array_name.size());
-        std::iota(arrIndices.begin(), arrIndices.end(), 0);
-
-        this->loadData(arrIndices);
-
-    } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+void EclFile::loadFormattedArray(std::fstream& fileH, std::size_t arrIndex)
+{
+    storeArrayData(arrIndex, readFormattedArrayData(fileH, arrIndex));
+}
 
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
 
-        for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+void EclFile::loadData()
+{
+    std::vector<int> arrIndices(array_name.size());
+    std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
-    }
+    this->loadData(arrIndices);
 }
 
 
 void EclFile::loadData(const std::string& name)
 {
+    std::vector<int> arrIndices;
 
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-        for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
-
-            if (array_name[arrIndex] == name) {
-
-                inFile.seekg(ifStreamPos[arrIndex]);
-
-                std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
-                                                            array_type[arrIndex],
-                                                            array_element_size[arrIndex]) + 1;
-                std::vector<char> buffer(disk_size);
-                inFile.read (buffer.data(), disk_size);
-
-                std::string fileStr = std::string(buffer.data(), disk_size);
-
-                loadFormattedArray(fileStr, arrIndex, 0);
-            }
+    for (std::size_t i = 0; i < array_name.size(); i++) {
+        if (array_name[i] == name) {
+            arrIndices.push_back(i);
         }
-
-    } else {
-
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
-            }
-        }
-
-        fileH.close();
     }
+
+    this->loadData(arrIndices);
 }
 
 
 void EclFile::loadData(const std::vector<int>& arrIndex)
 {
+    const int numArrays = static_cast<int>(arrIndex.size());
+    [[maybe_unused]] const int numThreads = std::max(1, std::min(num_threads, numArrays));
 
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-        for (int ind : arrIndex) {
+    // Arrays are read and decoded concurrently, each thread through its
+    // own file handle, into temporary storage.  Results are moved into
+    // the (non thread-safe) array caches afterwards.
+    std::vector<ArrayData> data(numArrays);
+    std::exception_ptr error;
 
-            inFile.seekg(ifStreamPos[ind]);
-
-            std::size_t disk_size = sizeOnDiskFormatted(array_size[ind],
-                                                        array_type[ind],
-                                                        array_element_size[ind]) + 1;
-            std::vector<char> buffer(disk_size);
-            inFile.read (buffer.data(), disk_size);
-
-            std::string fileStr = std::string(buffer.data(), disk_size);
-
-            loadFormattedArray(fileStr, ind, 0);
-        }
-
-    } else {
+    #pragma omp parallel num_threads(numThreads)
+    {
         std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
+        #pragma omp for schedule(dynamic)
+        for (int i = 0; i < numArrays; i++) {
+            try {
+                if (!fileH.is_open()) {
+                    fileH = openInputFile();
+                }
 
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
+                data[i] = formatted
+                    ? readFormattedArrayData(fileH, arrIndex[i])
+                    : readBinaryArrayData(fileH, arrIndex[i]);
+            }
+            catch (...) {
+                #pragma omp critical(EclFile_loadData)
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
         }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
 
-        fileH.close();
+    for (int i = 0; i < numArrays; i++) {
+        storeArrayData(arrIndex[i], std::move(data[i]));
     }
 }
 
 
 void EclFile::loadData(int arrIndex)
 {
-    if (formatted) {
-
-        std::ifstream inFile(inputFilename);
-
-            inFile.seekg(ifStreamPos[arrIndex]);
-
-            std::size_t disk_size = sizeOnDiskFormatted(array_size[arrIndex],
-                                                        array_type[arrIndex],
-                                                        array_element_size[arrIndex]) + 1;
-            std::vector<char> buffer(disk_size);
-            inFile.read (buffer.data(), disk_size);
-
-            std::string fileStr = std::string(buffer.data(), disk_size);
-
-            loadFormattedArray(fileStr, arrIndex, 0);
-
+    auto fileH = openInputFile();
 
+    if (formatted) {
+        loadFormattedArray(fileH, arrIndex);
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
         loadBinaryArray(fileH, arrIndex);
-
-        fileH.close();
     }
 }
 
@@ -476,6 +494,8 @@ const std::vector<bool>& EclFile::get<bool>(int arrIndex)
 template<>
 const std::vector<std::string>& EclFile::get<std::string>(int arrIndex)
 {
+    checkIndex(arrIndex);
+
     if ((array_type[arrIndex] != Opm::EclIO::C0NN) && (array_type[arrIndex] != Opm::EclIO::CHAR)){
         std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + "std::string";
         OPM_THROW(std::runtime_error, message);
@@ -626,11 +646,86 @@ const std::vector<std::string>& EclFile::get<std::string>(const std::string &nam
 }
 
 
+template<>
+EclArrayView<int> EclFile::view<int>(int arrIndex)
+{
+    return viewImpl<int>(arrIndex, INTE, "integer");
+}
+
+
+template<>
+EclArrayView<float> EclFile::view<float>(int arrIndex)
+{
+    return viewImpl<float>(arrIndex, REAL, "float");
+}
+
+
+template<>
+EclArrayView<double> EclFile::view<double>(int arrIndex)
+{
+    return viewImpl<double>(arrIndex, DOUB, "double");
+}
+
+
+template<>
+EclArrayView<bool> EclFile::view<bool>(int arrIndex)
+{
+    return viewImpl<bool>(arrIndex, LOGI, "bool");
+}
+
+
+template<typename T>
+EclArrayView<T> EclFile::view(const std::string& name)
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->view<T>(search->second);
+}
+
+template EclArrayView<int> EclFile::view<int>(const std::string&);
+template EclArrayView<float> EclFile::view<float>(const std::string&);
+template EclArrayView<double> EclFile::view<double>(const std::string&);
+template EclArrayView<bool> EclFile::view<bool>(const std::string&);
+
+
+template<class T>
+EclArrayView<T> EclFile::viewImpl(int arrIndex, eclArrType type, const std::string& typeStr)
+{
+    checkIndex(arrIndex);
+
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    this->enableMemoryMapping();
+
+    const auto [elementSize, maxBlockSize] = block_size_data_binary(type);
+    const auto diskSize = sizeOnDiskBinary(array_size[arrIndex], type, elementSize);
+
+    if (ifStreamPos[arrIndex] + diskSize > mappedFile->size()) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " extends beyond end of file " + inputFilename;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    return { mappedFile, mappedFile->data() + ifStreamPos[arrIndex],
+             static_cast<std::size_t>(array_size[arrIndex]),
+             static_cast<std::size_t>(maxBlockSize / elementSize) };
+}
+
+
 template<class T>
 const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
                                        const std::unordered_map<int, std::vector<T>>& array,
                                        const std::string& typeStr)
 {
+    checkIndex(arrIndex);
+
     if (array_type[arrIndex] != type) {
         std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
         OPM_THROW(std::runtime_error, message);
@@ -644,6 +739,15 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+void EclFile::checkIndex(int arrIndex) const
+{
+    if ((arrIndex < 0) || (arrIndex >= static_cast<int>(array_name.size()))) {
+        std::string message = "Array index " + std::to_string(arrIndex) + " out of range for file " + inputFilename;
+        OPM_THROW(std::invalid_argument, message);
+    }
+}
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
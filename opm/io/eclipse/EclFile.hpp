@@ -19,14 +19,17 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 #include <cstdint>
 
@@ -43,11 +46,21 @@ public:
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    // Access array data through a read-only memory mapping of the file
+    // instead of stream I/O.  Only supported for unformatted files.
+    void enableMemoryMapping();
+    bool memoryMapped() const { return static_cast<bool>(mappedFile); }
+
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
     void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
 
+    // Number of threads used to read and decode arrays when several
+    // arrays are loaded in one call.  Defaults to one.
+    void setNumThreads(int numThreads);
+    int numThreads() const { return num_threads; }
+
     void clearData()
     {
       inte_array.clear();
@@ -68,6 +81,15 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // Zero-copy access to an array in an unformatted file.  Enables
+    // memory mapping if needed; elements are decoded on access and the
+    // array is not cached in this object.
+    template <typename T>
+    EclArrayView<T> view(int arrIndex);
+
+    template <typename T>
+    EclArrayView<T> view(const std::string& name);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -94,19 +116,43 @@ protected:
 
     std::map<std::string, int> array_index;
 
+    std::shared_ptr<const MappedFile> mappedFile;
+
     template<class T>
     const std::vector<T>& getImpl(int arrIndex, eclArrType type,
                                   const std::unordered_map<int, std::vector<T>>& array,
                                   const std::string& typeStr);
 
+    template<class T>
+    EclArrayView<T> viewImpl(int arrIndex, eclArrType type, const std::string& typeStr);
+
+    // Throws std::invalid_argument unless arrIndex is a valid array index.
+    void checkIndex(int arrIndex) const;
+
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
 private:
+    using ArrayData = std::variant<std::monostate,
+                                   std::vector<int>,
+                                   std::vector<float>,
+                                   std::vector<double>,
+                                   std::vector<bool>,
+                                   std::vector<std::string>>;
+
     std::vector<bool> arrayLoaded;
+    int num_threads = 1;
+
+    std::fstream openInputFile() const;
+
+    // Thread-safe with respect to each other, given separate file handles.
+    ArrayData readBinaryArrayData(std::fstream& fileH, std::size_t arrIndex);
+    ArrayData readFormattedArrayData(std::fstream& fileH, std::size_t arrIndex) const;
+
+    void storeArrayData(std::size_t arrIndex, ArrayData&& data);
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
-    void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
+    void loadFormattedArray(std::fstream& fileH, std::size_t arrIndex);
     void load(bool preload);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
@@ -29,6 +29,7 @@
 #define OPM_BINARY_COEFF_BRINE_CO2_HPP
 
 #include <opm/material/IdealGas.hpp>
+#include <opm/material/densead/EvaluationExpression.hpp>
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/common/TimingMacros.hpp>
 
@@ -220,10 +221,15 @@ public:
             lnPhiCO2 -= log(pg_bar * V / (R * temperature));
         }
         else {
-            lnPhiCO2 = (b_CO2 / b_mix) * (pg_bar * V / (R * temperature) - 1);
-            lnPhiCO2 -= log(pg_bar * (V - b_mix) / (R * temperature));
-            lnPhiCO2 += (2 * (yH2O * a_CO2_H2O + (1 - yH2O) * a_CO2) / a_mix - (b_CO2 / b_mix)) *
-                        a_mix / (b_mix * R * pow(temperature, 1.5)) * log(V / (V + b_mix));
+            // evaluated as a single expression, without temporaries
+            const auto v = DenseAd::lazy(V);
+            const auto y = DenseAd::lazy(yH2O);
+            const auto bMix = DenseAd::lazy(b_mix);
+            const auto RT = R * DenseAd::lazy(temperature);
+            lnPhiCO2 = (b_CO2 / bMix) * (pg_bar * v / RT - 1)
+                       - log(pg_bar * (v - bMix) / RT)
+                       + (2 * (y * a_CO2_H2O + (1 - y) * a_CO2) / a_mix - (b_CO2 / bMix)) *
+                         a_mix / (bMix * R * pow(DenseAd::lazy(temperature), Scalar(1.5))) * log(v / (v + bMix));
         }
         return exp(lnPhiCO2); // fugacity coefficient of CO2
     }
@@ -270,10 +276,15 @@ public:
                 - log(pg_bar*V/(R*temperature));
         }
         else {
-            lnPhiH2O = (b_H2O / b_mix) * (pg_bar * V / (R * temperature) - 1);
-            lnPhiH2O -= log(pg_bar * (V - b_mix) / (R * temperature));
-            lnPhiH2O += (2 * (yH2O * a_H2O + (1 - yH2O) * a_CO2_H2O) / a_mix - (b_H2O / b_mix)) *
-                        a_mix / (b_mix * R * pow(temperature, 1.5)) * log(V / (V + b_mix));
+            // evaluated as a single expression, without temporaries
+            const auto v = DenseAd::lazy(V);
+            const auto y = DenseAd::lazy(yH2O);
+            const auto bMix = DenseAd::lazy(b_mix);
+            const auto RT = R * DenseAd::lazy(temperature);
+            lnPhiH2O = (b_H2O / bMix) * (pg_bar * v / RT - 1)
+                       - log(pg_bar * (v - bMix) / RT)
+                       + (2 * (y * a_H2O + (1 - y) * a_CO2_H2O) / a_mix - (b_H2O / bMix)) *
+                         a_mix / (bMix * R * pow(DenseAd::lazy(temperature), Scalar(1.5))) * log(v / (v + bMix));
         }
         return exp(lnPhiH2O); // fugacity coefficient of H2O
     }
@@ -343,7 +354,8 @@ private:
             Evaluation aH2O = aH2O_(temperature, highTemp);
             Evaluation a_CO2_H2O = aCO2_H2O_(temperature, yH2O, highTemp);
 
-            return yH2O * yH2O * aH2O + 2 * yH2O * (1 - yH2O) * a_CO2_H2O + (1 - yH2O) * (1 - yH2O) * aCO2;
+            const auto y = DenseAd::lazy(yH2O);
+            return y * y * aH2O + 2 * y * (1 - y) * a_CO2_H2O + (1 - y) * (1 - y) * aCO2;
         }
         else {
             return aCO2_(temperature, highTemp);
@@ -0,0 +1,143 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::SegmentLocator
+ */
+#ifndef OPM_SEGMENT_LOCATOR_HPP
+#define OPM_SEGMENT_LOCATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Index for finding the segment of a sorted sequence of sampling points
+ *        which contains a given position.
+ *
+ * The range between the second and the second to last sampling point is
+ * divided into equally sized buckets, and the first candidate segment of
+ * each bucket is stored. A lookup then only needs to bisect the few
+ * segments which overlap a single bucket instead of the whole table.
+ *
+ * The result is the same as that of bisecting the full table, i.e., the
+ * largest index i in [1, n - 3] with x_i <= x. Positions at or outside of
+ * the second and second to last sampling points must be handled by the
+ * caller. The index is immutable once built and thus safe to share
+ * between threads.
+ */
+template <class Scalar>
+class SegmentLocator
+{
+public:
+    /*!
+     * \brief Build the index for n sampling points, the positions of which
+     *        are given by coord(i).
+     *
+     * The index is left empty if the sampling points are not finite and
+     * strictly increasing, or if there are too few of them to benefit.
+     */
+    template <class Coord>
+    void build(std::size_t n, Coord coord)
+    {
+        firstSegment_.clear();
+        if (n < 4)
+            return;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!std::isfinite(coord(i)) || ((i > 0) && !(coord(i - 1) < coord(i))))
+                return;
+        }
+
+        const std::size_t numBuckets = 2*(n - 3);
+        const Scalar invWidth = numBuckets / (coord(n - 2) - coord(1));
+        if (!std::isfinite(invWidth))
+            return;
+
+        numSamples_ = n;
+        lower_ = coord(1);
+        invWidth_ = invWidth;
+
+        firstSegment_.resize(numBuckets + 1);
+        std::size_t segIdx = 1;
+        for (std::size_t b = 0; b <= numBuckets; ++b) {
+            const Scalar bucketStart = lower_ + b/invWidth_;
+            while (segIdx + 1 < n - 2 && coord(segIdx + 1) <= bucketStart)
+                ++segIdx;
+
+            firstSegment_[b] = static_cast<unsigned>(segIdx);
+        }
+    }
+
+    /*!
+     * \brief Returns true if no index was built.
+     */
+    bool empty() const
+    { return firstSegment_.empty(); }
+
+    /*!
+     * \brief Return the segment which contains x, which must be strictly
+     *        between coord(1) and coord(n - 2).
+     */
+    template <class Coord>
+    std::size_t find(Scalar x, Coord coord) const
+    {
+        const std::size_t numBuckets = firstSegment_.size() - 1;
+        const std::size_t b = std::min(static_cast<std::size_t>((x - lower_)*invWidth_),
+                                       numBuckets - 1);
+
+        std::size_t lowerIdx = firstSegment_[b];
+        std::size_t upperIdx = firstSegment_[b + 1];
+
+        // compensate for rounding errors of the bucket computation
+        while (lowerIdx > 1 && x < coord(lowerIdx))
+            --lowerIdx;
+        while (upperIdx + 1 < numSamples_ - 2 && coord(upperIdx + 1) <= x)
+            ++upperIdx;
+
+        // bisection within the bucket
+        while (lowerIdx < upperIdx) {
+            const std::size_t pivotIdx = (lowerIdx + upperIdx + 1) / 2;
+            if (x < coord(pivotIdx))
+                upperIdx = pivotIdx - 1;
+            else
+                lowerIdx = pivotIdx;
+        }
+
+        return lowerIdx;
+    }
+
+private:
+    std::vector<unsigned> firstSegment_;
+    std::size_t numSamples_ = 0;
+    Scalar lower_ = 0;
+    Scalar invWidth_ = 0;
+};
+
+} // namespace Opm
+
+#endif
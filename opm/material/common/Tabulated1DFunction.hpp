@@ -28,16 +28,24 @@
 #define OPM_TABULATED_1D_FUNCTION_HPP
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/material/common/SegmentLocator.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <iosfwd>
 #include <stdexcept>
 #include <vector>
 
 namespace Opm {
 
+namespace DenseAd {
+template <class ScalarT, int numDerivs, int width>
+class EvaluationBatch;
+}
+
 struct SegmentIndex {
     size_t value;
 };
@@ -120,6 +128,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentLocator_();
     }
 
     /*!
@@ -144,6 +154,8 @@ public:
             else if (xValues_[0] > xValues_[numSamples() - 1])
                 reverseSamplingPoints_();
         }
+
+        buildSegmentLocator_();
     }
 
     /*!
@@ -168,6 +180,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentLocator_();
     }
 
     /*!
@@ -204,6 +218,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        buildSegmentLocator_();
     }
 
     /*!
@@ -265,6 +281,42 @@ public:
         return eval(x, segIdx);
     }
 
+    /*!
+     * \brief Evaluate the function for a batch of positions.
+     *
+     * The segment is looked up for each lane separately, the interpolation
+     * runs over all lanes at once.
+     */
+    template <class ValueT, int numVars, int width>
+    DenseAd::EvaluationBatch<ValueT, numVars, width>
+    eval(const DenseAd::EvaluationBatch<ValueT, numVars, width>& x,
+         bool extrapolate = false) const
+    {
+        using Batch = DenseAd::EvaluationBatch<ValueT, numVars, width>;
+
+        typename Batch::LaneValues value, slope;
+        for (int l = 0; l < width; ++l) {
+            const ValueT xl = x.value()[l];
+            const size_t segIdx = findSegmentIndex(xl, extrapolate).value;
+
+            const Scalar x0 = xValues_[segIdx];
+            const Scalar y0 = yValues_[segIdx];
+            slope[l] = (yValues_[segIdx + 1] - y0)/(xValues_[segIdx + 1] - x0);
+            value[l] = y0 + slope[l]*(xl - x0);
+        }
+
+        Batch result(value);
+        typename Batch::LaneValues derivative;
+        for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+            for (int l = 0; l < width; ++l)
+                derivative[l] = slope[l]*x.derivative(varIdx)[l];
+
+            result.setDerivative(varIdx, derivative);
+        }
+
+        return result;
+    }
+
     template <class Evaluation>
     Evaluation eval(const Evaluation& x, SegmentIndex segIdxIn) const
     {
@@ -278,6 +330,30 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Evaluate the function for a batch of positions.
+     *
+     * This is equivalent to y[k] = eval(x[k], extrapolate) for all k < n. The
+     * segments are looked up for a block of positions before interpolating,
+     * which lets the compiler vectorize the interpolation loop.
+     */
+    template <class Evaluation>
+    void eval(std::size_t n, const Evaluation* x, Evaluation* y,
+              bool extrapolate = false) const
+    {
+        constexpr std::size_t blockSize = 64;
+        std::array<std::size_t, blockSize> segIdx;
+
+        for (std::size_t start = 0; start < n; start += blockSize) {
+            const std::size_t count = std::min(blockSize, n - start);
+            for (std::size_t k = 0; k < count; ++k)
+                segIdx[k] = findSegmentIndex(x[start + k], extrapolate).value;
+
+            for (std::size_t k = 0; k < count; ++k)
+                y[start + k] = eval(x[start + k], SegmentIndex{segIdx[k]});
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -431,31 +507,57 @@ public:
                yValues_ == data.yValues_;
     }
 
+    /*!
+     * \brief Returns true if both functions use the same sampling points on the
+     *        abscissa.
+     *
+     * A segment index found for one of the functions is then also valid for the other.
+     */
+    bool hasSameSamplingPoints(const Tabulated1DFunction<Scalar>& other) const
+    { return xValues_ == other.xValues_; }
+
+    /*!
+     * \brief Returns true if the sampled values are strictly increasing or strictly
+     *        decreasing.
+     *
+     * The inverse of such a function is then given exactly, including its
+     * extrapolation, by the sampling points with the roles of x and y swapped.
+     */
+    bool isStrictlyMonotonic() const
+    {
+        if (numSamples() < 2)
+            return false;
+
+        const bool increasing = yValues_[1] > yValues_[0];
+        for (std::size_t i = 0; i + 1 < numSamples(); ++i) {
+            if (increasing ? !(yValues_[i + 1] > yValues_[i])
+                           : !(yValues_[i + 1] < yValues_[i]))
+                return false;
+        }
+
+        return true;
+    }
+
     template <class Evaluation>
     SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate = false) const
     {
-        if (!isfinite(x)) {
-            throw std::runtime_error("We can not search for extrapolation/interpolation "
-                                     "segment in an 1D table for non-finite value " +
-                                     std::to_string(getValue(x)) + " .");
-        }
+        if (!isfinite(x))
+            throwNonFinite_(getValue(x));
 
         if (!extrapolate && !applies(x))
             throw std::logic_error("Trying to evaluate a tabulated function outside of its range");
 
         // we need at least two sampling points!
-        if (numSamples() < 2) {
-            throw std::logic_error("We need at least two sampling points to "
-                                   "do interpolation/extrapolation, "
-                                   "and the table only contains " +
-                                   std::to_string(numSamples()) +
-                                   " sampling points");
-        }
+        if (numSamples() < 2)
+            throwTooFewSamples_();
 
         if (x <= xValues_[1])
             return SegmentIndex{0};
         else if (x >= xValues_[xValues_.size() - 2])
             return SegmentIndex{xValues_.size() - 2};
+        else if (!segmentLocator_.empty())
+            return SegmentIndex{segmentLocator_.find(getValue(x),
+                                                     [this](std::size_t i) { return xValues_[i]; })};
         else {
             // bisection
             size_t lowerIdx = 1;
@@ -468,39 +570,67 @@ public:
                     lowerIdx = pivotIdx;
             }
 
-            if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
-                std::string msg = "Problematic interpolation/extrapolation "
-                                  "segment is found for the input value " +
-                                  std::to_string(Opm::getValue(x)) +
-                                  "\nthe lower index of the found segment is " +
-                                  std::to_string(lowerIdx) +
-                                  ", the size of the table is " +
-                                  std::to_string(numSamples()) +
-                                  ",\nand the end values of the found segment are " +
-                                  std::to_string(xValues_[lowerIdx]) +
-                                  " and " +
-                                  std::to_string(xValues_[lowerIdx + 1]) +
-                                  ", respectively.\n";
-                msg += "Outputting the problematic table for more information "
-                       "(with *** marking the found segment):";
-                for (size_t i = 0; i < numSamples(); ++i) {
-                    if (i % 10 == 0)
-                        msg += "\n";
-                    if (i == lowerIdx)
-                        msg += " ***";
-                    msg += " " + std::to_string(xValues_[i]);
-                    if (i == lowerIdx + 1)
-                        msg += " ***";
-                }
-                msg += "\n";
-                OpmLog::debug(msg);
-                throw std::runtime_error(msg);
-            }
+            if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1])
+                throwProblematicSegment_(getValue(x), lowerIdx);
+
             return SegmentIndex{lowerIdx};
         }
     }
 
 private:
+    // The error paths are kept out of line so that they do not bloat the
+    // segment lookup, which is called for every evaluation.
+    [[noreturn]] void throwNonFinite_(Scalar x) const
+    {
+        throw std::runtime_error("We can not search for extrapolation/interpolation "
+                                 "segment in an 1D table for non-finite value " +
+                                 std::to_string(x) + " .");
+    }
+
+    [[noreturn]] void throwTooFewSamples_() const
+    {
+        throw std::logic_error("We need at least two sampling points to "
+                               "do interpolation/extrapolation, "
+                               "and the table only contains " +
+                               std::to_string(numSamples()) +
+                               " sampling points");
+    }
+
+    [[noreturn]] void throwProblematicSegment_(Scalar x, size_t lowerIdx) const
+    {
+        std::string msg = "Problematic interpolation/extrapolation "
+                          "segment is found for the input value " +
+                          std::to_string(x) +
+                          "\nthe lower index of the found segment is " +
+                          std::to_string(lowerIdx) +
+                          ", the size of the table is " +
+                          std::to_string(numSamples()) +
+                          ",\nand the end values of the found segment are " +
+                          std::to_string(xValues_[lowerIdx]) +
+                          " and " +
+                          std::to_string(xValues_[lowerIdx + 1]) +
+                          ", respectively.\n";
+        msg += "Outputting the problematic table for more information "
+               "(with *** marking the found segment):";
+        for (size_t i = 0; i < numSamples(); ++i) {
+            if (i % 10 == 0)
+                msg += "\n";
+            if (i == lowerIdx)
+                msg += " ***";
+            msg += " " + std::to_string(xValues_[i]);
+            if (i == lowerIdx + 1)
+                msg += " ***";
+        }
+        msg += "\n";
+        OpmLog::debug(msg);
+        throw std::runtime_error(msg);
+    }
+
+    void buildSegmentLocator_()
+    {
+        segmentLocator_.build(numSamples(), [this](std::size_t i) { return xValues_[i]; });
+    }
+
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
     {
@@ -613,6 +743,7 @@ private:
 
     std::vector<Scalar> xValues_;
     std::vector<Scalar> yValues_;
+    SegmentLocator<Scalar> segmentLocator_;
 };
 
 } // namespace Opm
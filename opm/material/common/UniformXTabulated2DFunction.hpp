@@ -32,9 +32,13 @@
 
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/SegmentLocator.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <tuple>
@@ -42,6 +46,12 @@
 #include <vector>
 
 namespace Opm {
+
+namespace DenseAd {
+template <class ScalarT, int numDerivs, int width>
+class EvaluationBatch;
+}
+
 /*!
  * \brief Implements a scalar function that depends on two variables and which is sampled
  *        uniformly in the X direction, but non-uniformly on the Y axis-
@@ -84,7 +94,12 @@ public:
         , xPos_(xPos)
         , yPos_(yPos)
         , interpolationGuide_(interpolationGuide)
-    { }
+    {
+        buildXLocator_();
+        yLocators_.resize(samples_.size());
+        for (size_t i = 0; i < samples_.size(); ++i)
+            buildYLocator_(i);
+    }
 
     /*!
      * \brief Returns the minimum of the X coordinate of the sampling points.
@@ -197,6 +212,8 @@ public:
             return 0;
         else if (x >= xPos_[xPos_.size() - 2])
             return xPos_.size() - 2;
+        else if (!xLocator_.empty())
+            return xLocator_.find(scalarValue(x), [this](size_t i) { return xPos_[i]; });
         else {
             assert(xPos_.size() >= 3);
 
@@ -246,6 +263,10 @@ public:
             return 0;
         else if (y >= std::get<1>(colSamplePoints[colSamplePoints.size() - 2]))
             return colSamplePoints.size() - 2;
+        else if (!yLocators_[xSampleIdx].empty())
+            return yLocators_[xSampleIdx].find(scalarValue(y),
+                                               [&colSamplePoints](size_t j)
+                                               { return std::get<1>(colSamplePoints[j]); });
         else {
             assert(colSamplePoints.size() >= 3);
 
@@ -324,6 +345,71 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate the function at the (x,y) positions of a batch.
+     *
+     * The sampling points are looked up for each lane separately, the
+     * interpolation runs over all lanes at once.
+     */
+    template <class ValueT, int numVars, int width>
+    DenseAd::EvaluationBatch<ValueT, numVars, width>
+    eval(const DenseAd::EvaluationBatch<ValueT, numVars, width>& x,
+         const DenseAd::EvaluationBatch<ValueT, numVars, width>& y,
+         bool extrapolate = false) const
+    {
+        using Batch = DenseAd::EvaluationBatch<ValueT, numVars, width>;
+        using LaneEvaluation = typename Batch::LaneEvaluation;
+
+        Batch alpha, beta1, beta2;
+        typename Batch::LaneValues v11, v12, v21, v22;
+        for (int l = 0; l < width; ++l) {
+            LaneEvaluation alphaLane, beta1Lane, beta2Lane;
+            unsigned i, j1, j2;
+            findPoints(i, j1, j2, alphaLane, beta1Lane, beta2Lane,
+                       x.lane(l), y.lane(l), extrapolate);
+
+            alpha.setLane(l, alphaLane);
+            beta1.setLane(l, beta1Lane);
+            beta2.setLane(l, beta2Lane);
+
+            v11[l] = valueAt(i, j1);
+            v12[l] = valueAt(i, j1 + 1);
+            v21[l] = valueAt(i + 1, j2);
+            v22[l] = valueAt(i + 1, j2 + 1);
+        }
+
+        const Batch s1 = Batch(v11)*(1.0 - beta1) + Batch(v12)*beta1;
+        const Batch s2 = Batch(v21)*(1.0 - beta2) + Batch(v22)*beta2;
+
+        return s1*(1.0 - alpha) + s2*alpha;
+    }
+
+    /*!
+     * \brief Evaluate the function for a batch of (x,y) positions.
+     *
+     * This is equivalent to result[k] = eval(x[k], y[k], extrapolate) for all
+     * k < n. The sampling points are looked up for a block of positions before
+     * interpolating, which lets the compiler vectorize the interpolation loop.
+     */
+    template <class Evaluation>
+    void eval(size_t n, const Evaluation* x, const Evaluation* y, Evaluation* result,
+              bool extrapolate = false) const
+    {
+        constexpr size_t blockSize = 64;
+        std::array<unsigned, blockSize> i, j1, j2;
+        std::array<Evaluation, blockSize> alpha, beta1, beta2;
+
+        for (size_t start = 0; start < n; start += blockSize) {
+            const size_t count = std::min(blockSize, n - start);
+            for (size_t k = 0; k < count; ++k)
+                findPoints(i[k], j1[k], j2[k], alpha[k], beta1[k], beta2[k],
+                           x[start + k], y[start + k], extrapolate);
+
+            for (size_t k = 0; k < count; ++k)
+                result[start + k] = eval(i[k], j1[k], j2[k], alpha[k], beta1[k], beta2[k]);
+        }
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -420,6 +506,8 @@ public:
             xPos_.push_back(nextX);
             yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
             samples_.push_back({});
+            yLocators_.emplace_back();
+            buildXLocator_();
             return xPos_.size() - 1;
         }
         else if (xPos_.front() > nextX) {
@@ -427,6 +515,8 @@ public:
             xPos_.insert(xPos_.begin(), nextX);
             yPos_.insert(yPos_.begin(), std::numeric_limits<Scalar>::lowest() / 2);
             samples_.insert(samples_.begin(), std::vector<SamplePoint>());
+            yLocators_.emplace(yLocators_.begin());
+            buildXLocator_();
             return 0;
         }
         throw std::invalid_argument("Sampling points should be specified either monotonically "
@@ -447,6 +537,7 @@ public:
             if (interpolationGuide_ == InterpolationPolicy::RightExtreme) {
                 yPos_[i] = y;
             }
+            buildYLocator_(i);
             return samples_[i].size() - 1;
         }
         else if (std::get<1>(samples_[i].front()) > y) {
@@ -455,6 +546,7 @@ public:
             if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
                 yPos_[i] = y;
             }
+            buildYLocator_(i);
             return 0;
         }
 
@@ -478,6 +570,19 @@ public:
     }
 
 private:
+    void buildXLocator_()
+    {
+        xLocator_.build(xPos_.size(), [this](size_t i) { return xPos_[i]; });
+    }
+
+    void buildYLocator_(size_t i)
+    {
+        const auto& colSamplePoints = samples_[i];
+        yLocators_[i].build(colSamplePoints.size(),
+                            [&colSamplePoints](size_t j)
+                            { return std::get<1>(colSamplePoints[j]); });
+    }
+
     // the vector which contains the values of the sample points
     // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
     // instead!
@@ -488,6 +593,11 @@ private:
     // the position on the y-axis of the guide point
     std::vector<Scalar> yPos_;
     InterpolationPolicy interpolationGuide_;
+
+    // acceleration of the segment lookups, rebuilt whenever sampling
+    // points are added
+    SegmentLocator<Scalar> xLocator_;
+    std::vector<SegmentLocator<Scalar>> yLocators_;
 };
 } // namespace Opm
 
@@ -43,16 +43,29 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <array>
+#include <cassert>
 #include <limits>
 #include <iostream>
 #include <iomanip>
+#include <iterator>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include <fmt/format.h>
 
 namespace Opm {
 
+/*!
+ * \brief Nonlinear solver for the compositions of a two-phase cell.
+ */
+enum class PTFlashMethod {
+    Newton,     //!< Newton's method
+    Ssi,        //!< successive substitution
+    SsiNewton   //!< a few successive substitution steps followed by Newton's method
+};
+
 /*!
  * \brief Determines the phase compositions, pressures and saturations
  *        given the total mass of all components for the chiwoms problem.
@@ -77,14 +90,110 @@ public:
     /*!
      * \brief Calculates the fluid state from the global mole fractions of the components and the phase pressures
      *
+     * \param twoPhaseMethod The method used for two-phase cells, one of
+     *        "newton", "ssi" and "ssi+newton".
      */
     template <class FluidState>
     static void solve(FluidState& fluid_state,
                       const Dune::FieldVector<typename FluidState::Scalar, numComponents>& z,
                       const std::string& twoPhaseMethod,
+                      Scalar tolerance,
+                      int verbosity = 0)
+    {
+        switch (flashMethod(twoPhaseMethod)) {
+        case PTFlashMethod::Newton:
+            solve<PTFlashMethod::Newton>(fluid_state, z, tolerance, verbosity);
+            break;
+        case PTFlashMethod::Ssi:
+            solve<PTFlashMethod::Ssi>(fluid_state, z, tolerance, verbosity);
+            break;
+        case PTFlashMethod::SsiNewton:
+            solve<PTFlashMethod::SsiNewton>(fluid_state, z, tolerance, verbosity);
+            break;
+        }
+    }
+
+    /*!
+     * \brief Calculates the fluid state from the global mole fractions of the components and the phase pressures
+     *
+     * The K-values and L stored in the fluid state, e.g. from the previous
+     * time step, are used as the starting point.  The method used for
+     * two-phase cells is selected at compile time.
+     */
+    template <PTFlashMethod method, class FluidState>
+    static void solve(FluidState& fluid_state,
+                      const Dune::FieldVector<typename FluidState::Scalar, numComponents>& z,
                       Scalar /*tolerance = -1.*/,
                       int verbosity = 0)
     {
+        solve_<method>(fluid_state, z, /*stabilityMargin=*/0.0, verbosity);
+    }
+
+    /*!
+     * \brief Calculates the fluid states of a batch of cells.
+     *
+     * Each fluid state is solved like by solve(), starting from its stored
+     * K-values and L.  Cells which were single-phase skip the stability test
+     * if the Wilson K-values at the cell's pressure and temperature place the
+     * mixture further than stabilityMargin from the phase boundary, i.e. if
+     * sum(z*K) or sum(z/K) is less than 1 - stabilityMargin.  The default
+     * margin of zero always performs the stability test.
+     *
+     * \param fluid_states Range of fluid states.
+     * \param z Range of global mole fractions, one per fluid state.
+     */
+    template <PTFlashMethod method, class FluidStateRange, class CompositionRange>
+    static void solveBatch(FluidStateRange& fluid_states,
+                           const CompositionRange& z,
+                           Scalar stabilityMargin = 0.0,
+                           int verbosity = 0)
+    {
+        assert(std::size(fluid_states) == std::size(z));
+
+        auto z_cell = std::begin(z);
+        for (auto& fluid_state : fluid_states) {
+            solve_<method>(fluid_state, *z_cell, stabilityMargin, verbosity);
+            ++z_cell;
+        }
+    }
+
+    /*!
+     * \brief The two-phase flash method of the given name, one of "newton",
+     *        "ssi" and "ssi+newton".
+     */
+    static PTFlashMethod flashMethod(const std::string& name)
+    {
+        if (name == "newton")
+            return PTFlashMethod::Newton;
+        else if (name == "ssi")
+            return PTFlashMethod::Ssi;
+        else if (name == "ssi+newton")
+            return PTFlashMethod::SsiNewton;
+
+        throw std::logic_error("unknown two phase flash method " + name + " is specified");
+    }
+
+    static std::string flashMethodName(PTFlashMethod method)
+    {
+        switch (method) {
+        case PTFlashMethod::Newton:
+            return "newton";
+        case PTFlashMethod::Ssi:
+            return "ssi";
+        case PTFlashMethod::SsiNewton:
+            return "ssi+newton";
+        }
+
+        return "unknown";
+    }
+
+private:
+    template <PTFlashMethod method, class FluidState>
+    static void solve_(FluidState& fluid_state,
+                       const Dune::FieldVector<typename FluidState::Scalar, numComponents>& z,
+                       Scalar stabilityMargin,
+                       int verbosity)
+    {
 
         using InputEval = typename FluidState::Scalar;
         using ComponentVector = Dune::FieldVector<typename FluidState::Scalar, numComponents>;
@@ -133,10 +242,22 @@ public:
         // Do a stability test to check if cell is is_single_phase-phase (do for all cells the first time).
         bool is_stable = false;
         if ( L <= 0 || L == 1 ) {
-             if (verbosity >= 1) {
-                 std::cout << "Perform stability test (L <= 0 or L == 1)!" << std::endl;
-             }
-            phaseStabilityTest_(is_stable, K_scalar, fluid_state_scalar, z_scalar, verbosity);
+            if (farFromPhaseBoundary_(fluid_state_scalar, z_scalar, stabilityMargin, K_scalar)) {
+                if (verbosity >= 1) {
+                    std::cout << "Skip stability test, Wilson K-values are far from the phase boundary!" << std::endl;
+                }
+                is_stable = true;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    fluid_state_scalar.setMoleFraction(gasPhaseIdx, compIdx, z_scalar[compIdx]);
+                    fluid_state_scalar.setMoleFraction(oilPhaseIdx, compIdx, z_scalar[compIdx]);
+                }
+            }
+            else {
+                if (verbosity >= 1) {
+                    std::cout << "Perform stability test (L <= 0 or L == 1)!" << std::endl;
+                }
+                phaseStabilityTest_(is_stable, K_scalar, fluid_state_scalar, z_scalar, verbosity);
+            }
         }
         if (verbosity >= 1) {
             std::cout << "Inputs after stability test are K = [" << K_scalar << "], L = [" << L_scalar << "], z = [" << z_scalar << "], P = " << fluid_state.pressure(0) << ", and T = " << fluid_state.temperature(0) << std::endl;
@@ -149,7 +270,7 @@ public:
         if ( !is_single_phase ) {
             // Rachford Rice equation to get initial L for composition solver
             L_scalar = solveRachfordRice_g_(K_scalar, z_scalar, verbosity);
-            flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state_scalar, verbosity);
+            flash_2ph<method>(z_scalar, K_scalar, L_scalar, fluid_state_scalar, verbosity);
         } else {
             // Cell is one-phase. Use Li's phase labeling method to see if it's liquid or vapor
             L_scalar = li_single_phase_label_(fluid_state_scalar, z_scalar, verbosity);
@@ -179,6 +300,8 @@ public:
         updateDerivatives_(fluid_state_scalar, z, fluid_state, is_single_phase);
     }//end solve
 
+public:
+
     /*!
      * \brief Calculates the chemical equilibrium from the component
      *        fugacities in a phase.
@@ -444,6 +567,37 @@ protected:
         return tmp;
     }
 
+    // Whether the Wilson K-values at the current pressure and temperature
+    // place the mixture clearly outside of the two-phase region: a liquid
+    // below its bubble point, sum(z*K) < 1, or a vapor above its dew point,
+    // sum(z/K) < 1.  The K-values stored in the fluid state are not used
+    // since they are not updated for single-phase cells.
+    template <class FlashFluidState, class Vector>
+    static bool farFromPhaseBoundary_(const FlashFluidState& fluid_state,
+                                      const Vector& z,
+                                      typename Vector::field_type margin,
+                                      Vector& K)
+    {
+        if (margin <= 0)
+            return false;
+
+        typename Vector::field_type sumzK = 0;
+        typename Vector::field_type sumzOverK = 0;
+        Vector K_wilson;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            K_wilson[compIdx] = wilsonK_(fluid_state, compIdx);
+            sumzK += z[compIdx]*K_wilson[compIdx];
+            sumzOverK += z[compIdx]/K_wilson[compIdx];
+        }
+
+        if ((sumzK < 1 - margin) || (sumzOverK < 1 - margin)) {
+            K = K_wilson;
+            return true;
+        }
+
+        return false;
+    }
+
     template <class Vector>
     static typename Vector::field_type rachfordRice_g_(const Vector& K, typename Vector::field_type L, const Vector& z)
     {
@@ -595,9 +749,8 @@ protected:
         }
     }
 
-    template <class FluidState, class ComponentVector>
+    template <PTFlashMethod method, class FluidState, class ComponentVector>
     static void flash_2ph(const ComponentVector& z_scalar,
-                          const std::string& flash_2p_method,
                           ComponentVector& K_scalar,
                           typename FluidState::Scalar& L_scalar,
                           FluidState& fluid_state_scalar,
@@ -609,28 +762,26 @@ protected:
         // Calculate composition using nonlinear solver
         // Newton
         bool converged = false;
-        if (flash_2p_method == "newton") {
+        if constexpr (method == PTFlashMethod::Newton) {
             if (verbosity >= 1) {
                 std::cout << "Calculate composition using Newton." << std::endl;
             }
             converged = newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity);
-        } else if (flash_2p_method == "ssi") {
+        } else if constexpr (method == PTFlashMethod::Ssi) {
             // Successive substitution
             if (verbosity >= 1) {
                 std::cout << "Calculate composition using Succcessive Substitution." << std::endl;
             }
             converged = successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, false, verbosity);
-        } else if (flash_2p_method == "ssi+newton") {
+        } else {
             converged = successiveSubstitutionComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, true, verbosity);
             if (!converged) {
                 converged = newtonComposition_(K_scalar, L_scalar, fluid_state_scalar, z_scalar, verbosity);
             }
-        } else {
-            throw std::logic_error("unknown two phase flash method " + flash_2p_method + " is specified");
         }
 
         if (!converged) {
-            throw std::runtime_error("flash calculation did not get converged with " + flash_2p_method);
+            throw std::runtime_error("flash calculation did not get converged with " + flashMethodName(method));
         }
     }
 
@@ -682,7 +833,7 @@ protected:
         // AD type
         using Eval = DenseAd::Evaluation<Scalar, num_primary_variables>;
         // TODO: we might need to use numMiscibleComponents here
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         Eval l;
 
         // TODO: I might not need to set soln anything here.
@@ -803,7 +954,7 @@ protected:
                                 Dune::FieldVector<double, num_equation>& res)
     {
         using Eval = DenseAd::Evaluation<double, num_primary>;
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             x[compIdx] = fluid_state.moleFraction(oilPhaseIdx, compIdx);
             y[compIdx] = fluid_state.moleFraction(gasPhaseIdx, compIdx);
@@ -854,7 +1005,7 @@ protected:
                                 Dune::FieldVector<double, num_equation>& res)
     {
         using Eval = DenseAd::Evaluation<double, num_primary>;
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             x[compIdx] = fluid_state.moleFraction(oilPhaseIdx, compIdx);
             y[compIdx] = fluid_state.moleFraction(gasPhaseIdx, compIdx);
@@ -1054,7 +1205,7 @@ protected:
 
         constexpr size_t num_deri = numComponents;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            std::vector<double> deri(num_deri, 0.);
+            std::array<double, num_deri> deri{};
             // derivatives from P
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deri[idx] = -sec_jac[compIdx][0] * p_l.derivative(idx);
@@ -1086,7 +1237,7 @@ protected:
             }
 
             // handling derivatives of L
-            std::vector<double> deriL(num_deri, 0.);
+            std::array<double, num_deri> deriL{};
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deriL[idx] = -sec_jac[2 * numComponents][0] * p_v.derivative(idx);
             }
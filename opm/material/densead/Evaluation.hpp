@@ -50,6 +50,11 @@ namespace DenseAd {
 //! is run-time determined
 static constexpr int DynamicSize = -1;
 
+//! Lazily evaluated expression of Evaluation objects, see
+//! EvaluationExpression.hpp
+template <class Eval, class Node>
+class Expression;
+
 /*!
  * \brief Represents a function evaluation and its derivatives w.r.t. a fixed set of
  *        variables.
@@ -117,6 +122,15 @@ public:
         checkDefined_();
     }
 
+    // evaluate an expression template, see EvaluationExpression.hpp
+    template <class Node>
+    Evaluation(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        checkDefined_();
+    }
+
     // create an evaluation which represents a constant function
     //
     // i.e., f(x) = c. this implies an evaluation with the given value and all
@@ -441,6 +455,14 @@ public:
         return *this;
     }
 
+    template <class Node>
+    Evaluation& operator=(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        return *this;
+    }
+
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
@@ -108,6 +108,15 @@ public:
         checkDefined_();
     }
 
+    // evaluate an expression template, see EvaluationExpression.hpp
+    template <class Node>
+    Evaluation(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        checkDefined_();
+    }
+
     // create an evaluation which represents a constant function
     //
     // i.e., f(x) = c. this implies an evaluation with the given value and all
@@ -505,6 +514,14 @@ public:
         return *this;
     }
 
+    template <class Node>
+    Evaluation& operator=(const Expression<Evaluation, Node>& expr)
+    {
+        expr.evaluateTo(*this);
+
+        return *this;
+    }
+
     // copy assignment from evaluation
     Evaluation& operator=(const Evaluation& other) = default;
 
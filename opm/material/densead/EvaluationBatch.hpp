@@ -0,0 +1,1191 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Function evaluations and their derivatives for a batch of
+ *        independent points, e.g. cells, stored lane by lane.
+ *
+ * An EvaluationBatch<Scalar, N, W> holds W evaluations with N derivatives
+ * each.  The values of all W points are stored contiguously, followed by
+ * the first derivative of all W points and so on.  All arithmetic and the
+ * functions of Math.hpp therefore run over W adjacent lanes, which the
+ * compiler maps to SIMD instructions, instead of over the few derivatives
+ * of a single point.
+ *
+ * Comparisons yield a BatchMask with one flag per lane, and select() picks
+ * the value of each lane from one of two batches according to a mask.
+ * Code which branches on the values has to use these instead of if
+ * statements.  Tabulated1DFunction, UniformXTabulated2DFunction and
+ * PiecewiseLinearTwoPhaseMaterial look up the segment of each lane
+ * separately, so the PVT classes and material laws which only branch
+ * through them, e.g. DeadOilPvt, work for batches.  Other code can still be
+ * evaluated per point through lane() and setLane().
+ */
+#ifndef OPM_DENSEAD_EVALUATION_BATCH_HPP
+#define OPM_DENSEAD_EVALUATION_BATCH_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief The result of a comparison of the lanes of an EvaluationBatch.
+ *
+ * Masks are combined lane by lane with &&, || and !.  A mask only converts
+ * to bool if all of its lanes agree, which is the case for assertions like
+ * assert(0.0 <= Sw && Sw <= 1.0).  A branch which is only taken by some
+ * lanes can not be expressed by a single bool, so converting a mask whose
+ * lanes disagree throws std::logic_error; such code has to use select().
+ */
+template <int width>
+class BatchMask
+{
+public:
+    //! all lanes unset
+    BatchMask() : lanes_()
+    {}
+
+    //! all lanes set to value
+    explicit BatchMask(bool value)
+    { lanes_.fill(value); }
+
+    bool operator[](int laneIdx) const
+    { return lanes_[laneIdx]; }
+
+    bool& operator[](int laneIdx)
+    { return lanes_[laneIdx]; }
+
+    //! whether all lanes are set
+    bool all() const
+    {
+        for (int l = 0; l < width; ++l)
+            if (!lanes_[l])
+                return false;
+
+        return true;
+    }
+
+    //! whether any lane is set
+    bool any() const
+    {
+        for (int l = 0; l < width; ++l)
+            if (lanes_[l])
+                return true;
+
+        return false;
+    }
+
+    explicit operator bool() const
+    {
+        const bool result = lanes_[0];
+        for (int l = 1; l < width; ++l)
+            if (lanes_[l] != result)
+                throw std::logic_error("Branching on EvaluationBatch lanes which do not agree");
+
+        return result;
+    }
+
+    BatchMask operator!() const
+    {
+        BatchMask result;
+        for (int l = 0; l < width; ++l)
+            result.lanes_[l] = !lanes_[l];
+
+        return result;
+    }
+
+    BatchMask operator&&(const BatchMask& other) const
+    {
+        BatchMask result;
+        for (int l = 0; l < width; ++l)
+            result.lanes_[l] = lanes_[l] && other.lanes_[l];
+
+        return result;
+    }
+
+    BatchMask operator||(const BatchMask& other) const
+    {
+        BatchMask result;
+        for (int l = 0; l < width; ++l)
+            result.lanes_[l] = lanes_[l] || other.lanes_[l];
+
+        return result;
+    }
+
+private:
+    std::array<bool, width> lanes_;
+};
+
+/*!
+ * \brief Represents the evaluations of a function and its derivatives w.r.t.
+ *        a fixed set of variables at a batch of independent points.
+ *
+ * Arithmetic operations act on each lane, i.e. each point, separately.
+ * Ordering comparisons, and comparisons with a scalar, yield a BatchMask,
+ * see there.  Comparing two batches for (in)equality compares all lanes and
+ * derivatives and yields a single bool.
+ */
+template <class ScalarT, int numDerivs, int width>
+class EvaluationBatch
+{
+    static_assert(numDerivs >= 0, "EvaluationBatch requires a static number of derivatives");
+    static_assert(width > 0, "EvaluationBatch requires at least one lane");
+
+public:
+    //! number of derivatives
+    static const int numVars = numDerivs;
+
+    //! number of points in the batch
+    static const int numLanes = width;
+
+    //! field type
+    typedef ScalarT Scalar;
+
+    //! values of all lanes
+    typedef std::array<Scalar, width> LaneValues;
+
+    //! one flag per lane
+    typedef BatchMask<width> LaneMask;
+
+    //! evaluation of a single lane
+    typedef Evaluation<Scalar, numDerivs> LaneEvaluation;
+
+    //! field type of the values
+    typedef LaneValues ValueType;
+
+    //! number of derivatives
+    constexpr int size() const
+    { return numDerivs; }
+
+    //! number of lanes
+    constexpr int lanes() const
+    { return width; }
+
+    //! default constructor, all values and derivatives are zero
+    EvaluationBatch() : data_()
+    {}
+
+    EvaluationBatch(const EvaluationBatch& other) = default;
+
+    // create an evaluation which represents the same constant function for
+    // all lanes
+    template <class RhsValueType,
+              class = std::enable_if_t<std::is_arithmetic<RhsValueType>::value>>
+    EvaluationBatch(const RhsValueType& c)
+    {
+        setValue(c);
+        clearDerivatives();
+    }
+
+    // create an evaluation which represents a constant function with a
+    // separate value for each lane
+    EvaluationBatch(const LaneValues& c)
+    {
+        setValue(c);
+        clearDerivatives();
+    }
+
+    // create an evaluation of the variable with index varPos
+    template <class RhsValueType>
+    EvaluationBatch(const RhsValueType& c, int varPos)
+    {
+        assert(0 <= varPos && varPos < size());
+
+        setValue(c);
+        clearDerivatives();
+
+        data_[varPos + 1].fill(1.0);
+    }
+
+    // set all derivatives to zero
+    void clearDerivatives()
+    {
+        for (int i = 1; i < length_(); ++i)
+            data_[i].fill(0.0);
+    }
+
+    static EvaluationBatch createBlank(const EvaluationBatch&)
+    { return EvaluationBatch(); }
+
+    static EvaluationBatch createConstantZero(const EvaluationBatch&)
+    { return EvaluationBatch(0.); }
+
+    static EvaluationBatch createConstantOne(const EvaluationBatch&)
+    { return EvaluationBatch(1.); }
+
+    template <class RhsValueType>
+    static EvaluationBatch createVariable(const RhsValueType& value, int varPos)
+    { return EvaluationBatch(value, varPos); }
+
+    template <class RhsValueType>
+    static EvaluationBatch createVariable(const EvaluationBatch&, const RhsValueType& value, int varPos)
+    { return EvaluationBatch(value, varPos); }
+
+    template <class RhsValueType>
+    static EvaluationBatch createConstant(const RhsValueType& value)
+    { return EvaluationBatch(value); }
+
+    template <class RhsValueType>
+    static EvaluationBatch createConstant(int nVars, const RhsValueType& value)
+    {
+        if (nVars != 0)
+            throw std::logic_error("This statically-sized evaluation can only represent objects"
+                                   " with 0 derivatives");
+        return EvaluationBatch(value);
+    }
+
+    template <class RhsValueType>
+    static EvaluationBatch createConstant(const EvaluationBatch&, const RhsValueType& value)
+    { return EvaluationBatch(value); }
+
+    // copy all derivatives from other
+    void copyDerivatives(const EvaluationBatch& other)
+    {
+        for (int i = 1; i < length_(); ++i)
+            data_[i] = other.data_[i];
+    }
+
+    EvaluationBatch& operator+=(const EvaluationBatch& other)
+    {
+        for (int i = 0; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] += other.data_[i][l];
+
+        return *this;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch& operator+=(const RhsValueType& other)
+    {
+        // value is added, derivatives stay the same
+        for (int l = 0; l < width; ++l)
+            data_[0][l] += other;
+
+        return *this;
+    }
+
+    EvaluationBatch& operator-=(const EvaluationBatch& other)
+    {
+        for (int i = 0; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] -= other.data_[i][l];
+
+        return *this;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch& operator-=(const RhsValueType& other)
+    {
+        for (int l = 0; l < width; ++l)
+            data_[0][l] -= other;
+
+        return *this;
+    }
+
+    // (u*v)' = (v'u + u'v)
+    EvaluationBatch& operator*=(const EvaluationBatch& other)
+    {
+        const LaneValues u = data_[0];
+        const LaneValues& v = other.data_[0];
+
+        for (int l = 0; l < width; ++l)
+            data_[0][l] *= v[l];
+
+        for (int i = 1; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] = data_[i][l]*v[l] + other.data_[i][l]*u[l];
+
+        return *this;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch& operator*=(const RhsValueType& other)
+    {
+        for (int i = 0; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] *= other;
+
+        return *this;
+    }
+
+    // (u/v)' = (vu' - uv')/v^2
+    EvaluationBatch& operator/=(const EvaluationBatch& other)
+    {
+        const LaneValues& v = other.data_[0];
+
+        LaneValues u;
+        LaneValues invV;
+        for (int l = 0; l < width; ++l) {
+            invV[l] = 1.0/v[l];
+            u[l] = data_[0][l]*invV[l];
+            data_[0][l] = u[l];
+        }
+
+        for (int i = 1; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] = (data_[i][l] - u[l]*other.data_[i][l])*invV[l];
+
+        return *this;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch& operator/=(const RhsValueType& other)
+    {
+        const Scalar tmp = 1.0/other;
+
+        for (int i = 0; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                data_[i][l] *= tmp;
+
+        return *this;
+    }
+
+    EvaluationBatch operator+(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result += other;
+        return result;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch operator+(const RhsValueType& other) const
+    {
+        EvaluationBatch result(*this);
+        result += other;
+        return result;
+    }
+
+    EvaluationBatch operator-(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result -= other;
+        return result;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch operator-(const RhsValueType& other) const
+    {
+        EvaluationBatch result(*this);
+        result -= other;
+        return result;
+    }
+
+    EvaluationBatch operator-() const
+    {
+        EvaluationBatch result;
+
+        for (int i = 0; i < length_(); ++i)
+            for (int l = 0; l < width; ++l)
+                result.data_[i][l] = -data_[i][l];
+
+        return result;
+    }
+
+    EvaluationBatch operator*(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result *= other;
+        return result;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch operator*(const RhsValueType& other) const
+    {
+        EvaluationBatch result(*this);
+        result *= other;
+        return result;
+    }
+
+    EvaluationBatch operator/(const EvaluationBatch& other) const
+    {
+        EvaluationBatch result(*this);
+        result /= other;
+        return result;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch operator/(const RhsValueType& other) const
+    {
+        EvaluationBatch result(*this);
+        result /= other;
+        return result;
+    }
+
+    template <class RhsValueType>
+    EvaluationBatch& operator=(const RhsValueType& other)
+    {
+        setValue(other);
+        clearDerivatives();
+
+        return *this;
+    }
+
+    EvaluationBatch& operator=(const EvaluationBatch& other) = default;
+
+    // comparisons of the values, lane by lane
+    template <class RhsValueType>
+    LaneMask operator==(const RhsValueType& other) const
+    { return compare_(value(), other, [](Scalar a, Scalar b) { return a == b; }); }
+
+    bool operator==(const EvaluationBatch& other) const
+    {
+        for (int i = 0; i < length_(); ++i)
+            if (data_[i] != other.data_[i])
+                return false;
+
+        return true;
+    }
+
+    bool operator!=(const EvaluationBatch& other) const
+    { return !operator==(other); }
+
+    template <class RhsValueType>
+    LaneMask operator!=(const RhsValueType& other) const
+    { return !operator==(other); }
+
+    template <class RhsValueType>
+    LaneMask operator>(const RhsValueType& other) const
+    { return compare_(value(), other, [](Scalar a, Scalar b) { return a > b; }); }
+
+    LaneMask operator>(const EvaluationBatch& other) const
+    { return compare_(value(), other.value(), [](Scalar a, Scalar b) { return a > b; }); }
+
+    template <class RhsValueType>
+    LaneMask operator<(const RhsValueType& other) const
+    { return compare_(value(), other, [](Scalar a, Scalar b) { return a < b; }); }
+
+    LaneMask operator<(const EvaluationBatch& other) const
+    { return compare_(value(), other.value(), [](Scalar a, Scalar b) { return a < b; }); }
+
+    template <class RhsValueType>
+    LaneMask operator>=(const RhsValueType& other) const
+    { return compare_(value(), other, [](Scalar a, Scalar b) { return a >= b; }); }
+
+    LaneMask operator>=(const EvaluationBatch& other) const
+    { return compare_(value(), other.value(), [](Scalar a, Scalar b) { return a >= b; }); }
+
+    template <class RhsValueType>
+    LaneMask operator<=(const RhsValueType& other) const
+    { return compare_(value(), other, [](Scalar a, Scalar b) { return a <= b; }); }
+
+    LaneMask operator<=(const EvaluationBatch& other) const
+    { return compare_(value(), other.value(), [](Scalar a, Scalar b) { return a <= b; }); }
+
+    // return the values of all lanes
+    const LaneValues& value() const
+    { return data_[0]; }
+
+    // set the value of all lanes
+    template <class RhsValueType>
+    void setValue(const RhsValueType& val)
+    { data_[0].fill(val); }
+
+    void setValue(const LaneValues& val)
+    { data_[0] = val; }
+
+    // return varIdx'th derivative of all lanes
+    const LaneValues& derivative(int varIdx) const
+    {
+        assert(0 <= varIdx && varIdx < size());
+
+        return data_[varIdx + 1];
+    }
+
+    void setDerivative(int varIdx, const LaneValues& derVal)
+    {
+        assert(0 <= varIdx && varIdx < size());
+
+        data_[varIdx + 1] = derVal;
+    }
+
+    // return the evaluation of a single lane
+    LaneEvaluation lane(int laneIdx) const
+    {
+        assert(0 <= laneIdx && laneIdx < width);
+
+        LaneEvaluation result;
+        result.setValue(data_[0][laneIdx]);
+        for (int varIdx = 0; varIdx < numDerivs; ++varIdx)
+            result.setDerivative(varIdx, data_[varIdx + 1][laneIdx]);
+
+        return result;
+    }
+
+    // set the evaluation of a single lane
+    void setLane(int laneIdx, const LaneEvaluation& eval)
+    {
+        assert(0 <= laneIdx && laneIdx < width);
+
+        data_[0][laneIdx] = eval.value();
+        for (int varIdx = 0; varIdx < numDerivs; ++varIdx)
+            data_[varIdx + 1][laneIdx] = eval.derivative(varIdx);
+    }
+
+private:
+    constexpr int length_() const
+    { return numDerivs + 1; }
+
+    template <class Compare>
+    static LaneMask compare_(const LaneValues& a, const Scalar& b, Compare compare)
+    {
+        LaneMask result;
+        for (int l = 0; l < width; ++l)
+            result[l] = compare(a[l], b);
+
+        return result;
+    }
+
+    template <class Compare>
+    static LaneMask compare_(const LaneValues& a, const LaneValues& b, Compare compare)
+    {
+        LaneMask result;
+        for (int l = 0; l < width; ++l)
+            result[l] = compare(a[l], b[l]);
+
+        return result;
+    }
+
+    alignas(64) std::array<LaneValues, numDerivs + 1> data_;
+};
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+BatchMask<width> operator<(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{ return b > a; }
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+BatchMask<width> operator>(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{ return b < a; }
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+BatchMask<width> operator<=(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{ return b >= a; }
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+BatchMask<width> operator>=(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{ return b <= a; }
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+BatchMask<width> operator!=(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{ return b != a; }
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+operator+(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{
+    EvaluationBatch<Scalar, numVars, width> result(b);
+    result += a;
+    return result;
+}
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+operator-(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{
+    return -(b - a);
+}
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+operator/(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{
+    EvaluationBatch<Scalar, numVars, width> tmp(a);
+    tmp /= b;
+    return tmp;
+}
+
+template <class RhsValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+operator*(const RhsValueType& a, const EvaluationBatch<Scalar, numVars, width>& b)
+{
+    EvaluationBatch<Scalar, numVars, width> result(b);
+    result *= a;
+    return result;
+}
+
+namespace detail {
+
+// Applies the chain rule for a function with the given values and
+// derivatives df/dx at the points of x.
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+chainRule(const EvaluationBatch<Scalar, numVars, width>& x,
+          const typename EvaluationBatch<Scalar, numVars, width>::LaneValues& f,
+          const typename EvaluationBatch<Scalar, numVars, width>::LaneValues& df_dx)
+{
+    EvaluationBatch<Scalar, numVars, width> result;
+    result.setValue(f);
+
+    std::array<Scalar, width> deriv;
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        const auto& xPrime = x.derivative(varIdx);
+        for (int l = 0; l < width; ++l)
+            deriv[l] = df_dx[l]*xPrime[l];
+
+        result.setDerivative(varIdx, deriv);
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+//! The lanes of x1 where mask is set, and the lanes of x2 otherwise.
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+select(const BatchMask<width>& mask,
+       const EvaluationBatch<Scalar, numVars, width>& x1,
+       const EvaluationBatch<Scalar, numVars, width>& x2)
+{
+    EvaluationBatch<Scalar, numVars, width> result;
+
+    std::array<Scalar, width> tmp;
+    for (int l = 0; l < width; ++l)
+        tmp[l] = mask[l] ? x1.value()[l] : x2.value()[l];
+    result.setValue(tmp);
+
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        for (int l = 0; l < width; ++l)
+            tmp[l] = mask[l] ? x1.derivative(varIdx)[l] : x2.derivative(varIdx)[l];
+
+        result.setDerivative(varIdx, tmp);
+    }
+
+    return result;
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+select(const BatchMask<width>& mask,
+       const Scalar& x1,
+       const EvaluationBatch<Scalar, numVars, width>& x2)
+{ return select(mask, EvaluationBatch<Scalar, numVars, width>(x1), x2); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width>
+select(const BatchMask<width>& mask,
+       const EvaluationBatch<Scalar, numVars, width>& x1,
+       const Scalar& x2)
+{ return select(mask, x1, EvaluationBatch<Scalar, numVars, width>(x2)); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> abs(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    typename EvaluationBatch<Scalar, numVars, width>::LaneMask positive;
+    for (int l = 0; l < width; ++l)
+        positive[l] = x.value()[l] > 0.0;
+
+    return select(positive, x, -x);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> min(const EvaluationBatch<Scalar, numVars, width>& x1,
+                                            const EvaluationBatch<Scalar, numVars, width>& x2)
+{
+    typename EvaluationBatch<Scalar, numVars, width>::LaneMask less;
+    for (int l = 0; l < width; ++l)
+        less[l] = x1.value()[l] < x2.value()[l];
+
+    return select(less, x1, x2);
+}
+
+template <class Arg1ValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> min(const Arg1ValueType& x1,
+                                            const EvaluationBatch<Scalar, numVars, width>& x2)
+{ return min(EvaluationBatch<Scalar, numVars, width>(x1), x2); }
+
+template <class Scalar, int numVars, int width, class Arg2ValueType>
+EvaluationBatch<Scalar, numVars, width> min(const EvaluationBatch<Scalar, numVars, width>& x1,
+                                            const Arg2ValueType& x2)
+{ return min(x2, x1); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> max(const EvaluationBatch<Scalar, numVars, width>& x1,
+                                            const EvaluationBatch<Scalar, numVars, width>& x2)
+{
+    typename EvaluationBatch<Scalar, numVars, width>::LaneMask greater;
+    for (int l = 0; l < width; ++l)
+        greater[l] = x1.value()[l] > x2.value()[l];
+
+    return select(greater, x1, x2);
+}
+
+template <class Arg1ValueType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> max(const Arg1ValueType& x1,
+                                            const EvaluationBatch<Scalar, numVars, width>& x2)
+{ return max(EvaluationBatch<Scalar, numVars, width>(x1), x2); }
+
+template <class Scalar, int numVars, int width, class Arg2ValueType>
+EvaluationBatch<Scalar, numVars, width> max(const EvaluationBatch<Scalar, numVars, width>& x1,
+                                            const Arg2ValueType& x2)
+{ return max(x2, x1); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> tan(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::tan(x.value()[l]);
+        df_dx[l] = 1 + f[l]*f[l];
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> atan(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::atan(x.value()[l]);
+        df_dx[l] = 1/(1 + x.value()[l]*x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> atan2(const EvaluationBatch<Scalar, numVars, width>& x,
+                                              const EvaluationBatch<Scalar, numVars, width>& y)
+{
+    EvaluationBatch<Scalar, numVars, width> result;
+
+    std::array<Scalar, width> tmp;
+    for (int l = 0; l < width; ++l)
+        tmp[l] = std::atan2(x.value()[l], y.value()[l]);
+    result.setValue(tmp);
+
+    // atan2(x, y)' = (y*x' - x*y')/(x^2 + y^2)
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        for (int l = 0; l < width; ++l) {
+            const Scalar xv = x.value()[l];
+            const Scalar yv = y.value()[l];
+            tmp[l] = (yv*x.derivative(varIdx)[l] - xv*y.derivative(varIdx)[l])/(xv*xv + yv*yv);
+        }
+
+        result.setDerivative(varIdx, tmp);
+    }
+
+    return result;
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> atan2(const EvaluationBatch<Scalar, numVars, width>& x,
+                                              const Scalar& y)
+{ return atan2(x, EvaluationBatch<Scalar, numVars, width>(y)); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> atan2(const Scalar& x,
+                                              const EvaluationBatch<Scalar, numVars, width>& y)
+{ return atan2(EvaluationBatch<Scalar, numVars, width>(x), y); }
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> sin(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::sin(x.value()[l]);
+        df_dx[l] = std::cos(x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> asin(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::asin(x.value()[l]);
+        df_dx[l] = 1.0/std::sqrt(1 - x.value()[l]*x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> sinh(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::sinh(x.value()[l]);
+        df_dx[l] = std::cosh(x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> asinh(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::asinh(x.value()[l]);
+        df_dx[l] = 1.0/std::sqrt(x.value()[l]*x.value()[l] + 1);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> cos(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::cos(x.value()[l]);
+        df_dx[l] = -std::sin(x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> acos(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::acos(x.value()[l]);
+        df_dx[l] = -1.0/std::sqrt(1 - x.value()[l]*x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> cosh(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::cosh(x.value()[l]);
+        df_dx[l] = std::sinh(x.value()[l]);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> acosh(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::acosh(x.value()[l]);
+        df_dx[l] = 1.0/std::sqrt(x.value()[l]*x.value()[l] - 1);
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> sqrt(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::sqrt(x.value()[l]);
+        df_dx[l] = 0.5/f[l];
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> exp(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f;
+    for (int l = 0; l < width; ++l)
+        f[l] = std::exp(x.value()[l]);
+
+    return detail::chainRule(x, f, f);
+}
+
+// exponentiation of arbitrary base with a fixed constant
+template <class Scalar, int numVars, int width, class ExpType>
+EvaluationBatch<Scalar, numVars, width> pow(const EvaluationBatch<Scalar, numVars, width>& base,
+                                            const ExpType& exp)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        const Scalar b = base.value()[l];
+
+        // the lanes where the base is 0 are special cased as in the scalar
+        // version, since the generic code leads to NaNs
+        f[l] = (b == 0.0) ? 0.0 : std::pow(b, exp);
+        df_dx[l] = (b == 0.0) ? 0.0 : f[l]/b*exp;
+    }
+
+    return detail::chainRule(base, f, df_dx);
+}
+
+// exponentiation of constant base with an arbitrary exponent
+template <class BaseType, class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> pow(const BaseType& base,
+                                            const EvaluationBatch<Scalar, numVars, width>& exp)
+{
+    if (base == 0.0)
+        return EvaluationBatch<Scalar, numVars, width>(0.0);
+
+    const Scalar lnBase = std::log(base);
+
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::exp(lnBase*exp.value()[l]);
+        df_dx[l] = lnBase*f[l];
+    }
+
+    return detail::chainRule(exp, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> pow(const EvaluationBatch<Scalar, numVars, width>& base,
+                                            const EvaluationBatch<Scalar, numVars, width>& exp)
+{
+    EvaluationBatch<Scalar, numVars, width> result;
+
+    std::array<Scalar, width> valuePow, logF;
+    for (int l = 0; l < width; ++l) {
+        const Scalar f = base.value()[l];
+        valuePow[l] = (f == 0.0) ? 0.0 : std::pow(f, exp.value()[l]);
+        logF[l] = (f == 0.0) ? 0.0 : std::log(f);
+    }
+    result.setValue(valuePow);
+
+    std::array<Scalar, width> tmp;
+    for (int varIdx = 0; varIdx < numVars; ++varIdx) {
+        for (int l = 0; l < width; ++l) {
+            const Scalar f = base.value()[l];
+            const Scalar g = exp.value()[l];
+            tmp[l] = (f == 0.0)
+                ? 0.0
+                : (g*base.derivative(varIdx)[l]/f + logF[l]*exp.derivative(varIdx)[l])*valuePow[l];
+        }
+
+        result.setDerivative(varIdx, tmp);
+    }
+
+    return result;
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> log(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::log(x.value()[l]);
+        df_dx[l] = 1/x.value()[l];
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+template <class Scalar, int numVars, int width>
+EvaluationBatch<Scalar, numVars, width> log10(const EvaluationBatch<Scalar, numVars, width>& x)
+{
+    const Scalar log10e = std::log10(std::exp(Scalar{1.0}));
+
+    std::array<Scalar, width> f, df_dx;
+    for (int l = 0; l < width; ++l) {
+        f[l] = std::log10(x.value()[l]);
+        df_dx[l] = log10e/x.value()[l];
+    }
+
+    return detail::chainRule(x, f, df_dx);
+}
+
+} // namespace DenseAd
+
+// Allows code to be instantiated for batches.  The value of a batch is an
+// array of lanes, so code which needs a single scalar value, e.g. through
+// scalarValue(), does not compile.
+template <class ScalarT, int numVars, int width>
+struct MathToolbox<DenseAd::EvaluationBatch<ScalarT, numVars, width> >
+{
+public:
+    typedef DenseAd::EvaluationBatch<ScalarT, numVars, width> Evaluation;
+    typedef typename Evaluation::LaneValues ValueType;
+    typedef MathToolbox<ScalarT> InnerToolbox;
+    typedef ScalarT Scalar;
+
+    static const ValueType& value(const Evaluation& eval)
+    { return eval.value(); }
+
+    static Evaluation createBlank(const Evaluation& x)
+    { return Evaluation::createBlank(x); }
+
+    static Evaluation createConstantZero(const Evaluation& x)
+    { return Evaluation::createConstantZero(x); }
+
+    static Evaluation createConstantOne(const Evaluation& x)
+    { return Evaluation::createConstantOne(x); }
+
+    static Evaluation createConstant(Scalar value)
+    { return Evaluation::createConstant(value); }
+
+    static Evaluation createConstant(const ValueType& value)
+    { return Evaluation::createConstant(value); }
+
+    static Evaluation createConstant(unsigned numDeriv, const Scalar value)
+    { return Evaluation::createConstant(numDeriv, value); }
+
+    static Evaluation createConstant(const Evaluation& x, const Scalar value)
+    { return Evaluation::createConstant(x, value); }
+
+    static Evaluation createVariable(Scalar value, int varIdx)
+    { return Evaluation::createVariable(value, varIdx); }
+
+    static Evaluation createVariable(const ValueType& value, int varIdx)
+    { return Evaluation::createVariable(value, varIdx); }
+
+    // The lanes can not be decayed to a single scalar.
+    template <class LhsEval>
+    static typename std::enable_if<std::is_same<Evaluation, LhsEval>::value,
+                                   LhsEval>::type
+    decay(const Evaluation& eval)
+    { return eval; }
+
+    static bool isSame(const Evaluation& a, const Evaluation& b, Scalar tolerance)
+    {
+        for (int l = 0; l < width; ++l) {
+            if (!InnerToolbox::isSame(a.value()[l], b.value()[l], tolerance))
+                return false;
+
+            for (int curVarIdx = 0; curVarIdx < numVars; ++curVarIdx)
+                if (!InnerToolbox::isSame(a.derivative(curVarIdx)[l], b.derivative(curVarIdx)[l], tolerance))
+                    return false;
+        }
+
+        return true;
+    }
+
+    // arithmetic functions
+    template <class Arg1Eval, class Arg2Eval>
+    static Evaluation max(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    { return DenseAd::max(arg1, arg2); }
+
+    template <class Arg1Eval, class Arg2Eval>
+    static Evaluation min(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    { return DenseAd::min(arg1, arg2); }
+
+    static Evaluation abs(const Evaluation& arg)
+    { return DenseAd::abs(arg); }
+
+    static Evaluation tan(const Evaluation& arg)
+    { return DenseAd::tan(arg); }
+
+    static Evaluation atan(const Evaluation& arg)
+    { return DenseAd::atan(arg); }
+
+    static Evaluation atan2(const Evaluation& arg1, const Evaluation& arg2)
+    { return DenseAd::atan2(arg1, arg2); }
+
+    static Evaluation atan2(const Evaluation& arg1, const Scalar& arg2)
+    { return DenseAd::atan2(arg1, arg2); }
+
+    static Evaluation atan2(const Scalar& arg1, const Evaluation& arg2)
+    { return DenseAd::atan2(arg1, arg2); }
+
+    static Evaluation sin(const Evaluation& arg)
+    { return DenseAd::sin(arg); }
+
+    static Evaluation asin(const Evaluation& arg)
+    { return DenseAd::asin(arg); }
+
+    static Evaluation sinh(const Evaluation& arg)
+    { return DenseAd::sinh(arg); }
+
+    static Evaluation asinh(const Evaluation& arg)
+    { return DenseAd::asinh(arg); }
+
+    static Evaluation cos(const Evaluation& arg)
+    { return DenseAd::cos(arg); }
+
+    static Evaluation acos(const Evaluation& arg)
+    { return DenseAd::acos(arg); }
+
+    static Evaluation cosh(const Evaluation& arg)
+    { return DenseAd::cosh(arg); }
+
+    static Evaluation acosh(const Evaluation& arg)
+    { return DenseAd::acosh(arg); }
+
+    static Evaluation sqrt(const Evaluation& arg)
+    { return DenseAd::sqrt(arg); }
+
+    static Evaluation exp(const Evaluation& arg)
+    { return DenseAd::exp(arg); }
+
+    static Evaluation log(const Evaluation& arg)
+    { return DenseAd::log(arg); }
+
+    static Evaluation log10(const Evaluation& arg)
+    { return DenseAd::log10(arg); }
+
+    template <class RhsValueType>
+    static Evaluation pow(const Evaluation& arg1, const RhsValueType& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    template <class RhsValueType>
+    static Evaluation pow(const RhsValueType& arg1, const Evaluation& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    static Evaluation pow(const Evaluation& arg1, const Evaluation& arg2)
+    { return DenseAd::pow(arg1, arg2); }
+
+    static bool isfinite(const Evaluation& arg)
+    {
+        for (int l = 0; l < width; ++l) {
+            if (!InnerToolbox::isfinite(arg.value()[l]))
+                return false;
+
+            for (int i = 0; i < numVars; ++i)
+                if (!InnerToolbox::isfinite(arg.derivative(i)[l]))
+                    return false;
+        }
+
+        return true;
+    }
+
+    static bool isnan(const Evaluation& arg)
+    {
+        for (int l = 0; l < width; ++l) {
+            if (InnerToolbox::isnan(arg.value()[l]))
+                return true;
+
+            for (int i = 0; i < numVars; ++i)
+                if (InnerToolbox::isnan(arg.derivative(i)[l]))
+                    return true;
+        }
+
+        return false;
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EVALUATION_BATCH_HPP
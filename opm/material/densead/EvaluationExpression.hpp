@@ -0,0 +1,579 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Expression templates for the dense-AD Evaluation class.
+ *
+ * Arithmetic on Evaluation objects creates a new Evaluation for every
+ * operation, each of which loops over all derivatives.  Wrapping the operands
+ * of a formula by lazy() instead builds an expression tree: the values of all
+ * nodes are computed immediately, but the derivatives are only computed when
+ * the expression is assigned to an Evaluation, in a single loop over the
+ * derivatives without any intermediate Evaluation objects.
+ *
+ * \code
+ * const auto x = DenseAd::lazy(xEval);
+ * Evaluation f = x*x*exp(2*x) + y;
+ * \endcode
+ *
+ * lazy() returns its argument unchanged for plain scalars and for evaluation
+ * types without a static number of derivatives, so generic code stays valid
+ * for these.  Expressions refer to the lvalue Evaluation objects they are
+ * built from, and must hence not outlive them.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_EXPRESSION_HPP
+#define OPM_DENSEAD_EVALUATION_EXPRESSION_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief A lazily evaluated expression of Evaluation objects.
+ *
+ * The value of the expression is known, its derivatives are computed from
+ * the ones of the leaves of the Node tree when the expression is assigned to
+ * an Evaluation.
+ */
+template <class Eval, class Node>
+class Expression
+{
+public:
+    //! field type
+    typedef typename Eval::ValueType Scalar;
+
+    //! the type of Evaluation the expression evaluates to
+    typedef Eval EvaluationType;
+
+    explicit Expression(const Node& node)
+        : node_(node)
+    {}
+
+    const Node& node() const
+    { return node_; }
+
+    Scalar value() const
+    { return node_.value(); }
+
+    Scalar derivative(int varIdx) const
+    { return node_.derivative(varIdx); }
+
+    // compute value and derivatives of the expression
+    void evaluateTo(Eval& result) const
+    {
+        result.setValue(node_.value());
+        for (int varIdx = 0; varIdx < Eval::numVars; ++varIdx)
+            result.setDerivative(varIdx, node_.derivative(varIdx));
+    }
+
+    Eval evaluate() const
+    { return Eval(*this); }
+
+private:
+    Node node_;
+};
+
+namespace ExpressionNodes {
+
+// An lvalue Evaluation object.
+template <class Eval>
+class Reference
+{
+public:
+    typedef typename Eval::ValueType Scalar;
+
+    explicit Reference(const Eval& eval)
+        : eval_(&eval)
+    {}
+
+    Scalar value() const
+    { return eval_->value(); }
+
+    Scalar derivative(int varIdx) const
+    { return eval_->derivative(varIdx); }
+
+private:
+    const Eval* eval_;
+};
+
+// A temporary Evaluation object, which is stored in the expression.
+template <class Eval>
+class Temporary
+{
+public:
+    typedef typename Eval::ValueType Scalar;
+
+    explicit Temporary(Eval&& eval)
+        : eval_(std::move(eval))
+    {}
+
+    Scalar value() const
+    { return eval_.value(); }
+
+    Scalar derivative(int varIdx) const
+    { return eval_.derivative(varIdx); }
+
+private:
+    Eval eval_;
+};
+
+// Child plus a constant, or a constant minus child: f' = child' or -child'.
+template <class Scalar, class Child, bool negate>
+class Shift
+{
+public:
+    Shift(const Scalar& value, const Child& child)
+        : value_(value), child_(child)
+    {}
+
+    Scalar value() const
+    { return value_; }
+
+    Scalar derivative(int varIdx) const
+    { return negate ? -child_.derivative(varIdx) : child_.derivative(varIdx); }
+
+private:
+    Scalar value_;
+    Child child_;
+};
+
+// Function of a single argument: f' = df/dx * child'.
+template <class Scalar, class Child>
+class Scale
+{
+public:
+    Scale(const Scalar& value, const Scalar& df_dx, const Child& child)
+        : value_(value), df_dx_(df_dx), child_(child)
+    {}
+
+    Scalar value() const
+    { return value_; }
+
+    Scalar derivative(int varIdx) const
+    { return df_dx_*child_.derivative(varIdx); }
+
+private:
+    Scalar value_;
+    Scalar df_dx_;
+    Child child_;
+};
+
+// Sum or difference: f' = left' + right' or left' - right'.
+template <class Scalar, class Left, class Right, bool subtract>
+class Sum
+{
+public:
+    Sum(const Scalar& value, const Left& left, const Right& right)
+        : value_(value), left_(left), right_(right)
+    {}
+
+    Scalar value() const
+    { return value_; }
+
+    Scalar derivative(int varIdx) const
+    {
+        return subtract
+            ? left_.derivative(varIdx) - right_.derivative(varIdx)
+            : left_.derivative(varIdx) + right_.derivative(varIdx);
+    }
+
+private:
+    Scalar value_;
+    Left left_;
+    Right right_;
+};
+
+// Function of two arguments: f' = df/dl * left' + df/dr * right'.
+template <class Scalar, class Left, class Right>
+class Combination
+{
+public:
+    Combination(const Scalar& value,
+                const Scalar& df_dl, const Scalar& df_dr,
+                const Left& left, const Right& right)
+        : value_(value), df_dl_(df_dl), df_dr_(df_dr), left_(left), right_(right)
+    {}
+
+    Scalar value() const
+    { return value_; }
+
+    Scalar derivative(int varIdx) const
+    { return df_dl_*left_.derivative(varIdx) + df_dr_*right_.derivative(varIdx); }
+
+private:
+    Scalar value_;
+    Scalar df_dl_;
+    Scalar df_dr_;
+    Left left_;
+    Right right_;
+};
+
+template <class Eval, class Node>
+const Node& node(const Expression<Eval, Node>& x)
+{ return x.node(); }
+
+template <class Eval>
+Reference<Eval> node(const Eval& x)
+{ return Reference<Eval>(x); }
+
+template <class Eval, class = std::enable_if_t<!std::is_lvalue_reference<Eval>::value>>
+Temporary<Eval> node(Eval&& x)
+{ return Temporary<Eval>(std::move(x)); }
+
+template <class Eval, class Node>
+Expression<Eval, Node> wrap(const Node& node)
+{ return Expression<Eval, Node>(node); }
+
+template <class Eval, class Left, class Right>
+auto add(const Left& left, const Right& right)
+{
+    typedef typename Eval::ValueType Scalar;
+    return wrap<Eval>(Sum<Scalar, Left, Right, false>(left.value() + right.value(), left, right));
+}
+
+template <class Eval, class Left, class Right>
+auto subtract(const Left& left, const Right& right)
+{
+    typedef typename Eval::ValueType Scalar;
+    return wrap<Eval>(Sum<Scalar, Left, Right, true>(left.value() - right.value(), left, right));
+}
+
+// (u*v)' = v*u' + u*v'
+template <class Eval, class Left, class Right>
+auto multiply(const Left& left, const Right& right)
+{
+    typedef typename Eval::ValueType Scalar;
+    const Scalar u = left.value();
+    const Scalar v = right.value();
+    return wrap<Eval>(Combination<Scalar, Left, Right>(u*v, v, u, left, right));
+}
+
+// (u/v)' = u'/v - u/v * v'/v
+template <class Eval, class Left, class Right>
+auto divide(const Left& left, const Right& right)
+{
+    typedef typename Eval::ValueType Scalar;
+    const Scalar invV = 1.0/right.value();
+    const Scalar f = left.value()*invV;
+    return wrap<Eval>(Combination<Scalar, Left, Right>(f, invV, -f*invV, left, right));
+}
+
+template <class Eval, class Child>
+auto shift(const typename Eval::ValueType& value, const Child& child)
+{ return wrap<Eval>(Shift<typename Eval::ValueType, Child, false>(value, child)); }
+
+template <class Eval, class Child>
+auto negate(const typename Eval::ValueType& value, const Child& child)
+{ return wrap<Eval>(Shift<typename Eval::ValueType, Child, true>(value, child)); }
+
+template <class Eval, class Child>
+auto scale(const typename Eval::ValueType& value,
+           const typename Eval::ValueType& df_dx,
+           const Child& child)
+{ return wrap<Eval>(Scale<typename Eval::ValueType, Child>(value, df_dx, child)); }
+
+template <class Eval, class Left, class Right>
+auto combine(const typename Eval::ValueType& value,
+             const typename Eval::ValueType& df_dl,
+             const typename Eval::ValueType& df_dr,
+             const Left& left, const Right& right)
+{
+    typedef typename Eval::ValueType Scalar;
+    return wrap<Eval>(Combination<Scalar, Left, Right>(value, df_dl, df_dr, left, right));
+}
+
+} // namespace ExpressionNodes
+
+/*!
+ * \brief Start an expression from an Evaluation.
+ *
+ * For other types, in particular plain scalars, the argument is returned
+ * unchanged so that the same formula can be used for all evaluation types.
+ */
+template <class ValueType, int numVars, unsigned staticSize,
+          class = std::enable_if_t<(numVars >= 0)>>
+Expression<Evaluation<ValueType, numVars, staticSize>,
+           ExpressionNodes::Reference<Evaluation<ValueType, numVars, staticSize>>>
+lazy(const Evaluation<ValueType, numVars, staticSize>& x)
+{ return ExpressionNodes::wrap<Evaluation<ValueType, numVars, staticSize>>(ExpressionNodes::node(x)); }
+
+template <class ValueType, int numVars, unsigned staticSize,
+          class = std::enable_if_t<(numVars >= 0)>>
+Expression<Evaluation<ValueType, numVars, staticSize>,
+           ExpressionNodes::Temporary<Evaluation<ValueType, numVars, staticSize>>>
+lazy(Evaluation<ValueType, numVars, staticSize>&& x)
+{ return ExpressionNodes::wrap<Evaluation<ValueType, numVars, staticSize>>(ExpressionNodes::node(std::move(x))); }
+
+template <class T>
+const T& lazy(const T& x)
+{ return x; }
+
+template <class Eval, class Node>
+const Expression<Eval, Node>& lazy(const Expression<Eval, Node>& x)
+{ return x; }
+
+// The binary operators are defined for any combination of an expression with
+// another expression, an Evaluation of the same type or a scalar.  The
+// overloads for Evaluation arguments spell out the Evaluation template, so
+// that they are more specialized than the mixed scalar-Evaluation operators
+// of the Evaluation class.
+#define OPM_DENSEAD_EXPRESSION_OPERATOR(OP, FUNCTION)                       \
+    template <class Eval, class Left, class Right>                          \
+    auto operator OP(const Expression<Eval, Left>& a,                       \
+                     const Expression<Eval, Right>& b)                      \
+    { return ExpressionNodes::FUNCTION<Eval>(a.node(), b.node()); }         \
+                                                                            \
+    template <class V, int n, unsigned s, class Node>                       \
+    auto operator OP(const Expression<Evaluation<V, n, s>, Node>& a,        \
+                     const Evaluation<V, n, s>& b)                          \
+    {                                                                       \
+        return ExpressionNodes::FUNCTION<Evaluation<V, n, s>>(              \
+            a.node(), ExpressionNodes::node(b));                            \
+    }                                                                       \
+                                                                            \
+    template <class V, int n, unsigned s, class Node>                       \
+    auto operator OP(const Expression<Evaluation<V, n, s>, Node>& a,        \
+                     Evaluation<V, n, s>&& b)                               \
+    {                                                                       \
+        return ExpressionNodes::FUNCTION<Evaluation<V, n, s>>(              \
+            a.node(), ExpressionNodes::node(std::move(b)));                 \
+    }                                                                       \
+                                                                            \
+    template <class V, int n, unsigned s, class Node>                       \
+    auto operator OP(const Evaluation<V, n, s>& a,                          \
+                     const Expression<Evaluation<V, n, s>, Node>& b)        \
+    {                                                                       \
+        return ExpressionNodes::FUNCTION<Evaluation<V, n, s>>(              \
+            ExpressionNodes::node(a), b.node());                            \
+    }                                                                       \
+                                                                            \
+    template <class V, int n, unsigned s, class Node>                       \
+    auto operator OP(Evaluation<V, n, s>&& a,                               \
+                     const Expression<Evaluation<V, n, s>, Node>& b)        \
+    {                                                                       \
+        return ExpressionNodes::FUNCTION<Evaluation<V, n, s>>(              \
+            ExpressionNodes::node(std::move(a)), b.node());                 \
+    }
+
+OPM_DENSEAD_EXPRESSION_OPERATOR(+, add)
+OPM_DENSEAD_EXPRESSION_OPERATOR(-, subtract)
+OPM_DENSEAD_EXPRESSION_OPERATOR(*, multiply)
+OPM_DENSEAD_EXPRESSION_OPERATOR(/, divide)
+
+#undef OPM_DENSEAD_EXPRESSION_OPERATOR
+
+// Operations with a scalar only need a single multiplication, or none at
+// all, per derivative.
+template <class Eval, class Node>
+auto operator+(const Expression<Eval, Node>& a, const typename Eval::ValueType& b)
+{ return ExpressionNodes::shift<Eval>(a.value() + b, a.node()); }
+
+template <class Eval, class Node>
+auto operator+(const typename Eval::ValueType& a, const Expression<Eval, Node>& b)
+{ return ExpressionNodes::shift<Eval>(a + b.value(), b.node()); }
+
+template <class Eval, class Node>
+auto operator-(const Expression<Eval, Node>& a, const typename Eval::ValueType& b)
+{ return ExpressionNodes::shift<Eval>(a.value() - b, a.node()); }
+
+template <class Eval, class Node>
+auto operator-(const typename Eval::ValueType& a, const Expression<Eval, Node>& b)
+{ return ExpressionNodes::negate<Eval>(a - b.value(), b.node()); }
+
+template <class Eval, class Node>
+auto operator-(const Expression<Eval, Node>& a)
+{ return ExpressionNodes::negate<Eval>(-a.value(), a.node()); }
+
+template <class Eval, class Node>
+auto operator*(const Expression<Eval, Node>& a, const typename Eval::ValueType& b)
+{ return ExpressionNodes::scale<Eval>(a.value()*b, b, a.node()); }
+
+template <class Eval, class Node>
+auto operator*(const typename Eval::ValueType& a, const Expression<Eval, Node>& b)
+{ return ExpressionNodes::scale<Eval>(a*b.value(), a, b.node()); }
+
+template <class Eval, class Node>
+auto operator/(const Expression<Eval, Node>& a, const typename Eval::ValueType& b)
+{
+    const auto invB = 1.0/b;
+    return ExpressionNodes::scale<Eval>(a.value()*invB, invB, a.node());
+}
+
+// (a/v)' = -a/v^2 * v'
+template <class Eval, class Node>
+auto operator/(const typename Eval::ValueType& a, const Expression<Eval, Node>& b)
+{
+    const auto f = a/b.value();
+    return ExpressionNodes::scale<Eval>(f, -f/b.value(), b.node());
+}
+
+template <class Eval, class Node>
+auto abs(const Expression<Eval, Node>& x)
+{
+    const typename Eval::ValueType sign = x.value() > 0.0 ? 1.0 : -1.0;
+    return ExpressionNodes::scale<Eval>(sign*x.value(), sign, x.node());
+}
+
+template <class Eval, class Node>
+auto exp(const Expression<Eval, Node>& x)
+{
+    const auto f = std::exp(x.value());
+    return ExpressionNodes::scale<Eval>(f, f, x.node());
+}
+
+template <class Eval, class Node>
+auto log(const Expression<Eval, Node>& x)
+{ return ExpressionNodes::scale<Eval>(std::log(x.value()), 1/x.value(), x.node()); }
+
+template <class Eval, class Node>
+auto log10(const Expression<Eval, Node>& x)
+{
+    typedef typename Eval::ValueType Scalar;
+    const Scalar log10e = std::log10(std::exp(Scalar{1.0}));
+    return ExpressionNodes::scale<Eval>(std::log10(x.value()), log10e/x.value(), x.node());
+}
+
+template <class Eval, class Node>
+auto sqrt(const Expression<Eval, Node>& x)
+{
+    const auto f = std::sqrt(x.value());
+    return ExpressionNodes::scale<Eval>(f, 0.5/f, x.node());
+}
+
+template <class Eval, class Node>
+auto sin(const Expression<Eval, Node>& x)
+{ return ExpressionNodes::scale<Eval>(std::sin(x.value()), std::cos(x.value()), x.node()); }
+
+template <class Eval, class Node>
+auto cos(const Expression<Eval, Node>& x)
+{ return ExpressionNodes::scale<Eval>(std::cos(x.value()), -std::sin(x.value()), x.node()); }
+
+template <class Eval, class Node>
+auto tan(const Expression<Eval, Node>& x)
+{
+    const auto f = std::tan(x.value());
+    return ExpressionNodes::scale<Eval>(f, 1 + f*f, x.node());
+}
+
+template <class Eval, class Node>
+auto asin(const Expression<Eval, Node>& x)
+{
+    const auto v = x.value();
+    return ExpressionNodes::scale<Eval>(std::asin(v), 1.0/std::sqrt(1 - v*v), x.node());
+}
+
+template <class Eval, class Node>
+auto acos(const Expression<Eval, Node>& x)
+{
+    const auto v = x.value();
+    return ExpressionNodes::scale<Eval>(std::acos(v), -1.0/std::sqrt(1 - v*v), x.node());
+}
+
+template <class Eval, class Node>
+auto atan(const Expression<Eval, Node>& x)
+{
+    const auto v = x.value();
+    return ExpressionNodes::scale<Eval>(std::atan(v), 1/(1 + v*v), x.node());
+}
+
+template <class Eval, class Node>
+auto sinh(const Expression<Eval, Node>& x)
+{ return ExpressionNodes::scale<Eval>(std::sinh(x.value()), std::cosh(x.value()), x.node()); }
+
+template <class Eval, class Node>
+auto cosh(const Expression<Eval, Node>& x)
+{ return ExpressionNodes::scale<Eval>(std::cosh(x.value()), std::sinh(x.value()), x.node()); }
+
+template <class Eval, class Node>
+auto asinh(const Expression<Eval, Node>& x)
+{
+    const auto v = x.value();
+    return ExpressionNodes::scale<Eval>(std::asinh(v), 1.0/std::sqrt(v*v + 1), x.node());
+}
+
+template <class Eval, class Node>
+auto acosh(const Expression<Eval, Node>& x)
+{
+    const auto v = x.value();
+    return ExpressionNodes::scale<Eval>(std::acosh(v), 1.0/std::sqrt(v*v - 1), x.node());
+}
+
+// atan2(x, y)' = (y*x' - x*y')/(x^2 + y^2)
+template <class Eval, class Left, class Right>
+auto atan2(const Expression<Eval, Left>& x, const Expression<Eval, Right>& y)
+{
+    const auto xv = x.value();
+    const auto yv = y.value();
+    const auto invNorm = 1/(xv*xv + yv*yv);
+    return ExpressionNodes::combine<Eval>(std::atan2(xv, yv), yv*invNorm, -xv*invNorm,
+                                          x.node(), y.node());
+}
+
+// exponentiation of an expression with a constant, a base of 0 is special
+// cased as for Evaluation
+template <class Eval, class Node>
+auto pow(const Expression<Eval, Node>& base, const typename Eval::ValueType& exp)
+{
+    const auto b = base.value();
+    if (b == 0.0)
+        return ExpressionNodes::scale<Eval>(0.0, 0.0, base.node());
+
+    const auto f = std::pow(b, exp);
+    return ExpressionNodes::scale<Eval>(f, f/b*exp, base.node());
+}
+
+template <class Eval, class Node>
+auto pow(const typename Eval::ValueType& base, const Expression<Eval, Node>& exp)
+{
+    if (base == 0.0)
+        return ExpressionNodes::scale<Eval>(0.0, 0.0, exp.node());
+
+    const auto lnBase = std::log(base);
+    const auto f = std::exp(lnBase*exp.value());
+    return ExpressionNodes::scale<Eval>(f, lnBase*f, exp.node());
+}
+
+// (f^g)' = (g*f'/f + log(f)*g') * f^g
+template <class Eval, class Left, class Right>
+auto pow(const Expression<Eval, Left>& base, const Expression<Eval, Right>& exp)
+{
+    const auto f = base.value();
+    const auto g = exp.value();
+    if (f == 0.0)
+        return ExpressionNodes::combine<Eval>(0.0, 0.0, 0.0, base.node(), exp.node());
+
+    const auto valuePow = std::pow(f, g);
+    return ExpressionNodes::combine<Eval>(valuePow, g/f*valuePow, std::log(f)*valuePow,
+                                          base.node(), exp.node());
+}
+
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EVALUATION_EXPRESSION_HPP
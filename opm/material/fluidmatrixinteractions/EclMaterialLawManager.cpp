@@ -244,6 +244,7 @@ EclMaterialLawManager<TraitsT>::
 connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
 {
     MaterialLawParams& mlp = const_cast<MaterialLawParams&>(materialLawParams_[elemIdx]);
+    mlp.unshareRealParams();
 
     if (enableHysteresis())
         OpmLog::warning("Warning: Using non-default satnum regions for connection is not tested in combination with hysteresis");
@@ -417,6 +418,7 @@ EclMaterialLawManager<TraitsT>::
 oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
 {
     auto& materialParams = materialLawParams_[elemIdx];
+    materialParams.unshareRealParams();
     switch (materialParams.approach()) {
     case EclMultiplexerApproach::Stone1: {
         auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
@@ -41,7 +41,10 @@
 #include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <tuple>
@@ -173,6 +176,11 @@ private:
                                    unsigned satRegionIdx,
                                    unsigned elemIdx);
         void readEffectiveParameters_();
+        // \brief The scaled drainage end points of a cell, as computed by
+        //        HystParams::setDrainageParamsOilWater().
+        EclEpsScalingPointsInfo<Scalar>
+        readScaledEpsInfoDrainage_(unsigned elemIdx,
+                                   const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner) const;
         void readUnscaledEpsPointsVectors_();
         template <class Container>
         void readUnscaledEpsPoints_(Container& dest, std::shared_ptr<EclEpsConfig> config, EclTwoPhaseSystemType system_type);
@@ -304,6 +312,24 @@ public:
     ///   corresponding cell.
     void applyRestartSwatInit(const unsigned elemIdx, const Scalar maxPcow);
 
+    /*!
+     * \brief Let cells with identical end-point scaling parameters share their
+     *        material law parameter objects.
+     *
+     * This reduces the memory required for large models considerably, since
+     * only the cells with individually scaled saturation functions need own
+     * parameter objects. It must be called before initParamsForElements() and
+     * has no effect if hysteresis is enabled. The objects returned by
+     * materialLawParams() may then be used by several cells, so the parameters
+     * of individual cells must only be modified through the methods of this
+     * class.
+     */
+    void setEnableCompactStorage(bool value)
+    { enableCompactStorage_ = value; }
+
+    bool enableCompactStorage() const
+    { return enableCompactStorage_; }
+
     bool enableEndPointScaling() const
     { return enableEndPointScaling_; }
 
@@ -344,6 +370,46 @@ public:
         return const_cast<MaterialLawParams&>(materialLawParamsFunc_(elemIdx, facedir));
     }
 
+    /*!
+     * \brief Compute the capillary pressures of a batch of elements.
+     *
+     * Saturations and results are given as one array per phase, i.e.,
+     * saturations[phaseIdx][i] is the saturation of the phase in the element
+     * elemIdx[i]. The values of all phases are written; phases not computed
+     * by the material law are set to zero.
+     *
+     * This is a convenience wrapper around the per-element evaluation, which
+     * it performs element by element; it is not expected to be faster.
+     */
+    template <class Evaluation>
+    void capillaryPressures(std::size_t n,
+                            const unsigned* elemIdx,
+                            const std::array<const Evaluation*, numPhases>& saturations,
+                            const std::array<Evaluation*, numPhases>& values) const
+    {
+        evalBatch_(n, elemIdx, saturations, values,
+                   [](std::size_t count, const MaterialLawParams* const* params,
+                      const auto& batchSaturations, const auto& batchValues)
+                   { MaterialLaw::capillaryPressures(count, params, batchSaturations, batchValues); });
+    }
+
+    /*!
+     * \brief Compute the relative permeabilities of a batch of elements.
+     *
+     * The arguments are the same as for capillaryPressures().
+     */
+    template <class Evaluation>
+    void relativePermeabilities(std::size_t n,
+                                const unsigned* elemIdx,
+                                const std::array<const Evaluation*, numPhases>& saturations,
+                                const std::array<Evaluation*, numPhases>& values) const
+    {
+        evalBatch_(n, elemIdx, saturations, values,
+                   [](std::size_t count, const MaterialLawParams* const* params,
+                      const auto& batchSaturations, const auto& batchValues)
+                   { MaterialLaw::relativePermeabilities(count, params, batchSaturations, batchValues); });
+    }
+
     /*!
      * \brief Returns a material parameter object for a given element and saturation region.
      *
@@ -433,6 +499,34 @@ public:
 private:
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
+    // Look up the parameters of the elements in chunks and pass them on to
+    // the batched variants of the material law, which evaluate them one by
+    // one.
+    template <class Evaluation, class BatchOp>
+    void evalBatch_(std::size_t n,
+                    const unsigned* elemIdx,
+                    const std::array<const Evaluation*, numPhases>& saturations,
+                    const std::array<Evaluation*, numPhases>& values,
+                    BatchOp batchOp) const
+    {
+        constexpr std::size_t chunkSize = 64;
+        std::array<const MaterialLawParams*, chunkSize> params;
+        for (std::size_t start = 0; start < n; start += chunkSize) {
+            const std::size_t count = std::min(chunkSize, n - start);
+            for (std::size_t i = 0; i < count; ++i)
+                params[i] = &materialLawParams(elemIdx[start + i]);
+
+            std::array<const Evaluation*, numPhases> chunkSaturations;
+            std::array<Evaluation*, numPhases> chunkValues;
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                chunkSaturations[phaseIdx] = saturations[phaseIdx] + start;
+                chunkValues[phaseIdx] = values[phaseIdx] + start;
+            }
+
+            batchOp(count, params.data(), chunkSaturations, chunkValues);
+        }
+    }
+
     void readGlobalEpsOptions_(const EclipseState& eclState);
 
     void readGlobalHysteresisOptions_(const EclipseState& state);
@@ -440,6 +534,7 @@ private:
     void readGlobalThreePhaseOptions_(const Runspec& runspec);
 
     bool enableEndPointScaling_;
+    bool enableCompactStorage_ = false;
     std::shared_ptr<EclHysteresisConfig> hysteresisConfig_;
     std::vector<std::shared_ptr<WagHysteresisConfig::WagHysteresisConfigRecord>> wagHystersisConfig_;
 
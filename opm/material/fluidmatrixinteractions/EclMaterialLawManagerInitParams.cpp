@@ -25,6 +25,55 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+// Everything which distinguishes the material law parameters of cells
+// without hysteresis.
+template <class Scalar>
+struct SharedParamsKey
+{
+    unsigned satRegionIdx;
+    Opm::EclEpsScalingPointsInfo<Scalar> scaledInfo;
+
+    bool operator==(const SharedParamsKey& other) const
+    {
+        return (satRegionIdx == other.satRegionIdx)
+            && (scaledInfo == other.scaledInfo);
+    }
+};
+
+template <class Scalar>
+struct SharedParamsKeyHash
+{
+    std::size_t operator()(const SharedParamsKey<Scalar>& key) const
+    {
+        std::size_t seed = key.satRegionIdx;
+        const auto combine = [&seed](const Scalar value)
+        {
+            seed ^= std::hash<Scalar>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+
+        const auto& info = key.scaledInfo;
+        for (const auto value : { info.Swl, info.Sgl, info.Swcr, info.Sgcr,
+                                  info.Sowcr, info.Sogcr, info.Swu, info.Sgu,
+                                  info.maxPcow, info.maxPcgo,
+                                  info.pcowLeverettFactor, info.pcgoLeverettFactor,
+                                  info.Krwr, info.Krgr, info.Krorw, info.Krorg,
+                                  info.maxKrw, info.maxKrow, info.maxKrog, info.maxKrg })
+        {
+            combine(value);
+        }
+
+        return seed;
+    }
+};
+
+} // Anonymous namespace
 
 namespace Opm {
 
@@ -65,11 +114,35 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
     std::vector<std::vector<int>*> imbnumArray;
     std::vector<std::vector<MaterialLawParams>*> mlpArray;
     initArrays_(satnumArray, imbnumArray, mlpArray);
+
+    // Without hysteresis the parameters do not change during the simulation,
+    // so cells with identical scaling parameters may use the same object.
+    const bool shareParams = this->parent_.enableCompactStorage()
+        && !this->parent_.enableHysteresis();
+    std::unordered_map<SharedParamsKey<Scalar>, const MaterialLawParams*,
+                       SharedParamsKeyHash<Scalar>> sharedParams;
+
     auto num_arrays = mlpArray.size();
     for (unsigned i=0; i<num_arrays; i++) {
         for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
             //unsigned satNumCell = this->parent_.satnumRegionArray_[elemIdx];
+
+            // Look up the shared parameters before setting up the hysteresis
+            // parameters, which are only needed for the first cell of a key.
+            auto& materialParams = (*mlpArray[i])[elemIdx];
+            if (shareParams) {
+                SharedParamsKey<Scalar> key {
+                    satRegionIdx, readScaledEpsInfoDrainage_(elemIdx, lookupIdxOnLevelZeroAssigner)
+                };
+                const auto [pos, inserted] = sharedParams.try_emplace(std::move(key), &materialParams);
+                if (!inserted) {
+                    this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx] = pos->first.scaledInfo;
+                    materialParams.shareRealParams(*pos->second);
+                    continue;
+                }
+            }
+
             HystParams hystParams {*this};
             hystParams.setConfig(satRegionIdx);
             hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
@@ -82,7 +155,8 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+
+            initThreePhaseParams_(hystParams, materialParams, satRegionIdx, elemIdx);
         }
     }
 }
@@ -269,6 +343,19 @@ readEffectiveParameters_()
     effectiveReader.read();
 }
 
+template <class Traits>
+EclEpsScalingPointsInfo<typename EclMaterialLawManager<Traits>::Scalar>
+EclMaterialLawManager<Traits>::InitParams::
+readScaledEpsInfoDrainage_(unsigned elemIdx,
+                           const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner) const
+{
+    const auto lookupIdx = lookupIdxOnLevelZeroAssigner(elemIdx);
+    const unsigned satRegionIdx = this->epsGridProperties_->satRegion(lookupIdx);
+    EclEpsScalingPointsInfo<Scalar> info(this->parent_.unscaledEpsInfo_[satRegionIdx]);
+    info.extractScaled(this->eclState_, *this->epsGridProperties_, lookupIdx);
+    return info;
+}
+
 template <class Traits>
 void
 EclMaterialLawManager<Traits>::InitParams::
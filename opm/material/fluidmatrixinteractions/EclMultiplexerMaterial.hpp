@@ -36,6 +36,9 @@
 #include <opm/common/TimingMacros.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <stdexcept>
 
 namespace Opm {
@@ -168,6 +171,71 @@ public:
         }
     }
 
+    /*!
+     * \brief The capillary pressures of a batch of cells.
+     *
+     * Saturations and results are given as one array per phase, i.e.,
+     * saturations[phaseIdx][i] is the saturation of the phase in the i-th
+     * cell, the parameters of which are *params[i]. The approach is taken
+     * from the first cell, so all cells of a batch must use the same one,
+     * which is always the case for the cells of a simulation model; this is
+     * only checked in debug builds.
+     *
+     * This is a convenience wrapper: the cells are evaluated one after the
+     * other by the underlying law, exactly as by the per-cell variant, so
+     * it is not expected to be faster than calling that in a loop.
+     *
+     * The values of all phases are written for every cell. Phases for which
+     * the approach does not compute a value (e.g. the missing phase of the
+     * two-phase approach) are set to zero, the output arrays are never read.
+     *
+     * \param n Number of cells
+     * \param params Parameters of the cells
+     * \param saturations Saturations of the cells, per phase
+     * \param values Capillary pressures of the cells, per phase
+     */
+    template <class Evaluation>
+    static void capillaryPressures(std::size_t n,
+                                   const Params* const* params,
+                                   const std::array<const Evaluation*, numPhases>& saturations,
+                                   const std::array<Evaluation*, numPhases>& values)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        if (n == 0)
+            return;
+
+        switch (batchApproach_(n, params)) {
+        case EclMultiplexerApproach::Stone1:
+            evalBatch_<EclMultiplexerApproach::Stone1>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { Stone1Material::capillaryPressures(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::Stone2:
+            evalBatch_<EclMultiplexerApproach::Stone2>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { Stone2Material::capillaryPressures(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::Default:
+            evalBatch_<EclMultiplexerApproach::Default>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { DefaultMaterial::capillaryPressures(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::TwoPhase:
+            evalBatch_<EclMultiplexerApproach::TwoPhase>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { TwoPhaseMaterial::capillaryPressures(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::OnePhase:
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+                std::fill(values[phaseIdx], values[phaseIdx] + n, 0.0);
+            break;
+        }
+    }
+
     /*
      * Hysteresis parameters for oil-water
      * @see EclHysteresisTwoPhaseLawParams::soMax(...)
@@ -528,6 +596,55 @@ public:
         }
     }
 
+    /*!
+     * \brief The relative permeabilities of a batch of cells.
+     *
+     * The arguments are the same as for the batched variant of
+     * capillaryPressures().
+     */
+    template <class Evaluation>
+    static void relativePermeabilities(std::size_t n,
+                                       const Params* const* params,
+                                       const std::array<const Evaluation*, numPhases>& saturations,
+                                       const std::array<Evaluation*, numPhases>& values)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        if (n == 0)
+            return;
+
+        switch (batchApproach_(n, params)) {
+        case EclMultiplexerApproach::Stone1:
+            evalBatch_<EclMultiplexerApproach::Stone1>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { Stone1Material::relativePermeabilities(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::Stone2:
+            evalBatch_<EclMultiplexerApproach::Stone2>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { Stone2Material::relativePermeabilities(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::Default:
+            evalBatch_<EclMultiplexerApproach::Default>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { DefaultMaterial::relativePermeabilities(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::TwoPhase:
+            evalBatch_<EclMultiplexerApproach::TwoPhase>(n, params, saturations, values,
+                [](auto& cellValues, const auto& realParams, const auto& fs)
+                { TwoPhaseMaterial::relativePermeabilities(cellValues, realParams, fs); });
+            break;
+
+        case EclMultiplexerApproach::OnePhase:
+            std::fill(values[0], values[0] + n, 1.0);
+            for (int phaseIdx = 1; phaseIdx < numPhases; ++phaseIdx)
+                std::fill(values[phaseIdx], values[phaseIdx] + n, 0.0);
+            break;
+        }
+    }
+
     /*!
      * \brief The relative permeability of oil in oil/gas system.
      */
@@ -658,6 +775,55 @@ public:
         }
         return false;
     }
+
+private:
+    // Minimal fluid state which provides the saturations of one cell of a
+    // batch.
+    template <class Evaluation>
+    struct BatchFluidState_
+    {
+        using Scalar = Evaluation;
+
+        const Evaluation& saturation(unsigned phaseIdx) const
+        { return saturations[phaseIdx][cellIdx]; }
+
+        const std::array<const Evaluation*, numPhases>& saturations;
+        std::size_t cellIdx;
+    };
+
+    static EclMultiplexerApproach batchApproach_([[maybe_unused]] std::size_t n,
+                                                 const Params* const* params)
+    {
+        const auto approach = params[0]->approach();
+        assert(std::all_of(params + 1, params + n,
+                           [approach](const Params* cellParams)
+                           { return cellParams->approach() == approach; }));
+
+        return approach;
+    }
+
+    template <EclMultiplexerApproach approachV, class Evaluation, class CellOp>
+    static void evalBatch_(std::size_t n,
+                           const Params* const* params,
+                           const std::array<const Evaluation*, numPhases>& saturations,
+                           const std::array<Evaluation*, numPhases>& values,
+                           CellOp cellOp)
+    {
+        BatchFluidState_<Evaluation> fs{saturations, 0};
+        std::array<Evaluation, numPhases> cellValues;
+        for (std::size_t i = 0; i < n; ++i) {
+            // the two-phase approach does not touch the value of the missing
+            // phase, so start from zero instead of reading the outputs
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+                cellValues[phaseIdx] = 0.0;
+
+            fs.cellIdx = i;
+            cellOp(cellValues, params[i]->template getRealParams<approachV>(), fs);
+
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+                values[phaseIdx][i] = cellValues[phaseIdx];
+        }
+    }
 };
 
 } // namespace Opm
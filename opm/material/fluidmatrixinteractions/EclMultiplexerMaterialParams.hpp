@@ -136,6 +136,51 @@ public:
     EclMultiplexerApproach approach() const
     { return approach_; }
 
+    /*!
+     * \brief Use the parameter object of another instance instead of an own one.
+     *
+     * Modifying the parameters of either instance afterwards affects both,
+     * until unshareRealParams() is called.
+     */
+    void shareRealParams(const EclMultiplexerMaterialParams& other)
+    {
+        approach_ = other.approach_;
+        realParams_ = other.realParams_;
+    }
+
+    /*!
+     * \brief Returns true if the parameter object is used by other instances too.
+     */
+    bool hasSharedRealParams() const
+    { return realParams_.use_count() > 1; }
+
+    /*!
+     * \brief Replace a shared parameter object by a private copy.
+     */
+    void unshareRealParams()
+    {
+        if (!hasSharedRealParams())
+            return;
+
+        switch (approach()) {
+        case EclMultiplexerApproach::Stone1:
+            realParams_ = ParamPointerType(new Stone1Params(castTo<Stone1Params>()), Deleter< Stone1Params > () );
+            break;
+        case EclMultiplexerApproach::Stone2:
+            realParams_ = ParamPointerType(new Stone2Params(castTo<Stone2Params>()), Deleter< Stone2Params > () );
+            break;
+        case EclMultiplexerApproach::Default:
+            realParams_ = ParamPointerType(new DefaultParams(castTo<DefaultParams>()), Deleter< DefaultParams > () );
+            break;
+        case EclMultiplexerApproach::TwoPhase:
+            realParams_ = ParamPointerType(new TwoPhaseParams(castTo<TwoPhaseParams>()), Deleter< TwoPhaseParams > () );
+            break;
+        case EclMultiplexerApproach::OnePhase:
+            // Do nothing, no parameters.
+            break;
+        }
+    }
+
     // get the parameter object for the Stone1 case
     template <EclMultiplexerApproach approachV>
     typename std::enable_if<approachV == EclMultiplexerApproach::Stone1, Stone1Params>::type&
@@ -31,6 +31,7 @@
 #include <opm/common/TimingMacros.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <type_traits>
 
@@ -38,6 +39,12 @@
 #include <opm/common/utility/gpuDecorators.hpp>
 
 namespace Opm {
+
+namespace DenseAd {
+template <class ScalarT, int numDerivs, int width>
+class EvaluationBatch;
+}
+
 /*!
  * \ingroup FluidMatrixInteractions
  *
@@ -265,6 +272,41 @@ private:
         return evalDescending_(xValues, yValues, x);
     }
 
+    // the segment is looked up for each lane, the interpolation and the
+    // clamping at the ends of the table are done for all lanes at once
+    template <class ValueT, int numVars, int width>
+    static DenseAd::EvaluationBatch<ValueT, numVars, width>
+    eval_(const ValueVector& xValues,
+          const ValueVector& yValues,
+          const DenseAd::EvaluationBatch<ValueT, numVars, width>& x)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        using Batch = DenseAd::EvaluationBatch<ValueT, numVars, width>;
+
+        const bool ascending = xValues.front() < xValues.back();
+        const size_t n = xValues.size() - 1;
+
+        typename Batch::LaneValues x0, y0, m;
+        for (int l = 0; l < width; ++l) {
+            const ValueT xl = x.value()[l];
+            size_t segIdx = ascending
+                ? findSegmentIndex_(xValues, xl)
+                : findSegmentIndexDescending_(xValues, xl);
+            segIdx = std::min(segIdx, n - 1);
+
+            x0[l] = xValues[segIdx];
+            y0[l] = yValues[segIdx];
+            m[l] = (yValues[segIdx + 1] - y0[l])/(xValues[segIdx + 1] - x0[l]);
+        }
+
+        const Batch interp = Batch(y0) + (x - Batch(x0))*Batch(m);
+        const auto beforeFront = ascending ? x <= xValues.front() : x >= xValues.front();
+        const auto pastBack = ascending ? x >= xValues.back() : x <= xValues.back();
+
+        return select(beforeFront, Batch(yValues.front()),
+                      select(pastBack, Batch(yValues.back()), interp));
+    }
+
     template <class Evaluation>
     OPM_HOST_DEVICE static Evaluation evalAscending_(const ValueVector& xValues,
                                      const ValueVector& yValues,
@@ -43,42 +43,43 @@ template <class Scalar, class IndexTraits>
 void BlackOilFluidSystem<Scalar,IndexTraits>::
 initFromState(const EclipseState& eclState, const Schedule& schedule)
 {
+    auto& inst = instance();
     if(eclState.getSimulationConfig().useEnthalpy()){
-        enthalpy_eq_energy_ = false;
+        inst.enthalpy_eq_energy_ = false;
     }else{
-        enthalpy_eq_energy_ = true;
+        inst.enthalpy_eq_energy_ = true;
     }
     std::size_t numRegions = eclState.runspec().tabdims().getNumPVTTables();
     initBegin(numRegions);
 
-    numActivePhases_ = 0;
-    std::fill_n(&phaseIsActive_[0], numPhases, false);
+    inst.numActivePhases_ = 0;
+    std::fill_n(&inst.phaseIsActive_[0], numPhases, false);
 
     if (eclState.runspec().phases().active(Phase::OIL)) {
-        phaseIsActive_[oilPhaseIdx] = true;
-        ++numActivePhases_;
+        inst.phaseIsActive_[oilPhaseIdx] = true;
+        ++inst.numActivePhases_;
     }
 
     if (eclState.runspec().phases().active(Phase::GAS)) {
-        phaseIsActive_[gasPhaseIdx] = true;
-        ++numActivePhases_;
+        inst.phaseIsActive_[gasPhaseIdx] = true;
+        ++inst.numActivePhases_;
     }
 
     if (eclState.runspec().phases().active(Phase::WATER)) {
-        phaseIsActive_[waterPhaseIdx] = true;
-        ++numActivePhases_;
+        inst.phaseIsActive_[waterPhaseIdx] = true;
+        ++inst.numActivePhases_;
     }
 
     // this fluidsystem only supports one, two or three phases
-    if (numActivePhases_ < 1 || numActivePhases_ > 3) {
+    if (inst.numActivePhases_ < 1 || inst.numActivePhases_ > 3) {
         OPM_THROW(std::runtime_error,
                   fmt::format("Fluidsystem supports 1-3 phases, but {} is active\n",
-                              numActivePhases_));
+                              inst.numActivePhases_));
     }
 
     // set the surface conditions using the STCOND keyword
-    surfaceTemperature = eclState.getTableManager().stCond().temperature;
-    surfacePressure = eclState.getTableManager().stCond().pressure;
+    setSurfaceConditions_(eclState.getTableManager().stCond().temperature,
+                          eclState.getTableManager().stCond().pressure);
 
     // The reservoir temperature does not really belong into the table manager. TODO:
     // change this in opm-parser
@@ -103,25 +104,25 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
     }
 
     if (phaseIsActive(gasPhaseIdx)) {
-        gasPvt_ = std::make_shared<GasPvt>();
-        gasPvt_->initFromState(eclState, schedule);
+        inst.gasPvt_ = std::make_shared<GasPvt>();
+        inst.gasPvt_->initFromState(eclState, schedule);
     }
 
     if (phaseIsActive(oilPhaseIdx)) {
-        oilPvt_ = std::make_shared<OilPvt>();
-        oilPvt_->initFromState(eclState, schedule);
+        inst.oilPvt_ = std::make_shared<OilPvt>();
+        inst.oilPvt_->initFromState(eclState, schedule);
     }
 
     if (phaseIsActive(waterPhaseIdx)) {
-        waterPvt_ = std::make_shared<WaterPvt>();
-        waterPvt_->initFromState(eclState, schedule);
+        inst.waterPvt_ = std::make_shared<WaterPvt>();
+        inst.waterPvt_->initFromState(eclState, schedule);
     }
 
     // set the reference densities of all PVT regions
     for (unsigned regionIdx = 0; regionIdx < numRegions; ++regionIdx) {
-        setReferenceDensities(oilPvt_ ? oilPvt_->oilReferenceDensity(regionIdx) : 700.0,
-                              waterPvt_ ? waterPvt_->waterReferenceDensity(regionIdx) : 1000.0,
-                              gasPvt_ ? gasPvt_->gasReferenceDensity(regionIdx) : 2.0,
+        setReferenceDensities(inst.oilPvt_ ? inst.oilPvt_->oilReferenceDensity(regionIdx) : 700.0,
+                              inst.waterPvt_ ? inst.waterPvt_->waterReferenceDensity(regionIdx) : 1000.0,
+                              inst.gasPvt_ ? inst.gasPvt_->gasReferenceDensity(regionIdx) : 2.0,
                               regionIdx);
     }
 
@@ -134,14 +135,14 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
         const Scalar salinity = eclState.getCo2StoreConfig().salinity();  // mass fraction
         for (unsigned regionIdx = 0; regionIdx < numRegions; ++regionIdx) {
             if (phaseIsActive(oilPhaseIdx)) // The oil component is used for the brine if OIL is active
-                molarMass_[regionIdx][oilCompIdx] = BrineCo2Pvt<Scalar>::Brine::molarMass(salinity);
+                inst.molarMass_[regionIdx][oilCompIdx] = BrineCo2Pvt<Scalar>::Brine::molarMass(salinity);
             if (phaseIsActive(waterPhaseIdx))
-                molarMass_[regionIdx][waterCompIdx] = BrineCo2Pvt<Scalar>::Brine::molarMass(salinity);
+                inst.molarMass_[regionIdx][waterCompIdx] = BrineCo2Pvt<Scalar>::Brine::molarMass(salinity);
             if (!phaseIsActive(gasPhaseIdx)) {
                 OPM_THROW(std::runtime_error,
                           "CO2STORE requires gas phase\n");
             }
-            molarMass_[regionIdx][gasCompIdx] = BrineCo2Pvt<Scalar>::CO2::molarMass();
+            inst.molarMass_[regionIdx][gasCompIdx] = BrineCo2Pvt<Scalar>::CO2::molarMass();
         }
     }
 
@@ -153,14 +154,14 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
         const Scalar salinity = 1 / ( 1 + 1 / (molality*MmNaCl));
         for (unsigned regionIdx = 0; regionIdx < numRegions; ++regionIdx) {
             if (phaseIsActive(oilPhaseIdx)) // The oil component is used for the brine if OIL is active
-                molarMass_[regionIdx][oilCompIdx] = BrineH2Pvt<Scalar>::Brine::molarMass(salinity);
+                inst.molarMass_[regionIdx][oilCompIdx] = BrineH2Pvt<Scalar>::Brine::molarMass(salinity);
             if (phaseIsActive(waterPhaseIdx))
-                molarMass_[regionIdx][waterCompIdx] = BrineH2Pvt<Scalar>::Brine::molarMass(salinity);
+                inst.molarMass_[regionIdx][waterCompIdx] = BrineH2Pvt<Scalar>::Brine::molarMass(salinity);
             if (!phaseIsActive(gasPhaseIdx)) {
                 OPM_THROW(std::runtime_error,
                           "H2STORE requires gas phase\n");
             }
-            molarMass_[regionIdx][gasCompIdx] = BrineH2Pvt<Scalar>::H2::molarMass();
+            inst.molarMass_[regionIdx][gasCompIdx] = BrineH2Pvt<Scalar>::H2::molarMass();
         }
     }
 
@@ -174,7 +175,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
         if (!diffCoeffTables.empty()) {
             // if diffusion coefficient table is empty we relay on the PVT model to
             // to give us the coefficients.
-            diffusionCoefficients_.resize(numRegions,{0,0,0,0,0,0,0,0,0});
+            inst.diffusionCoefficients_.resize(numRegions,{0,0,0,0,0,0,0,0,0});
             if (diffCoeffTables.size() != numRegions) {
                 OPM_THROW(std::runtime_error,
                           fmt::format("Table sizes mismatch. DiffCoeffs: {}, NumRegions: {}\n",
@@ -182,8 +183,8 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
             }
             for (unsigned regionIdx = 0; regionIdx < numRegions; ++regionIdx) {
                 const auto& diffCoeffTable = diffCoeffTables[regionIdx];
-                molarMass_[regionIdx][oilCompIdx] = diffCoeffTable.oil_mw;
-                molarMass_[regionIdx][gasCompIdx] = diffCoeffTable.gas_mw;
+                inst.molarMass_[regionIdx][oilCompIdx] = diffCoeffTable.oil_mw;
+                inst.molarMass_[regionIdx][gasCompIdx] = diffCoeffTable.gas_mw;
                 setDiffusionCoefficient(diffCoeffTable.gas_in_gas, gasCompIdx, gasPhaseIdx, regionIdx);
                 setDiffusionCoefficient(diffCoeffTable.oil_in_gas, oilCompIdx, gasPhaseIdx, regionIdx);
                 setDiffusionCoefficient(diffCoeffTable.gas_in_oil, gasCompIdx, oilPhaseIdx, regionIdx);
@@ -200,7 +201,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
                 && eclState.runspec().phases().active(Phase::GAS)
                 && eclState.runspec().phases().active(Phase::WATER))
         {
-            diffusionCoefficients_.resize(numRegions,{0,0,0,0,0,0,0,0,0});
+            inst.diffusionCoefficients_.resize(numRegions,{0,0,0,0,0,0,0,0,0});
             // diffusion coefficients can be set using DIFFCGAS and DIFFCWAT
             // for CO2STORE and H2STORE cases with gas + water
             const auto& diffCoeffWatTables = eclState.getTableManager().getDiffusionCoefficientWaterTable();
@@ -228,25 +229,26 @@ template <class Scalar, class IndexTraits>
 void BlackOilFluidSystem<Scalar,IndexTraits>::
 initBegin(std::size_t numPvtRegions)
 {
-    isInitialized_ = false;
-    useSaturatedTables_ = true;
+    auto& inst = instance();
+    inst.isInitialized_ = false;
+    inst.useSaturatedTables_ = true;
 
-    enableDissolvedGas_ = true;
-    enableDissolvedGasInWater_ = false;
-    enableVaporizedOil_ = false;
-    enableVaporizedWater_ = false;
-    enableDiffusion_ = false;
+    inst.enableDissolvedGas_ = true;
+    inst.enableDissolvedGasInWater_ = false;
+    inst.enableVaporizedOil_ = false;
+    inst.enableVaporizedWater_ = false;
+    inst.enableDiffusion_ = false;
 
-    oilPvt_ = nullptr;
-    gasPvt_ = nullptr;
-    waterPvt_ = nullptr;
+    inst.oilPvt_ = nullptr;
+    inst.gasPvt_ = nullptr;
+    inst.waterPvt_ = nullptr;
 
-    surfaceTemperature = 273.15 + 15.56; // [K]
-    surfacePressure = 1.01325e5; // [Pa]
-    setReservoirTemperature(surfaceTemperature);
+    setSurfaceConditions_(/*temperature=*/273.15 + 15.56, // [K]
+                          /*pressure=*/1.01325e5); // [Pa]
+    setReservoirTemperature(inst.surfaceTemperature_);
 
-    numActivePhases_ = numPhases;
-    std::fill_n(&phaseIsActive_[0], numPhases, true);
+    inst.numActivePhases_ = numPhases;
+    std::fill_n(&inst.phaseIsActive_[0], numPhases, true);
 
     resizeArrays_(numPvtRegions);
 }
@@ -258,47 +260,49 @@ setReferenceDensities(Scalar rhoOil,
                       Scalar rhoGas,
                       unsigned regionIdx)
 {
-    referenceDensity_[regionIdx][oilPhaseIdx] = rhoOil;
-    referenceDensity_[regionIdx][waterPhaseIdx] = rhoWater;
-    referenceDensity_[regionIdx][gasPhaseIdx] = rhoGas;
+    auto& inst = instance();
+    inst.referenceDensity_[regionIdx][oilPhaseIdx] = rhoOil;
+    inst.referenceDensity_[regionIdx][waterPhaseIdx] = rhoWater;
+    inst.referenceDensity_[regionIdx][gasPhaseIdx] = rhoGas;
 }
 
 template <class Scalar, class IndexTraits>
 void BlackOilFluidSystem<Scalar,IndexTraits>::initEnd()
 {
+    auto& inst = instance();
     // calculate the final 2D functions which are used for interpolation.
-    std::size_t numRegions = molarMass_.size();
+    std::size_t numRegions = inst.molarMass_.size();
     for (unsigned regionIdx = 0; regionIdx < numRegions; ++ regionIdx) {
         // calculate molar masses
 
         // water is simple: 18 g/mol
-        molarMass_[regionIdx][waterCompIdx] = 18e-3;
+        inst.molarMass_[regionIdx][waterCompIdx] = 18e-3;
 
         if (phaseIsActive(gasPhaseIdx)) {
             // for gas, we take the density at standard conditions and assume it to be ideal
-            Scalar p = surfacePressure;
-            Scalar T = surfaceTemperature;
-            Scalar rho_g = referenceDensity_[/*regionIdx=*/0][gasPhaseIdx];
-            molarMass_[regionIdx][gasCompIdx] = Constants<Scalar>::R*T*rho_g / p;
+            Scalar p = inst.surfacePressure_;
+            Scalar T = inst.surfaceTemperature_;
+            Scalar rho_g = inst.referenceDensity_[/*regionIdx=*/0][gasPhaseIdx];
+            inst.molarMass_[regionIdx][gasCompIdx] = Constants<Scalar>::R*T*rho_g / p;
         }
         else
             // hydrogen gas. we just set this do avoid NaNs later
-            molarMass_[regionIdx][gasCompIdx] = 2e-3;
+            inst.molarMass_[regionIdx][gasCompIdx] = 2e-3;
 
         // finally, for oil phase, we take the molar mass from the spe9 paper
-        molarMass_[regionIdx][oilCompIdx] = 175e-3; // kg/mol
+        inst.molarMass_[regionIdx][oilCompIdx] = 175e-3; // kg/mol
     }
 
 
     int activePhaseIdx = 0;
     for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
         if(phaseIsActive(phaseIdx)){
-            canonicalToActivePhaseIdx_[phaseIdx] = activePhaseIdx;
-            activeToCanonicalPhaseIdx_[activePhaseIdx] = phaseIdx;
+            inst.canonicalToActivePhaseIdx_[phaseIdx] = activePhaseIdx;
+            inst.activeToCanonicalPhaseIdx_[activePhaseIdx] = phaseIdx;
             activePhaseIdx++;
         }
     }
-    isInitialized_ = true;
+    inst.isInitialized_ = true;
 }
 
 template <class Scalar, class IndexTraits>
@@ -379,7 +383,7 @@ short BlackOilFluidSystem<Scalar,IndexTraits>::
 activeToCanonicalPhaseIdx(unsigned activePhaseIdx)
 {
     assert(activePhaseIdx<numActivePhases());
-    return activeToCanonicalPhaseIdx_[activePhaseIdx];
+    return instance().activeToCanonicalPhaseIdx_[activePhaseIdx];
 }
 
 template <class Scalar, class IndexTraits>
@@ -388,32 +392,37 @@ canonicalToActivePhaseIdx(unsigned phaseIdx)
 {
     assert(phaseIdx<numPhases);
     assert(phaseIsActive(phaseIdx));
-    return canonicalToActivePhaseIdx_[phaseIdx];
+    return instance().canonicalToActivePhaseIdx_[phaseIdx];
 }
 
 template <class Scalar, class IndexTraits>
 void BlackOilFluidSystem<Scalar,IndexTraits>::
 resizeArrays_(std::size_t numRegions)
 {
-    molarMass_.resize(numRegions);
-    referenceDensity_.resize(numRegions);
+    auto& inst = instance();
+    inst.molarMass_.resize(numRegions);
+    inst.referenceDensity_.resize(numRegions);
 }
 
-template<> unsigned char BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numActivePhases_ = 0;
-template<> std::array<bool, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases>
-BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::phaseIsActive_ = {false, false, false};
-
-template<> unsigned char BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numActivePhases_ = 0;
-template<> std::array<bool, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases>
-BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::phaseIsActive_ = {false, false, false};
-
-template<> std::array<short, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::activeToCanonicalPhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::activeToCanonicalPhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::canonicalToActivePhaseIdx_ = {0, 1, 2};
-
-template<> std::array<short, BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::numPhases> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::canonicalToActivePhaseIdx_ = {0, 1, 2};
+template <class Scalar, class IndexTraits>
+void BlackOilFluidSystem<Scalar,IndexTraits>::
+setSurfaceConditions_(Scalar temperature, Scalar pressure)
+{
+    auto& inst = instance();
+    inst.surfaceTemperature_ = temperature;
+    inst.surfacePressure_ = pressure;
+
+    // Only the default instance updates the deprecated process-wide values,
+    // such that initializing other instances concurrently does not race on
+    // them.
+    if (&inst == &defaultInstance_) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        surfaceTemperature = temperature;
+        surfacePressure = pressure;
+#pragma GCC diagnostic pop
+    }
+}
 
 template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::surfaceTemperature = 0.0;
 template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::surfaceTemperature = 0.0;
@@ -421,47 +430,10 @@ template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::surface
 template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::surfacePressure = 0.0;
 template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::surfacePressure = 0.0;
 
-template<> double BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::reservoirTemperature_ = 0.0;
-template<> float BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::reservoirTemperature_ = 0.0;
-
-template<> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDissolvedGas_ = true;
-template<> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDissolvedGas_ = true;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDissolvedGasInWater_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDissolvedGasInWater_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableVaporizedOil_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableVaporizedOil_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableVaporizedWater_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableVaporizedWater_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::enableDiffusion_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::enableDiffusion_ = false;
-
-template <> std::shared_ptr<OilPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::oilPvt_ = nullptr;
-template <> std::shared_ptr<OilPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::oilPvt_ = nullptr;
-
-template <> std::shared_ptr<GasPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::gasPvt_ = nullptr;
-template <> std::shared_ptr<GasPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::gasPvt_ = nullptr;
-
-template <> std::shared_ptr<WaterPvtMultiplexer<double>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::waterPvt_ = nullptr;
-template <> std::shared_ptr<WaterPvtMultiplexer<float>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::waterPvt_ = nullptr;
-
-template <> std::vector<std::array<double, 3>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::referenceDensity_ = {};
-template <> std::vector<std::array<float, 3>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::referenceDensity_ = {};
-
-template <> std::vector<std::array<double, 3>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::molarMass_ = {};
-template <> std::vector<std::array<float, 3>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::molarMass_ = {};
-
-template <> std::vector<std::array<double, 9>> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::diffusionCoefficients_ = {};
-template <> std::vector<std::array<float, 9>> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::diffusionCoefficients_ = {};
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::isInitialized_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::isInitialized_ = false;
-
-template <> bool BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::useSaturatedTables_ = false;
-template <> bool BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::useSaturatedTables_ = false;
+template<> BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::Instance
+BlackOilFluidSystem<double, BlackOilDefaultIndexTraits>::defaultInstance_ = {};
+template<> BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::Instance
+BlackOilFluidSystem<float, BlackOilDefaultIndexTraits>::defaultInstance_ = {};
 
 // IMPORTANT: The following two lines must come after the template specializations above
 //    or else the static variable above will appear as undefined in the generated object file.
@@ -251,7 +251,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static void setEnableDissolvedGas(bool yesno)
-    { enableDissolvedGas_ = yesno; }
+    { instance().enableDissolvedGas_ = yesno; }
 
     /*!
      * \brief Specify whether the fluid system should consider that the oil component can
@@ -260,7 +260,7 @@ public:
      * By default, vaporized oil is not considered.
      */
     static void setEnableVaporizedOil(bool yesno)
-    { enableVaporizedOil_ = yesno; }
+    { instance().enableVaporizedOil_ = yesno; }
 
      /*!
      * \brief Specify whether the fluid system should consider that the water component can
@@ -269,7 +269,7 @@ public:
      * By default, vaporized water is not considered.
      */
     static void setEnableVaporizedWater(bool yesno)
-    { enableVaporizedWater_ = yesno; }
+    { instance().enableVaporizedWater_ = yesno; }
 
      /*!
      * \brief Specify whether the fluid system should consider that the gas component can
@@ -278,14 +278,14 @@ public:
      * By default, dissovled gas in water is not considered.
      */
     static void setEnableDissolvedGasInWater(bool yesno)
-    { enableDissolvedGasInWater_ = yesno; }
+    { instance().enableDissolvedGasInWater_ = yesno; }
     /*!
      * \brief Specify whether the fluid system should consider diffusion
      *
      * By default, diffusion is not considered.
      */
     static void setEnableDiffusion(bool yesno)
-    { enableDiffusion_ = yesno; }
+    { instance().enableDiffusion_ = yesno; }
 
     /*!
      * \brief Specify whether the saturated tables should be used
@@ -293,36 +293,37 @@ public:
      * By default, saturated tables are used
      */
     static void setUseSaturatedTables(bool yesno)
-    { useSaturatedTables_ = yesno; }
+    { instance().useSaturatedTables_ = yesno; }
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the gas phase.
      */
     static void setGasPvt(std::shared_ptr<GasPvt> pvtObj)
-    { gasPvt_ = pvtObj; }
+    { instance().gasPvt_ = pvtObj; }
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the oil phase.
      */
     static void setOilPvt(std::shared_ptr<OilPvt> pvtObj)
-    { oilPvt_ = pvtObj; }
+    { instance().oilPvt_ = pvtObj; }
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the water phase.
      */
     static void setWaterPvt(std::shared_ptr<WaterPvt> pvtObj)
-    { waterPvt_ = pvtObj; }
+    { instance().waterPvt_ = pvtObj; }
 
     static void setVapPars(const Scalar par1, const Scalar par2)
     {
-        if (gasPvt_) {
-            gasPvt_->setVapPars(par1, par2);
+        const auto& inst = instance();
+        if (inst.gasPvt_) {
+            inst.gasPvt_->setVapPars(par1, par2);
         }
-        if (oilPvt_) {
-            oilPvt_->setVapPars(par1, par2);
+        if (inst.oilPvt_) {
+            inst.oilPvt_->setVapPars(par1, par2);
         }
-        if (waterPvt_) {
-            waterPvt_->setVapPars(par1, par2);
+        if (inst.waterPvt_) {
+            inst.waterPvt_->setVapPars(par1, par2);
         }
     }
 
@@ -344,7 +345,7 @@ public:
     static void initEnd();
 
     static bool isInitialized()
-    { return isInitialized_; }
+    { return instance().isInitialized_; }
 
     /****************************************
      * Generic phase properties
@@ -360,12 +361,22 @@ public:
     //! Index of the gas phase
     static constexpr unsigned gasPhaseIdx = IndexTraits::gasPhaseIdx;
 
-    //! The pressure at the surface
+    //! The pressure at the surface of the default instance only
+    [[deprecated("use standardPressure()")]]
     static Scalar surfacePressure;
 
-    //! The temperature at the surface
+    //! The temperature at the surface of the default instance only
+    [[deprecated("use standardTemperature()")]]
     static Scalar surfaceTemperature;
 
+    //! The pressure at the surface, i.e. the one of the STCOND keyword
+    static Scalar standardPressure()
+    { return instance().surfacePressure_; }
+
+    //! The temperature at the surface, i.e. the one of the STCOND keyword
+    static Scalar standardTemperature()
+    { return instance().surfaceTemperature_; }
+
     //! \copydoc BaseFluidSystem::phaseName
     static std::string_view phaseName(unsigned phaseIdx);
 
@@ -390,20 +401,15 @@ public:
     //! Index of the gas component
     static constexpr unsigned gasCompIdx = IndexTraits::gasCompIdx;
 
-protected:
-    static unsigned char numActivePhases_;
-    static std::array<bool,numPhases> phaseIsActive_;
-
-public:
     //! \brief Returns the number of active fluid phases (i.e., usually three)
     static unsigned numActivePhases()
-    { return numActivePhases_; }
+    { return instance().numActivePhases_; }
 
     //! \brief Returns whether a fluid phase is active
     static bool phaseIsActive(unsigned phaseIdx)
     {
         assert(phaseIdx < numPhases);
-        return phaseIsActive_[phaseIdx];
+        return instance().phaseIsActive_[phaseIdx];
     }
 
     //! \brief returns the index of "primary" component of a phase (solvent)
@@ -417,7 +423,7 @@ public:
 
     //! \copydoc BaseFluidSystem::molarMass
     static Scalar molarMass(unsigned compIdx, unsigned regionIdx = 0)
-    { return molarMass_[regionIdx][compIdx]; }
+    { return instance().molarMass_[regionIdx][compIdx]; }
 
     //! \copydoc BaseFluidSystem::isIdealMixture
     static bool isIdealMixture(unsigned /*phaseIdx*/)
@@ -445,7 +451,7 @@ public:
      * By default, this is 1.
      */
     static std::size_t numRegions()
-    { return molarMass_.size(); }
+    { return instance().molarMass_.size(); }
 
     /*!
      * \brief Returns whether the fluid system should consider that the gas component can
@@ -454,7 +460,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static bool enableDissolvedGas()
-    { return enableDissolvedGas_; }
+    { return instance().enableDissolvedGas_; }
 
 
     /*!
@@ -464,7 +470,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static bool enableDissolvedGasInWater()
-    { return enableDissolvedGasInWater_; }
+    { return instance().enableDissolvedGasInWater_; }
 
     /*!
      * \brief Returns whether the fluid system should consider that the oil component can
@@ -473,7 +479,7 @@ public:
      * By default, vaporized oil is not considered.
      */
     static bool enableVaporizedOil()
-    { return enableVaporizedOil_; }
+    { return instance().enableVaporizedOil_; }
 
     /*!
      * \brief Returns whether the fluid system should consider that the water component can
@@ -482,7 +488,7 @@ public:
      * By default, vaporized water is not considered.
      */
     static bool enableVaporizedWater()
-    { return enableVaporizedWater_; }
+    { return instance().enableVaporizedWater_; }
 
     /*!
      * \brief Returns whether the fluid system should consider diffusion
@@ -490,7 +496,7 @@ public:
      * By default, diffusion is not considered.
      */
     static bool enableDiffusion()
-    { return enableDiffusion_; }
+    { return instance().enableDiffusion_; }
 
     /*!
      * \brief Returns whether the saturated tables should be used
@@ -498,7 +504,7 @@ public:
      * By default, saturated tables are used. If false the unsaturated tables are extrapolated
      */
     static bool useSaturatedTables()
-    { return useSaturatedTables_; }
+    { return instance().useSaturatedTables_; }
 
     /*!
      * \brief Returns the density of a fluid phase at surface pressure [kg/m^3]
@@ -506,7 +512,7 @@ public:
      * \copydoc Doxygen::phaseIdxParam
      */
     static Scalar referenceDensity(unsigned phaseIdx, unsigned regionIdx)
-    { return referenceDensity_[regionIdx][phaseIdx]; }
+    { return instance().referenceDensity_[regionIdx][phaseIdx]; }
 
     /****************************************
      * thermodynamic quantities (generic version)
@@ -561,6 +567,7 @@ public:
                            unsigned phaseIdx,
                            unsigned regionIdx)
     {
+        const auto& inst = instance();
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
 
@@ -573,7 +580,7 @@ public:
             if (enableDissolvedGas()) {
                 // miscible oil
                 const LhsEval& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+                const LhsEval& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
 
                 return
                     bo*referenceDensity(oilPhaseIdx, regionIdx)
@@ -582,7 +589,7 @@ public:
 
             // immiscible oil
             const LhsEval Rs(0.0);
-            const auto& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+            const auto& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
 
             return referenceDensity(phaseIdx, regionIdx)*bo;
         }
@@ -592,7 +599,7 @@ public:
                 // gas containing vaporized oil and vaporized water
                 const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -603,7 +610,7 @@ public:
                 // miscible gas
                 const LhsEval Rvw(0.0);
                 const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -613,7 +620,7 @@ public:
                 // gas containing vaporized water
                 const LhsEval Rv(0.0);
                 const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -623,7 +630,7 @@ public:
             // immiscible gas
             const LhsEval Rv(0.0);
             const LhsEval Rvw(0.0);
-            const auto& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+            const auto& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
             return bg*referenceDensity(phaseIdx, regionIdx);
         }
 
@@ -631,7 +638,7 @@ public:
             if (enableDissolvedGasInWater()) {
                  // gas miscible in water
                 const LhsEval& Rsw =BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                const LhsEval& bw = inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
                 return
                     bw*referenceDensity(waterPhaseIdx, regionIdx)
                     + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
@@ -639,7 +646,7 @@ public:
             const LhsEval Rsw(0.0);
             return
                 referenceDensity(waterPhaseIdx, regionIdx)
-                * waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                * inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
         }
 
         throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
@@ -659,6 +666,7 @@ public:
                                     unsigned phaseIdx,
                                     unsigned regionIdx)
     {
+        const auto& inst = instance();
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
 
@@ -670,7 +678,7 @@ public:
             if (enableDissolvedGas()) {
                 // miscible oil
                 const LhsEval& Rs = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, oilPhaseIdx, regionIdx);
-                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+                const LhsEval& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
 
                 return
                     bo*referenceDensity(oilPhaseIdx, regionIdx)
@@ -679,7 +687,7 @@ public:
 
             // immiscible oil
             const LhsEval Rs(0.0);
-            const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+            const LhsEval& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
             return referenceDensity(phaseIdx, regionIdx)*bo;
         }
 
@@ -688,7 +696,7 @@ public:
                 // gas containing vaporized oil and vaporized water
                 const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
                 const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -700,7 +708,7 @@ public:
                 // miscible gas
                 const LhsEval Rvw(0.0);
                 const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -711,7 +719,7 @@ public:
                 // gas containing vaporized water
                 const LhsEval Rv(0.0);
                 const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
                 return
                     bg*referenceDensity(gasPhaseIdx, regionIdx)
@@ -721,7 +729,7 @@ public:
             // immiscible gas
             const LhsEval Rv(0.0);
             const LhsEval Rvw(0.0);
-            const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+            const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
 
             return referenceDensity(phaseIdx, regionIdx)*bg;
 
@@ -733,7 +741,7 @@ public:
                  // miscible in water
                 const auto& saltConcentration = decay<LhsEval>(fluidState.saltConcentration());
                 const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
-                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                const LhsEval& bw = inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
                 return
                     bw*referenceDensity(waterPhaseIdx, regionIdx)
                     + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
@@ -760,6 +768,7 @@ public:
                                                 unsigned phaseIdx,
                                                 unsigned regionIdx)
     {
+        const auto& inst = instance();
         OPM_TIMEBLOCK_LOCAL(inverseFormationVolumeFactor);
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
@@ -772,59 +781,59 @@ public:
             if (enableDissolvedGas()) {
                 const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rs >= (1.0 - 1e-10)*inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                    return inst.oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
                 } else {
-                    return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+                    return inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
                 }
             }
 
             const LhsEval Rs(0.0);
-            return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+            return inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
         }
         case gasPhaseIdx: {
             if (enableVaporizedOil() && enableVaporizedWater()) {
                  const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                  const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                  if (useSaturatedTables() && fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
+                    && Rvw >= (1.0 - 1e-10)*inst.gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
                     && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rv >= (1.0 - 1e-10)*inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                  {
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                    return inst.gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
                  } else {
-                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                    return inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
                  }
             }
 
             if (enableVaporizedOil()) {
                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rv >= (1.0 - 1e-10)*inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                    return inst.gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
                 } else {
                     const LhsEval Rvw(0.0);
-                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                    return inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
                 }
             }
 
             if (enableVaporizedWater()) {
                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rvw >= (1.0 - 1e-10)*inst.gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                    return inst.gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
                 } else {
                     const LhsEval Rv(0.0);
-                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                    return inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
                 }
             }
 
             const LhsEval Rv(0.0);
             const LhsEval Rvw(0.0);
-            return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+            return inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
         }
         case waterPhaseIdx:
         {
@@ -832,15 +841,15 @@ public:
             if (enableDissolvedGasInWater()) {
                 const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
+                    && Rsw >= (1.0 - 1e-10)*inst.waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
                 {
-                    return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
+                    return inst.waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
                 } else {
-                    return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                    return inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
                 }
             }
             const LhsEval Rsw(0.0);
-            return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+            return inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
         }
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
         }
@@ -860,6 +869,7 @@ public:
                                                          unsigned phaseIdx,
                                                          unsigned regionIdx)
     {
+        const auto& inst = instance();
         OPM_TIMEBLOCK_LOCAL(saturatedInverseFormationVolumeFactor);
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
@@ -869,9 +879,9 @@ public:
         const auto& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
 
         switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-        case gasPhaseIdx: return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-        case waterPhaseIdx: return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
+        case oilPhaseIdx: return inst.oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+        case gasPhaseIdx: return inst.gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+        case waterPhaseIdx: return inst.waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
         }
     }
@@ -883,6 +893,7 @@ public:
                                        unsigned compIdx,
                                        unsigned regionIdx)
     {
+        const auto& inst = instance();
         assert(phaseIdx <= numPhases);
         assert(compIdx <= numComponents);
         assert(regionIdx <= numRegions());
@@ -918,11 +929,11 @@ public:
                     // immiscible with the oil component
                     return phi_gG*1e6;
 
-                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+                const auto& R_vSat = inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
                 const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
                 const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
 
-                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+                const auto& R_sSat = inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
                 const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
                 const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
                 const auto& x_oOSat = 1.0 - x_oGSat;
@@ -954,12 +965,12 @@ public:
                     // immiscible with the gas component
                     return phi_oO*1e6;
 
-                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+                const auto& R_vSat = inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
                 const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
                 const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
                 const auto& x_gGSat = 1.0 - x_gOSat;
 
-                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+                const auto& R_sSat = inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
                 const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
                 const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
 
@@ -1004,6 +1015,7 @@ public:
                              unsigned phaseIdx,
                              unsigned regionIdx)
     {
+        const auto& inst = instance();
         OPM_TIMEBLOCK_LOCAL(viscosity);
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
@@ -1016,16 +1028,16 @@ public:
             if (enableDissolvedGas()) {
                 const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rs >= (1.0 - 1e-10)*inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return oilPvt_->saturatedViscosity(regionIdx, T, p);
+                    return inst.oilPvt_->saturatedViscosity(regionIdx, T, p);
                 } else {
-                    return oilPvt_->viscosity(regionIdx, T, p, Rs);
+                    return inst.oilPvt_->viscosity(regionIdx, T, p, Rs);
                 }
             }
 
             const LhsEval Rs(0.0);
-            return oilPvt_->viscosity(regionIdx, T, p, Rs);
+            return inst.oilPvt_->viscosity(regionIdx, T, p, Rs);
         }
 
         case gasPhaseIdx: {
@@ -1033,41 +1045,41 @@ public:
                  const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                  const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                  if (useSaturatedTables() && fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
+                    && Rvw >= (1.0 - 1e-10)*inst.gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
                     && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rv >= (1.0 - 1e-10)*inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                  {
-                     return gasPvt_->saturatedViscosity(regionIdx, T, p);
+                     return inst.gasPvt_->saturatedViscosity(regionIdx, T, p);
                  } else {
-                     return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                     return inst.gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
                  }
             }
             if (enableVaporizedOil()) {
                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rv >= (1.0 - 1e-10)*inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return gasPvt_->saturatedViscosity(regionIdx, T, p);
+                    return inst.gasPvt_->saturatedViscosity(regionIdx, T, p);
                 } else {
                     const LhsEval Rvw(0.0);
-                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                    return inst.gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
                 }
             }
             if (enableVaporizedWater()) {
                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                    && Rvw >= (1.0 - 1e-10)*inst.gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
                 {
-                    return gasPvt_->saturatedViscosity(regionIdx, T, p);
+                    return inst.gasPvt_->saturatedViscosity(regionIdx, T, p);
                 } else {
                     const LhsEval Rv(0.0);
-                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                    return inst.gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
                 }
             }
 
             const LhsEval Rv(0.0);
             const LhsEval Rvw(0.0);
-            return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+            return inst.gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
         }
 
         case waterPhaseIdx:
@@ -1076,15 +1088,15 @@ public:
             if (enableDissolvedGasInWater()) {
                 const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 if (useSaturatedTables() && fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
+                    && Rsw >= (1.0 - 1e-10)*inst.waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
                 {
-                    return waterPvt_->saturatedViscosity(regionIdx, T, p, saltConcentration);
+                    return inst.waterPvt_->saturatedViscosity(regionIdx, T, p, saltConcentration);
                 } else {
-                    return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
+                    return inst.waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
                 }
             }
             const LhsEval Rsw(0.0);
-            return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
+            return inst.waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
         }
         }
 
@@ -1095,15 +1107,16 @@ public:
     static LhsEval internalEnergy(const FluidState& fluidState,
                                   unsigned phaseIdx,
                                   unsigned regionIdx){
+        const auto& inst = instance();
         bool is_mixing = false;
         const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
         const LhsEval& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
 
         switch (phaseIdx) {
         case oilPhaseIdx: {
-            if(!oilPvt_->mixingEnergy()){
+            if(!inst.oilPvt_->mixingEnergy()){
                 const auto& oilEnergy =
-                    oilPvt_->internalEnergy(regionIdx, T, p,
+                    inst.oilPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
 
                 return oilEnergy;
@@ -1112,9 +1125,9 @@ public:
             break;
         }
         case waterPhaseIdx: {
-            if(!waterPvt_->mixingEnergy()){
+            if(!inst.waterPvt_->mixingEnergy()){
                 const auto waterEnergy =
-                    waterPvt_->internalEnergy(regionIdx, T, p,
+                    inst.waterPvt_->internalEnergy(regionIdx, T, p,
                                               BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                               BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
 
@@ -1124,9 +1137,9 @@ public:
             break;
         }
         case gasPhaseIdx: {
-            if(!gasPvt_->mixingEnergy()){
+            if(!inst.gasPvt_->mixingEnergy()){
                 const auto gasEnergy =
-                    gasPvt_->internalEnergy(regionIdx, T, p,
+                    inst.gasPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                             BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
 
@@ -1148,6 +1161,7 @@ public:
                                              unsigned phaseIdx,
                                              unsigned regionIdx)
     {
+        const auto& inst = instance();
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
         const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
@@ -1156,19 +1170,19 @@ public:
         // to avoid putting all thermal into the interface of the multiplexer
         switch (phaseIdx) {
         case oilPhaseIdx: {
-            auto oilEnergy = oilPvt_->internalEnergy(regionIdx, T, p,
+            auto oilEnergy = inst.oilPvt_->internalEnergy(regionIdx, T, p,
                                                      BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-            assert(oilPvt_->mixingEnergy());
+            assert(inst.oilPvt_->mixingEnergy());
             //mixing energy adsed
             if (enableDissolvedGas()) {
                 // miscible oil
                 const LhsEval& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+                const LhsEval& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
                 const auto& gasEnergy =
-                    gasPvt_->internalEnergy(regionIdx, T, p,
+                    inst.gasPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                             BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-                const auto hVapG = gasPvt_->hVap(regionIdx);// pressure correction ? assume equal to energy change
+                const auto hVapG = inst.gasPvt_->hVap(regionIdx);// pressure correction ? assume equal to energy change
                 return
                     oilEnergy*bo*referenceDensity(oilPhaseIdx, regionIdx)
                     + (gasEnergy-hVapG)*Rs*bo*referenceDensity(gasPhaseIdx, regionIdx);
@@ -1176,31 +1190,31 @@ public:
 
             // immiscible oil
             const LhsEval Rs(0.0);
-            const auto& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+            const auto& bo = inst.oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
 
             return oilEnergy*referenceDensity(phaseIdx, regionIdx)*bo;
         }
 
         case gasPhaseIdx: {
             const auto& gasEnergy =
-                gasPvt_->internalEnergy(regionIdx, T, p,
+                inst.gasPvt_->internalEnergy(regionIdx, T, p,
                                         BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                         BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-            assert(gasPvt_->mixingEnergy());
+            assert(inst.gasPvt_->mixingEnergy());
             if (enableVaporizedOil() && enableVaporizedWater()) {
                 const auto& oilEnergy =
-                    oilPvt_->internalEnergy(regionIdx, T, p,
+                    inst.oilPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
                 const auto waterEnergy =
-                    waterPvt_->internalEnergy(regionIdx, T, p,
+                    inst.waterPvt_->internalEnergy(regionIdx, T, p,
                                               BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                               BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
                 // gas containing vaporized oil and vaporized water
                 const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
                 const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-                const auto hVapO = oilPvt_->hVap(regionIdx);
-                const auto hVapW = waterPvt_->hVap(regionIdx);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const auto hVapO = inst.oilPvt_->hVap(regionIdx);
+                const auto hVapW = inst.waterPvt_->hVap(regionIdx);
                 return
                     gasEnergy*bg*referenceDensity(gasPhaseIdx, regionIdx)
                     + (oilEnergy+hVapO)*Rv*bg*referenceDensity(oilPhaseIdx, regionIdx)
@@ -1208,13 +1222,13 @@ public:
             }
             if (enableVaporizedOil()) {
                 const auto& oilEnergy =
-                    oilPvt_->internalEnergy(regionIdx, T, p,
+                    inst.oilPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
                 // miscible gas
                 const LhsEval Rvw(0.0);
                 const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-                const auto hVapO = oilPvt_->hVap(regionIdx);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const auto hVapO = inst.oilPvt_->hVap(regionIdx);
                 return
                     gasEnergy*bg*referenceDensity(gasPhaseIdx, regionIdx)
                     + (oilEnergy+hVapO)*Rv*bg*referenceDensity(oilPhaseIdx, regionIdx);
@@ -1223,12 +1237,12 @@ public:
                 // gas containing vaporized water
                 const LhsEval Rv(0.0);
                 const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                const LhsEval& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
                 const auto waterEnergy =
-                    waterPvt_->internalEnergy(regionIdx, T, p,
+                    inst.waterPvt_->internalEnergy(regionIdx, T, p,
                                               BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                               BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-                const auto hVapW = waterPvt_->hVap(regionIdx);
+                const auto hVapW = inst.waterPvt_->hVap(regionIdx);
                 return
                     gasEnergy*bg*referenceDensity(gasPhaseIdx, regionIdx)
                     + (waterEnergy+hVapW)*Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
@@ -1237,24 +1251,24 @@ public:
             // immiscible gas
             const LhsEval Rv(0.0);
             const LhsEval Rvw(0.0);
-            const auto& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+            const auto& bg = inst.gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
             return gasEnergy*bg*referenceDensity(phaseIdx, regionIdx);
         }
 
         case waterPhaseIdx:
             const auto waterEnergy =
-                waterPvt_->internalEnergy(regionIdx, T, p,
+                inst.waterPvt_->internalEnergy(regionIdx, T, p,
                                           BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                           BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-            assert(waterPvt_->mixingEnergy());
+            assert(inst.waterPvt_->mixingEnergy());
             if (enableDissolvedGasInWater()) {
                 const auto& gasEnergy =
-                    gasPvt_->internalEnergy(regionIdx, T, p,
+                    inst.gasPvt_->internalEnergy(regionIdx, T, p,
                                             BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
                                             BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
                 // gas miscible in water
                 const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
-                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                const LhsEval& bw = inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
                 return
                     waterEnergy*bw*referenceDensity(waterPhaseIdx, regionIdx)
                     + gasEnergy*Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
@@ -1262,7 +1276,7 @@ public:
             const LhsEval Rsw(0.0);
             return
                 waterEnergy*referenceDensity(waterPhaseIdx, regionIdx)
-                * waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                * inst.waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
         }
         throw std::logic_error("Unhandled phase index " + std::to_string(phaseIdx));
     }
@@ -1278,7 +1292,7 @@ public:
         // should preferably not be used values should be taken from intensive quantities fluid state.
         const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
         auto energy = internalEnergy<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
-        if(!enthalpy_eq_energy_){
+        if(!instance().enthalpy_eq_energy_){
             // used for simplified models
             energy += p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
         }
@@ -1305,7 +1319,7 @@ public:
 
         switch (phaseIdx) {
         case oilPhaseIdx: return 0.0;
-        case gasPhaseIdx: return gasPvt_->saturatedWaterVaporizationFactor(regionIdx, T, p, saltConcentration);
+        case gasPhaseIdx: return instance().gasPvt_->saturatedWaterVaporizationFactor(regionIdx, T, p, saltConcentration);
         case waterPhaseIdx: return 0.0;
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
         }
@@ -1323,6 +1337,7 @@ public:
                                               unsigned regionIdx,
                                               const LhsEval& maxOilSaturation)
     {
+        const auto& inst = instance();
         OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
@@ -1332,9 +1347,9 @@ public:
         const auto& So = (phaseIdx == waterPhaseIdx) ? 0 : decay<LhsEval>(fluidState.saturation(oilPhaseIdx));
 
         switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p, So, maxOilSaturation);
-        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p, So, maxOilSaturation);
-        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
+        case oilPhaseIdx: return inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p, So, maxOilSaturation);
+        case gasPhaseIdx: return inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p, So, maxOilSaturation);
+        case waterPhaseIdx: return inst.waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
         BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
         }
@@ -1353,6 +1368,7 @@ public:
                                               unsigned phaseIdx,
                                               unsigned regionIdx)
     {
+        const auto& inst = instance();
         OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
@@ -1361,9 +1377,9 @@ public:
         const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
 
         switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
-        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
-        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
+        case oilPhaseIdx: return inst.oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+        case gasPhaseIdx: return inst.gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+        case waterPhaseIdx: return inst.waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
         BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
         }
@@ -1405,15 +1421,16 @@ public:
                                       unsigned phaseIdx,
                                       unsigned regionIdx)
     {
+        const auto& inst = instance();
         assert(phaseIdx <= numPhases);
         assert(regionIdx <= numRegions());
 
         const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
 
         switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturationPressure(regionIdx, T, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        case gasPhaseIdx: return gasPvt_->saturationPressure(regionIdx, T, BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        case waterPhaseIdx: return waterPvt_->saturationPressure(regionIdx, T,
+        case oilPhaseIdx: return inst.oilPvt_->saturationPressure(regionIdx, T, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        case gasPhaseIdx: return inst.gasPvt_->saturationPressure(regionIdx, T, BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        case waterPhaseIdx: return inst.waterPvt_->saturationPressure(regionIdx, T,
         BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
         BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
         default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
@@ -1430,8 +1447,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXoGToRs(const LhsEval& XoG, unsigned regionIdx)
     {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_oRef = inst.referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         return XoG/(1.0 - XoG)*(rho_oRef/rho_gRef);
     }
@@ -1443,8 +1461,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXwGToRsw(const LhsEval& XwG, unsigned regionIdx)
     {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_wRef = inst.referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         return XwG/(1.0 - XwG)*(rho_wRef/rho_gRef);
     }
@@ -1456,8 +1475,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXgOToRv(const LhsEval& XgO, unsigned regionIdx)
     {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_oRef = inst.referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         return XgO/(1.0 - XgO)*(rho_gRef/rho_oRef);
     }
@@ -1469,8 +1489,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXgWToRvw(const LhsEval& XgW, unsigned regionIdx)
     {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_wRef = inst.referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         return XgW/(1.0 - XgW)*(rho_gRef/rho_wRef);
     }
@@ -1483,8 +1504,9 @@ public:
     template <class LhsEval>
     static LhsEval convertRsToXoG(const LhsEval& Rs, unsigned regionIdx)
     {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_oRef = inst.referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         const LhsEval& rho_oG = Rs*rho_gRef;
         return rho_oG/(rho_oRef + rho_oG);
@@ -1497,8 +1519,9 @@ public:
     template <class LhsEval>
     static LhsEval convertRswToXwG(const LhsEval& Rsw, unsigned regionIdx)
     {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_wRef = inst.referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         const LhsEval& rho_wG = Rsw*rho_gRef;
         return rho_wG/(rho_wRef + rho_wG);
@@ -1511,8 +1534,9 @@ public:
     template <class LhsEval>
     static LhsEval convertRvToXgO(const LhsEval& Rv, unsigned regionIdx)
     {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_oRef = inst.referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         const LhsEval& rho_gO = Rv*rho_oRef;
         return rho_gO/(rho_gRef + rho_gO);
@@ -1525,8 +1549,9 @@ public:
     template <class LhsEval>
     static LhsEval convertRvwToXgW(const LhsEval& Rvw, unsigned regionIdx)
     {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+        const auto& inst = instance();
+        Scalar rho_wRef = inst.referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = inst.referenceDensity_[regionIdx][gasPhaseIdx];
 
         const LhsEval& rho_gW = Rvw*rho_wRef;
         return rho_gW/(rho_gRef + rho_gW);
@@ -1538,8 +1563,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXgWToxgW(const LhsEval& XgW, unsigned regionIdx)
     {
-        Scalar MW = molarMass_[regionIdx][waterCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MW = inst.molarMass_[regionIdx][waterCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return XgW*MG / (MW*(1 - XgW) + XgW*MG);
     }
@@ -1550,8 +1576,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXwGToxwG(const LhsEval& XwG, unsigned regionIdx)
     {
-        Scalar MW = molarMass_[regionIdx][waterCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MW = inst.molarMass_[regionIdx][waterCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return XwG*MW / (MG*(1 - XwG) + XwG*MW);
     }
@@ -1562,8 +1589,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXoGToxoG(const LhsEval& XoG, unsigned regionIdx)
     {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MO = inst.molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return XoG*MO / (MG*(1 - XoG) + XoG*MO);
     }
@@ -1574,8 +1602,9 @@ public:
     template <class LhsEval>
     static LhsEval convertxoGToXoG(const LhsEval& xoG, unsigned regionIdx)
     {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MO = inst.molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return xoG*MG / (xoG*(MG - MO) + MO);
     }
@@ -1586,8 +1615,9 @@ public:
     template <class LhsEval>
     static LhsEval convertXgOToxgO(const LhsEval& XgO, unsigned regionIdx)
     {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MO = inst.molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return XgO*MG / (MO*(1 - XgO) + XgO*MG);
     }
@@ -1598,8 +1628,9 @@ public:
     template <class LhsEval>
     static LhsEval convertxgOToXgO(const LhsEval& xgO, unsigned regionIdx)
     {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+        const auto& inst = instance();
+        Scalar MO = inst.molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = inst.molarMass_[regionIdx][gasCompIdx];
 
         return xgO*MO / (xgO*(MO - MG) + MG);
     }
@@ -1612,7 +1643,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const GasPvt& gasPvt()
-    { return *gasPvt_; }
+    { return *instance().gasPvt_; }
 
     /*!
      * \brief Return a reference to the low-level object which calculates the oil phase
@@ -1622,7 +1653,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const OilPvt& oilPvt()
-    { return *oilPvt_; }
+    { return *instance().oilPvt_; }
 
     /*!
      * \brief Return a reference to the low-level object which calculates the water phase
@@ -1632,7 +1663,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const WaterPvt& waterPvt()
-    { return *waterPvt_; }
+    { return *instance().waterPvt_; }
 
     /*!
      * \brief Set the temperature of the reservoir.
@@ -1640,7 +1671,7 @@ public:
      * This method is black-oil specific and only makes sense for isothermal simulations.
      */
     static Scalar reservoirTemperature(unsigned = 0)
-    { return reservoirTemperature_; }
+    { return instance().reservoirTemperature_; }
 
     /*!
      * \brief Return the temperature of the reservoir.
@@ -1648,7 +1679,7 @@ public:
      * This method is black-oil specific and only makes sense for isothermal simulations.
      */
     static void setReservoirTemperature(Scalar value)
-    { reservoirTemperature_ = value; }
+    { instance().reservoirTemperature_ = value; }
 
     static short activeToCanonicalPhaseIdx(unsigned activePhaseIdx);
 
@@ -1656,11 +1687,11 @@ public:
 
     //! \copydoc BaseFluidSystem::diffusionCoefficient
     static Scalar diffusionCoefficient(unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0)
-    { return diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx]; }
+    { return instance().diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx]; }
 
     //! \copydoc BaseFluidSystem::setDiffusionCoefficient
     static void setDiffusionCoefficient(Scalar coefficient, unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0)
-    { diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx] = coefficient ; }
+    { instance().diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx] = coefficient ; }
 
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
@@ -1676,7 +1707,7 @@ public:
             return 0.0;
 
         // diffusion coefficients are set, and we use them
-        if(!diffusionCoefficients_.empty()) {
+        if(!instance().diffusionCoefficients_.empty()) {
             return diffusionCoefficient(compIdx, phaseIdx, paramCache.regionIndex());
         }
 
@@ -1691,66 +1722,126 @@ public:
         }
     }
     static void setEnergyEqualEnthalpy(bool enthalpy_eq_energy){
-        enthalpy_eq_energy_ = enthalpy_eq_energy;
+        instance().enthalpy_eq_energy_ = enthalpy_eq_energy;
     }
 
     static bool enthalpyEqualEnergy(){
-        return enthalpy_eq_energy_;
+        return instance().enthalpy_eq_energy_;
     }
 
-private:
-    static void resizeArrays_(std::size_t numRegions);
+    /*!
+     * \brief The state of one black-oil fluid system.
+     *
+     * This holds everything which is set up by initFromState() or by initBegin() and
+     * initEnd(). The static methods of the fluid system operate on the instance which is
+     * bound to the calling thread, see bindInstance(). Threads which did not bind an
+     * instance use a process-wide default one, so code which uses a single fluid system
+     * does not need to care about instances at all.
+     *
+     * Copies share the PVT objects of the original, so several models of the same deck
+     * can be run from the same tables. The PVT objects are read-only after
+     * initialization; setVapPars() modifies them for all instances which share them.
+     * The surface pressure and temperature are part of the instance as well, see
+     * standardPressure() and standardTemperature(); the deprecated static
+     * surfacePressure and surfaceTemperature members only follow the default instance.
+     */
+    class Instance
+    {
+        friend class BlackOilFluidSystem;
+
+        Scalar reservoirTemperature_ = 0.0;
+        Scalar surfacePressure_ = 0.0;
+        Scalar surfaceTemperature_ = 0.0;
+
+        std::shared_ptr<GasPvt> gasPvt_{};
+        std::shared_ptr<OilPvt> oilPvt_{};
+        std::shared_ptr<WaterPvt> waterPvt_{};
+
+        bool enableDissolvedGas_ = true;
+        bool enableDissolvedGasInWater_ = false;
+        bool enableVaporizedOil_ = false;
+        bool enableVaporizedWater_ = false;
+        bool enableDiffusion_ = false;
+
+        std::vector<std::array<Scalar, numPhases> > referenceDensity_{};
+        std::vector<std::array<Scalar, numComponents> > molarMass_{};
+        std::vector<std::array<Scalar, numComponents * numPhases> > diffusionCoefficients_{};
+
+        unsigned char numActivePhases_ = 0;
+        std::array<bool, numPhases> phaseIsActive_{false, false, false};
+        std::array<short, numPhases> activeToCanonicalPhaseIdx_{0, 1, 2};
+        std::array<short, numPhases> canonicalToActivePhaseIdx_{0, 1, 2};
+
+        bool isInitialized_ = false;
+        bool useSaturatedTables_ = false;
+        bool enthalpy_eq_energy_ = false;
+    };
+
+    /*!
+     * \brief Return the fluid system instance which is bound to the calling thread.
+     *
+     * Methods which access several members look the instance up once, since this is
+     * a thread-local lookup.
+     */
+    static Instance& instance()
+    { return *boundInstance_; }
 
-    static Scalar reservoirTemperature_;
+    /*!
+     * \brief Bind a fluid system instance to the calling thread.
+     *
+     * All subsequent calls to the static methods of the fluid system from this thread,
+     * including the initialization ones, use this instance. Passing nullptr binds the
+     * process-wide default instance again. The instance must outlive the binding.
+     *
+     * The binding is not inherited by other threads: worker threads, e.g. those of an
+     * OpenMP parallel region, use the default instance unless they bind the instance
+     * themselves, typically through a ScopedInstance at the start of the parallel
+     * region.
+     *
+     * \return The previously bound instance.
+     */
+    static Instance* bindInstance(Instance* inst)
+    {
+        Instance* previous = boundInstance_;
+        boundInstance_ = inst ? inst : &defaultInstance_;
+        return previous;
+    }
+
+    /*!
+     * \brief Binds a fluid system instance to the calling thread for the lifetime of
+     *        the object.
+     */
+    class ScopedInstance
+    {
+    public:
+        explicit ScopedInstance(Instance& inst)
+            : previous_(bindInstance(&inst))
+        {}
 
-    static std::shared_ptr<GasPvt> gasPvt_;
-    static std::shared_ptr<OilPvt> oilPvt_;
-    static std::shared_ptr<WaterPvt> waterPvt_;
+        ScopedInstance(const ScopedInstance&) = delete;
+        ScopedInstance& operator=(const ScopedInstance&) = delete;
 
-    static bool enableDissolvedGas_;
-    static bool enableDissolvedGasInWater_;
-    static bool enableVaporizedOil_;
-    static bool enableVaporizedWater_;
-    static bool enableDiffusion_;
+        ~ScopedInstance()
+        { bindInstance(previous_); }
 
-    // HACK for GCC 4.4: the array size has to be specified using the literal value '3'
-    // here, because GCC 4.4 seems to be unable to determine the number of phases from
-    // the BlackOil fluid system in the attribute declaration below...
-    static std::vector<std::array<Scalar, /*numPhases=*/3> > referenceDensity_;
-    static std::vector<std::array<Scalar, /*numComponents=*/3> > molarMass_;
-    static std::vector<std::array<Scalar, /*numComponents=*/3 * /*numPhases=*/3> > diffusionCoefficients_;
+    private:
+        Instance* previous_;
+    };
 
-    static std::array<short, numPhases> activeToCanonicalPhaseIdx_;
-    static std::array<short, numPhases> canonicalToActivePhaseIdx_;
+private:
+    static void resizeArrays_(std::size_t numRegions);
+    static void setSurfaceConditions_(Scalar temperature, Scalar pressure);
 
-    static bool isInitialized_;
-    static bool useSaturatedTables_;
-    inline static bool enthalpy_eq_energy_ = false;
+    static Instance defaultInstance_;
+    inline static thread_local Instance* boundInstance_ = &defaultInstance_;
 };
 
 template <typename T> using BOFS = BlackOilFluidSystem<T, BlackOilDefaultIndexTraits>;
 
 #define DECLARE_INSTANCE(T) \
-template<> unsigned char BOFS<T>::numActivePhases_; \
-template<> std::array<bool, BOFS<T>::numPhases> BOFS<T>::phaseIsActive_; \
-template<> std::array<short, BOFS<T>::numPhases> BOFS<T>::activeToCanonicalPhaseIdx_; \
-template<> std::array<short, BOFS<T>::numPhases> BOFS<T>::canonicalToActivePhaseIdx_; \
 template<> T BOFS<T>::surfaceTemperature; \
 template<> T BOFS<T>::surfacePressure; \
-template<> T BOFS<T>::reservoirTemperature_; \
-template<> bool BOFS<T>::enableDissolvedGas_; \
-template<> bool BOFS<T>::enableDissolvedGasInWater_; \
-template<> bool BOFS<T>::enableVaporizedOil_; \
-template<> bool BOFS<T>::enableVaporizedWater_; \
-template<> bool BOFS<T>::enableDiffusion_; \
-template<> std::shared_ptr<OilPvtMultiplexer<T>> BOFS<T>::oilPvt_; \
-template<> std::shared_ptr<GasPvtMultiplexer<T>> BOFS<T>::gasPvt_; \
-template<> std::shared_ptr<WaterPvtMultiplexer<T>> BOFS<T>::waterPvt_; \
-template<> std::vector<std::array<T, 3>> BOFS<T>::referenceDensity_; \
-template<> std::vector<std::array<T, 3>> BOFS<T>::molarMass_; \
-template<> std::vector<std::array<T, 9>> BOFS<T>::diffusionCoefficients_; \
-template<> bool BOFS<T>::isInitialized_; \
-template<> bool BOFS<T>::useSaturatedTables_;
+template<> BOFS<T>::Instance BOFS<T>::defaultInstance_;
 
 DECLARE_INSTANCE(float)
 DECLARE_INSTANCE(double)
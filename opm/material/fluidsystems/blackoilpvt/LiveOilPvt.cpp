@@ -228,6 +228,8 @@ void LiveOilPvt<Scalar>::setNumRegions(std::size_t numRegions)
     saturatedOilMuTable_.resize(numRegions);
     saturatedGasDissolutionFactorTable_.resize(numRegions);
     saturationPressure_.resize(numRegions);
+    exactSaturationPressure_.resize(numRegions, false);
+    sharedSaturatedSamplingPoints_.resize(numRegions, false);
 }
 
 template<class Scalar>
@@ -339,6 +341,9 @@ void LiveOilPvt<Scalar>::initEnd()
         invSatOilB.setXYContainers(satPressuresArray, invSatOilBArray);
         invSatOilBMu.setXYContainers(satPressuresArray, invSatOilBMuArray);
 
+        sharedSaturatedSamplingPoints_[regionIdx] =
+            invSatOilB.hasSameSamplingPoints(saturatedGasDissolutionFactorTable_[regionIdx]);
+
         updateSaturationPressure_(regionIdx);
     }
 }
@@ -348,6 +353,18 @@ void LiveOilPvt<Scalar>::updateSaturationPressure_(unsigned regionIdx)
 {
     const auto& gasDissolutionFac = saturatedGasDissolutionFactorTable_[regionIdx];
 
+    // A strictly monotonic piecewise linear function is inverted exactly by swapping
+    // its sampling points. saturationPressure() then does not need to iterate.
+    exactSaturationPressure_[regionIdx] = gasDissolutionFac.isStrictlyMonotonic();
+    if (exactSaturationPressure_[regionIdx]) {
+        SamplingPoints pSatSamplePoints;
+        for (std::size_t i = 0; i < gasDissolutionFac.numSamples(); ++i)
+            pSatSamplePoints.emplace_back(gasDissolutionFac.valueAt(i), gasDissolutionFac.xAt(i));
+
+        saturationPressure_[regionIdx].setContainerOfTuples(pSatSamplePoints);
+        return;
+    }
+
     // create the function representing saturation pressure depending of the mass
     // fraction in gas
     std::size_t n = gasDissolutionFac.numSamples();
@@ -34,6 +34,8 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -275,6 +277,13 @@ public:
                                   const Evaluation&,
                                   const Evaluation& Rs) const
     {
+        // a strictly monotonic Rs(p) table is inverted exactly by the tabulated
+        // saturation pressure function, see updateSaturationPressure_()
+        if (exactSaturationPressure_[regionIdx]) {
+            const Evaluation pSat = saturationPressure_[regionIdx].eval(Rs, /*extrapolate=*/true);
+            return pSat < 0.0 ? Evaluation(0.0) : pSat;
+        }
+
         using Toolbox = MathToolbox<Evaluation>;
 
         const auto& RsTable = saturatedGasDissolutionFactorTable_[regionIdx];
@@ -325,6 +334,37 @@ public:
         throw NumericalProblem(msg);
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-], the viscosity [Pa s] and
+     *        the gas dissolution factor [m^3/m^3] of gas saturated oil for a batch of pressures.
+     *
+     * This is equivalent to calling saturatedInverseFormationVolumeFactor(),
+     * saturatedViscosity() and saturatedGasDissolutionFactor() for each of the n
+     * pressures, but the table segment of each pressure is only looked up once.
+     */
+    template <class Evaluation>
+    void saturatedProperties(unsigned regionIdx,
+                             std::size_t n,
+                             const Evaluation* pressure,
+                             Evaluation* invB,
+                             Evaluation* mu,
+                             Evaluation* Rs) const
+    {
+        const auto& invBTable = inverseSaturatedOilBTable_[regionIdx];
+        const auto& invBMuTable = inverseSaturatedOilBMuTable_[regionIdx];
+        const auto& RsTable = saturatedGasDissolutionFactorTable_[regionIdx];
+        const bool sameSamplingPoints = sharedSaturatedSamplingPoints_[regionIdx];
+
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto segIdx = invBTable.findSegmentIndex(pressure[k], /*extrapolate=*/true);
+            invB[k] = invBTable.eval(pressure[k], segIdx);
+            mu[k] = invB[k] / invBMuTable.eval(pressure[k], segIdx);
+            Rs[k] = sameSamplingPoints
+                ? RsTable.eval(pressure[k], segIdx)
+                : RsTable.eval(pressure[k], /*extrapolate=*/true);
+        }
+    }
+
     template <class Evaluation>
     Evaluation diffusionCoefficient(const Evaluation& /*temperature*/,
                                     const Evaluation& /*pressure*/,
@@ -380,6 +420,8 @@ private:
     std::vector<TabulatedOneDFunction> inverseSaturatedOilBMuTable_{};
     std::vector<TabulatedOneDFunction> saturatedGasDissolutionFactorTable_{};
     std::vector<TabulatedOneDFunction> saturationPressure_{};
+    std::vector<bool> exactSaturationPressure_{};
+    std::vector<bool> sharedSaturatedSamplingPoints_{};
 
     Scalar vapPar2_ = 0.0;
 };
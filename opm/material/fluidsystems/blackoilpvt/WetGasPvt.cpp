@@ -228,6 +228,8 @@ void WetGasPvt<Scalar>::setNumRegions(std::size_t numRegions)
     gasMu_.resize(numRegions, TabulatedTwoDFunction{TabulatedTwoDFunction::InterpolationPolicy::RightExtreme});
     saturatedOilVaporizationFactorTable_.resize(numRegions);
     saturationPressure_.resize(numRegions);
+    exactSaturationPressure_.resize(numRegions, false);
+    sharedSaturatedSamplingPoints_.resize(numRegions, false);
 }
 
 template<class Scalar>
@@ -369,6 +371,9 @@ void WetGasPvt<Scalar>::initEnd()
         invSatGasB.setXYContainers(satPressuresArray, invSatGasBArray);
         invSatGasBMu.setXYContainers(satPressuresArray, invSatGasBMuArray);
 
+        sharedSaturatedSamplingPoints_[regionIdx] =
+            invSatGasB.hasSameSamplingPoints(saturatedOilVaporizationFactorTable_[regionIdx]);
+
         updateSaturationPressure_(regionIdx);
     }
 }
@@ -379,6 +384,18 @@ updateSaturationPressure_(unsigned regionIdx)
 {
     const auto& oilVaporizationFac = saturatedOilVaporizationFactorTable_[regionIdx];
 
+    // A strictly monotonic piecewise linear function is inverted exactly by swapping
+    // its sampling points. saturationPressure() then does not need to iterate.
+    exactSaturationPressure_[regionIdx] = oilVaporizationFac.isStrictlyMonotonic();
+    if (exactSaturationPressure_[regionIdx]) {
+        SamplingPoints pSatSamplePoints;
+        for (std::size_t i = 0; i < oilVaporizationFac.numSamples(); ++i)
+            pSatSamplePoints.emplace_back(oilVaporizationFac.valueAt(i), oilVaporizationFac.xAt(i));
+
+        saturationPressure_[regionIdx].setContainerOfTuples(pSatSamplePoints);
+        return;
+    }
+
     // create the taublated function representing saturation pressure depending of
     // Rv
     std::size_t n = oilVaporizationFac.numSamples();
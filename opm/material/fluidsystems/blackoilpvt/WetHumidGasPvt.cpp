@@ -415,6 +415,8 @@ void WetHumidGasPvt<Scalar>::setNumRegions(std::size_t numRegions)
     saturatedWaterVaporizationSaltFactorTable_.resize(numRegions, TabulatedTwoDFunction{TabulatedTwoDFunction::InterpolationPolicy::RightExtreme});
     saturatedOilVaporizationFactorTable_.resize(numRegions);
     saturationPressure_.resize(numRegions);
+    exactSaturationPressure_.resize(numRegions, false);
+    sharedSaturatedSamplingPoints_.resize(numRegions, false);
 }
 
 template<class Scalar>
@@ -514,6 +516,9 @@ void WetHumidGasPvt<Scalar>::initEnd()
         invSatGasB.setXYContainers(satPressuresArray, invSatGasBArray);
         invSatGasBMu.setXYContainers(satPressuresArray, invSatGasBMuArray);
 
+        sharedSaturatedSamplingPoints_[regionIdx] =
+            invSatGasB.hasSameSamplingPoints(saturatedOilVaporizationFactorTable_[regionIdx]);
+
         updateSaturationPressure_(regionIdx);
     }
 }
@@ -522,6 +527,20 @@ template<class Scalar>
 void WetHumidGasPvt<Scalar>::
 updateSaturationPressure_(unsigned regionIdx)
 {
+    // saturationPressure() inverts Rw(p). A strictly monotonic piecewise linear
+    // function is inverted exactly by swapping its sampling points, and
+    // saturationPressure() then does not need to iterate.
+    const auto& waterVaporizationFac = saturatedWaterVaporizationFactorTable_[regionIdx];
+    exactSaturationPressure_[regionIdx] = waterVaporizationFac.isStrictlyMonotonic();
+    if (exactSaturationPressure_[regionIdx]) {
+        SamplingPoints pSatSamplePoints;
+        for (std::size_t i = 0; i < waterVaporizationFac.numSamples(); ++i)
+            pSatSamplePoints.emplace_back(waterVaporizationFac.valueAt(i), waterVaporizationFac.xAt(i));
+
+        saturationPressure_[regionIdx].setContainerOfTuples(pSatSamplePoints);
+        return;
+    }
+
     const auto& oilVaporizationFac = saturatedOilVaporizationFactorTable_[regionIdx];
 
     // create the taublated function representing saturation pressure depending of
@@ -297,6 +297,13 @@ public:
                                   const Evaluation&,
                                   const Evaluation& Rw) const
     {
+        // a strictly monotonic Rw(p) table is inverted exactly by the tabulated
+        // saturation pressure function, see updateSaturationPressure_()
+        if (exactSaturationPressure_[regionIdx]) {
+            const Evaluation pSat = saturationPressure_[regionIdx].eval(Rw, /*extrapolate=*/true);
+            return pSat < 0.0 ? Evaluation(0.0) : pSat;
+        }
+
         using Toolbox = MathToolbox<Evaluation>;
 
         const auto& RwTable = saturatedWaterVaporizationFactorTable_[regionIdx];
@@ -347,6 +354,37 @@ public:
         throw NumericalProblem(msg);
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-], the viscosity [Pa s] and
+     *        the oil vaporization factor [m^3/m^3] of saturated gas for a batch of pressures.
+     *
+     * This is equivalent to calling saturatedInverseFormationVolumeFactor(),
+     * saturatedViscosity() and saturatedOilVaporizationFactor() for each of the n
+     * pressures, but the table segment of each pressure is only looked up once.
+     */
+    template <class Evaluation>
+    void saturatedProperties(unsigned regionIdx,
+                             std::size_t n,
+                             const Evaluation* pressure,
+                             Evaluation* invB,
+                             Evaluation* mu,
+                             Evaluation* Rv) const
+    {
+        const auto& invBTable = inverseSaturatedGasB_[regionIdx];
+        const auto& invBMuTable = inverseSaturatedGasBMu_[regionIdx];
+        const auto& RvTable = saturatedOilVaporizationFactorTable_[regionIdx];
+        const bool sameSamplingPoints = sharedSaturatedSamplingPoints_[regionIdx];
+
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto segIdx = invBTable.findSegmentIndex(pressure[k], /*extrapolate=*/true);
+            invB[k] = invBTable.eval(pressure[k], segIdx);
+            mu[k] = invB[k] / invBMuTable.eval(pressure[k], segIdx);
+            Rv[k] = sameSamplingPoints
+                ? RvTable.eval(pressure[k], segIdx)
+                : RvTable.eval(pressure[k], /*extrapolate=*/true);
+        }
+    }
+
     template <class Evaluation>
     Evaluation diffusionCoefficient(const Evaluation& /*temperature*/,
                                     const Evaluation& /*pressure*/,
@@ -413,6 +451,8 @@ private:
     std::vector<TabulatedTwoDFunction> saturatedWaterVaporizationSaltFactorTable_{};
     std::vector<TabulatedOneDFunction> saturatedOilVaporizationFactorTable_{};
     std::vector<TabulatedOneDFunction> saturationPressure_{};
+    std::vector<bool> exactSaturationPressure_{};
+    std::vector<bool> sharedSaturatedSamplingPoints_{};
 
     bool enableRwgSalt_ = false;
     Scalar vapPar1_ = 0.0;
@@ -28,6 +28,11 @@
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
@@ -53,15 +58,21 @@
 #include <opm/common/utility/String.hpp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 #include <vector>
@@ -95,6 +106,120 @@ void ensure_directory_exists(const std::filesystem::path& odir)
     }
 }
 
+/// FIFO queue of output jobs which are run by a single writer thread.
+class OutputQueue
+{
+public:
+    explicit OutputQueue(const std::size_t maxPending)
+        : maxPending_ { std::max(maxPending, std::size_t{1}) }
+        , thread_     { [this]() { this->run(); } }
+    {}
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    /// Runs all queued jobs before returning.  Errors are discarded.
+    ~OutputQueue()
+    {
+        {
+            std::lock_guard lock { this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->changed_.notify_all();
+        this->thread_.join();
+    }
+
+    /// Queue job, waiting for the number of pending jobs to drop below the
+    /// limit first.
+    void push(std::function<void()> job)
+    {
+        std::unique_lock lock { this->mutex_ };
+        this->changed_.wait(lock, [this]()
+        {
+            return this->error_ || (this->numPending() < this->maxPending_);
+        });
+
+        this->rethrowError();
+
+        this->jobs_.push_back(std::move(job));
+        this->changed_.notify_all();
+    }
+
+    /// Wait until all jobs have been run.
+    void wait()
+    {
+        std::unique_lock lock { this->mutex_ };
+        this->changed_.wait(lock, [this]()
+        {
+            return this->error_ || (this->numPending() == 0);
+        });
+
+        this->rethrowError();
+    }
+
+private:
+    std::size_t maxPending_;
+    std::mutex mutex_{};
+    std::condition_variable changed_{};
+    std::deque<std::function<void()>> jobs_{};
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+    std::thread thread_;
+
+    std::size_t numPending() const
+    {
+        return this->jobs_.size() + (this->busy_ ? 1 : 0);
+    }
+
+    void rethrowError()
+    {
+        if (this->error_) {
+            std::rethrow_exception(std::exchange(this->error_, nullptr));
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock lock { this->mutex_ };
+
+        while (true) {
+            this->changed_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->jobs_.empty();
+            });
+
+            if (this->jobs_.empty()) {
+                return;
+            }
+
+            auto job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+            this->busy_ = true;
+
+            lock.unlock();
+            auto error = std::exception_ptr{};
+            try {
+                job();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            this->busy_ = false;
+            if (error) {
+                // Later output would be inconsistent with the failed one.
+                this->error_ = error;
+                this->jobs_.clear();
+            }
+
+            this->changed_.notify_all();
+        }
+    }
+};
+
 } // Anonymous namespace
 
 class Opm::EclipseIO::Impl
@@ -133,6 +258,11 @@ public:
 
     std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
 
+    // Restart and RFT output jobs if output is asynchronous.  Declared
+    // last so that pending jobs complete before other members are
+    // destroyed.
+    std::unique_ptr<OutputQueue> outputQueue{};
+
 private:
     mutable bool sumthin_active_{false};
     mutable bool sumthin_triggered_{false};
@@ -267,7 +397,15 @@ Opm::EclipseIO::EclipseIO(const EclipseState&  es,
     ensure_directory_exists(this->impl->outputDir);
 }
 
-Opm::EclipseIO::~EclipseIO() = default;
+Opm::EclipseIO::~EclipseIO()
+{
+    try {
+        this->flush();
+    }
+    catch (const std::exception& e) {
+        OpmLog::error(std::string { "Restart output failed: " } + e.what());
+    }
+}
 
 // int_data: Writes key(string) and integers vector to INIT file as eclipse keywords
 //  - Key: Max 8 chars.
@@ -310,10 +448,8 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    const auto& es = this->impl->es;
     const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
 
     const bool final_step { report_step == static_cast<int>(schedule.size()) - 1 };
     const bool is_final_summary = final_step && !isSubstep;
@@ -334,39 +470,69 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         EclIO::ESmry(outputFile).write_rsm_file();
     }
 
-    if ( (time_step && *time_step > 0 ) || (!isSubstep && schedule.write_rst_file(report_step))) {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_index,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
-
-        RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
-    }
+    const bool write_restart = (time_step && *time_step > 0)
+        || (!isSubstep && schedule.write_rst_file(report_step));
 
     // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
+    const auto rft = this->impl->wantRFTOutput(report_step, isSubstep);
+    const bool write_rft = rft.first;
+    const bool haveExistingRFT = rft.second;
+
+    auto write_files = [impl = this->impl.get(), write_restart, report_index,
+                        write_rft, haveExistingRFT, report_step, secs_elapsed,
+                        write_double]
+        (const Action::State& action_state_,
+         const WellTestState& wtest_state_,
+         const SummaryState&  st_,
+         const UDQState&      udq_state_,
+         RestartValue&        value_)
     {
-        // Open existing RFT file if report step is after first RFT event.
-        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
-            haveExistingRFT
-        };
+        const auto& ioCfg = impl->es.cfg().io();
+
+        if (write_restart) {
+            EclIO::OutputStream::Restart rstFile {
+                EclIO::OutputStream::ResultSet { impl->outputDir,
+                                                 impl->baseName },
+                report_index,
+                EclIO::OutputStream::Formatted { ioCfg.getFMTOUT() },
+                EclIO::OutputStream::Unified   { ioCfg.getUNIFOUT() }
+            };
+
+            RestartIO::save(rstFile, report_step, secs_elapsed, value_,
+                            impl->es, impl->grid, impl->schedule,
+                            action_state_, wtest_state_, st_, udq_state_,
+                            impl->aquiferData, write_double);
+        }
 
-        EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
-        };
+        if (write_rft) {
+            // Open existing RFT file if report step is after first RFT event.
+            const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
+                haveExistingRFT
+            };
+
+            EclIO::OutputStream::RFT rftFile {
+                EclIO::OutputStream::ResultSet { impl->outputDir,
+                                                 impl->baseName },
+                EclIO::OutputStream::Formatted { ioCfg.getFMTOUT() },
+                openExisting
+            };
+
+            RftIO::write(report_step, secs_elapsed, impl->es.getUnits(),
+                         impl->grid, impl->schedule, value_.wells, rftFile);
+        }
+    };
 
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+    if ((write_restart || write_rft) && (this->impl->outputQueue == nullptr)) {
+        write_files(action_state, wtest_state, st, udq_state, value);
+    }
+    else if (write_restart || write_rft) {
+        // The writer thread works on its own copy of the dynamic state.
+        this->impl->outputQueue->push
+            ([write_files, action_state, wtest_state, st,
+              udq_state, value = std::move(value)]() mutable
+        {
+            write_files(action_state, wtest_state, st, udq_state, value);
+        });
     }
 
     if (!isSubstep) {
@@ -385,6 +551,23 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
     }
 }
 
+void Opm::EclipseIO::setAsyncOutput(const std::size_t maxPending)
+{
+    this->flush();
+
+    this->impl->outputQueue.reset();
+    if (maxPending > 0) {
+        this->impl->outputQueue = std::make_unique<OutputQueue>(maxPending);
+    }
+}
+
+void Opm::EclipseIO::flush()
+{
+    if (this->impl->outputQueue != nullptr) {
+        this->impl->outputQueue->wait();
+    }
+}
+
 Opm::RestartValue
 Opm::EclipseIO::loadRestart(Action::State&                 action_state,
                             SummaryState&                  summary_state,
@@ -24,6 +24,7 @@
 
 #include <opm/output/data/Solution.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -150,6 +151,27 @@ public:
                        const bool write_double = false,
                        std::optional<int>   time_step = std::nullopt);
 
+    /// \brief Write restart and RFT files on a background thread.
+    ///
+    /// Once enabled, writeTimeStep() copies the dynamic state objects and
+    /// returns as soon as the output request is queued.  A writer thread
+    /// then aggregates, converts and writes the restart and RFT data in
+    /// the order of the requests.  Summary output is still written by the
+    /// calling thread.  If maxPending requests are already queued or being
+    /// written, writeTimeStep() blocks until the oldest one is complete.
+    ///
+    /// The EclipseState and Schedule objects must not be modified while
+    /// output is pending, so call flush() before, e.g., applying actions to
+    /// the Schedule.  An exception thrown by the writer thread is rethrown
+    /// by the next call to writeTimeStep() or flush().
+    ///
+    /// \param[in] maxPending Maximum number of pending output requests.
+    ///    Zero, the default, restores synchronous output.
+    void setAsyncOutput(std::size_t maxPending);
+
+    /// \brief Wait until all pending restart and RFT output is written.
+    void flush();
+
     /// Will load solution data and wellstate from the restart file.  This
     /// method will consult the IOConfig object to get filename and report
     /// step to restart from.
@@ -81,9 +81,11 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -548,12 +550,12 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
-    const std::optional<std::variant<std::string, int>> extra_data;
+    const std::optional<std::variant<std::string, int>>& extra_data;
     const Opm::SummaryState& st;
     const Opm::data::Wells& wells;
     const Opm::data::WellBlockAveragePressures& wbp;
@@ -561,7 +563,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -652,15 +654,16 @@ template <>
     return measure::rate;
 }
 
+// The efficiency factors are sorted by well name.
 double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name)
 {
-    auto it = std::find_if(eff_factors.begin(), eff_factors.end(),
-        [&name](const std::pair<std::string, double>& elem)
+    auto it = std::lower_bound(eff_factors.begin(), eff_factors.end(), name,
+        [](const std::pair<std::string, double>& elem, const std::string& key)
     {
-        return elem.first == name;
+        return elem.first < key;
     });
 
-    return (it != eff_factors.end()) ? it->second : 1.0;
+    return ((it != eff_factors.end()) && (it->first == name)) ? it->second : 1.0;
 }
 
 inline bool
@@ -3194,6 +3197,9 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 
         this->factors.emplace_back(well->name(), eff_factor);
     }
+
+    // Sorted for efac()
+    std::sort(this->factors.begin(), this->factors.end());
 }
 
 namespace Evaluator {
@@ -3241,6 +3247,19 @@ namespace Evaluator {
             if (this->use_number()) {
                 this->number_ = std::max(0, this->node_.number);
             }
+
+            this->group_name_ = this->group_name();
+            this->need_wells_ = need_wells(this->node_);
+
+            using Cat = Opm::EclIO::SummaryNode::Category;
+            if (this->node_.category == Cat::Well) {
+                this->wellVar_.emplace(this->node_.wgname, this->node_.keyword);
+            }
+            else if ((this->node_.category == Cat::Group) ||
+                     (this->node_.category == Cat::Node))
+            {
+                this->groupVar_.emplace(this->node_.wgname, this->node_.keyword);
+            }
         }
 
         void update(const std::size_t       sim_step,
@@ -3249,36 +3268,78 @@ namespace Evaluator {
                     const SimulatorResults& simRes,
                     Opm::SummaryState&      st) const override
         {
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
+            const auto key = CacheKey {
+                &input.sched, input.sched.generation(), sim_step
+            };
 
-            EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step);
+            if (this->cacheKey_ != key) {
+                this->updateWells(key, input);
+            }
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                this->wells_, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number_, this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                this->effFactors_,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
 
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
+            const auto  value = usys.from_si(prm.unit, prm.value);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            if (this->wellVar_.has_value()) {
+                st.update_well_var(*this->wellVar_, value);
+            }
+            else if (this->groupVar_.has_value()) {
+                st.update_group_var(*this->groupVar_, value);
+            }
+            else {
+                updateValue(this->node_, value, st);
+            }
         }
 
     private:
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
         int                     number_{0};
+        std::string             group_name_{};
+        bool                    need_wells_{false};
+
+        // Storage locations of well and group level results.
+        std::optional<Opm::SummaryState::WellVarHandle>  wellVar_{};
+        std::optional<Opm::SummaryState::GroupVarHandle> groupVar_{};
+
+        // The contributing wells and their efficiency factors only change
+        // between report steps, or when the schedule itself is modified
+        // (ACTIONX, PYACTION, WELPI), so they are not recomputed at every
+        // ministep.  The well pointers refer into the schedule snapshots,
+        // hence the cache is keyed on the schedule's generation too.
+        using CacheKey = std::tuple<const Opm::Schedule*, std::size_t, std::size_t>;
+
+        mutable std::optional<CacheKey>       cacheKey_{};
+        mutable std::vector<const Opm::Well*> wells_{};
+        mutable EfficiencyFactor::FacColl     effFactors_{};
+
+        void updateWells(const CacheKey& key, const InputData& input) const
+        {
+            const auto sim_step = std::get<2>(key);
+
+            this->wells_ = this->need_wells_
+                ? find_wells(input.sched, this->node_,
+                             static_cast<int>(sim_step), input.reg)
+                : std::vector<const Opm::Well*>{};
+
+            EfficiencyFactor eFac{};
+            eFac.setFactors(this->node_, input.sched, this->wells_, sim_step);
+
+            this->effFactors_ = std::move(eFac.factors);
+            this->cacheKey_ = key;
+        }
 
         std::string group_name() const
         {
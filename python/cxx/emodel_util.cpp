@@ -82,7 +82,10 @@ void add_float_filter_2values(EModel * file_ptr, std::string key, std::string op
 
 void python::common::export_EModel(py::module& m) {
 
-    m.def("calc_cell_vol",calculateCellVol);
+    m.def("calc_cell_vol",
+          py::overload_cast<const std::array<double,8>&,
+                            const std::array<double,8>&,
+                            const std::array<double,8>&>(&calculateCellVol));
 
     py::class_<EModel>(m, "EModel")
         .def(py::init<const std::string &>())
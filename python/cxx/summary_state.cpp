@@ -49,8 +49,8 @@ void python::common::export_SummaryState(py::module& module) {
     py::class_<SummaryState, std::shared_ptr<SummaryState>>(module, "SummaryState", SummaryStateClass_docstring)
         .def(py::init<std::time_t>())
         .def("update", &SummaryState::update)
-        .def("update_well_var", &SummaryState::update_well_var, py::arg("well_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_well_var_docstring)
-        .def("update_group_var", &SummaryState::update_group_var, py::arg("group_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_group_var_docstring)
+        .def("update_well_var", py::overload_cast<const std::string&, const std::string&, double>(&SummaryState::update_well_var), py::arg("well_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_well_var_docstring)
+        .def("update_group_var", py::overload_cast<const std::string&, const std::string&, double>(&SummaryState::update_group_var), py::arg("group_name"), py::arg("variable_name"), py::arg("new_value"), SummaryState_update_group_var_docstring)
         .def("well_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_well_var, py::const_), py::arg("well_name"), py::arg("variable_name"), SummaryState_well_var_docstring)
         .def("group_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_group_var, py::const_), py::arg("group_name"), py::arg("variable_name"), SummaryState_group_var_docstring)
         .def("elapsed", &SummaryState::get_elapsed, SummaryState_elapsed_docstring)
@@ -0,0 +1,136 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief This is the unit test for the Tabulated1DFunction class.
+ */
+#include "config.h"
+
+#include <boost/mpl/list.hpp>
+
+#define BOOST_TEST_MODULE 1DTables
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Strongly non-uniform sampling points, clustered near the left end like
+// pressure tables typically are.
+template <class Scalar>
+Opm::Tabulated1DFunction<Scalar> createTable(unsigned n)
+{
+    std::vector<Scalar> x(n), y(n);
+    for (unsigned i = 0; i < n; ++i) {
+        x[i] = std::pow(Scalar(i)/(n - 1), Scalar(3))*1000 + 1;
+        y[i] = std::sin(x[i]/100);
+    }
+
+    return { x, y };
+}
+
+// The segment found by bisecting the full table
+template <class Scalar>
+size_t referenceSegment(const Opm::Tabulated1DFunction<Scalar>& f, Scalar x)
+{
+    const auto& xv = f.xValues();
+    if (x <= xv[1])
+        return 0;
+    if (x >= xv[xv.size() - 2])
+        return xv.size() - 2;
+
+    return std::upper_bound(xv.begin() + 1, xv.end() - 2, x) - xv.begin() - 1;
+}
+
+}
+
+using Types = boost::mpl::list<float,double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SegmentIndex, Scalar, Types)
+{
+    for (unsigned n : { 2, 3, 4, 5, 17, 500 }) {
+        const auto f = createTable<Scalar>(n);
+
+        std::mt19937 gen(n);
+        std::uniform_real_distribution<Scalar> dist(f.xMin() - 10, f.xMax() + 10);
+
+        std::vector<Scalar> xs(f.xValues());
+        for (unsigned k = 0; k < 2000; ++k)
+            xs.push_back(dist(gen));
+
+        for (const auto x : xs)
+            BOOST_CHECK_EQUAL(f.findSegmentIndex(x, /*extrapolate=*/true).value,
+                              referenceSegment(f, x));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UnsortedInput, Scalar, Types)
+{
+    const std::vector<Scalar> x { 3, 1, 4, 0, 2, 5 };
+    const std::vector<Scalar> y { 9, 1, 16, 0, 4, 25 };
+
+    const auto f = Opm::Tabulated1DFunction<Scalar>(x, y);
+    BOOST_CHECK_EQUAL(f.findSegmentIndex(Scalar(2.5)).value, 2U);
+    BOOST_CHECK_CLOSE(f.eval(Scalar(2.5)), Scalar(6.5), 1e-4);
+
+    BOOST_CHECK_THROW(f.eval(Scalar(7)), std::logic_error);
+    BOOST_CHECK_THROW(f.eval(std::numeric_limits<Scalar>::quiet_NaN(), true), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchEval, Scalar, Types)
+{
+    const auto f = createTable<Scalar>(100);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> dist(f.xMin() - 10, f.xMax() + 10);
+
+    std::vector<Scalar> x(1000);
+    std::generate(x.begin(), x.end(), [&]() { return dist(gen); });
+
+    std::vector<Scalar> y(x.size());
+    f.eval(x.size(), x.data(), y.data(), /*extrapolate=*/true);
+    for (size_t k = 0; k < x.size(); ++k)
+        BOOST_CHECK_EQUAL(y[k], f.eval(x[k], /*extrapolate=*/true));
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+    std::vector<Eval> xe(x.size()), ye(x.size());
+    for (size_t k = 0; k < x.size(); ++k)
+        xe[k] = Eval::createVariable(x[k], 0);
+
+    f.eval(xe.size(), xe.data(), ye.data(), /*extrapolate=*/true);
+    for (size_t k = 0; k < x.size(); ++k) {
+        const auto ref = f.eval(xe[k], /*extrapolate=*/true);
+        BOOST_CHECK_EQUAL(ye[k].value(), ref.value());
+        BOOST_CHECK_EQUAL(ye[k].derivative(0), ref.derivative(0));
+    }
+
+    BOOST_CHECK_THROW(f.eval(x.size(), x.data(), y.data()), std::logic_error);
+}
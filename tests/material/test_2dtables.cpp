@@ -406,3 +406,22 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionBatch, Scalar, Types)
+{
+    Test<Scalar> test;
+    auto uniformXTab = test.createUniformXTabulatedFunction2(test.testFn3);
+
+    std::vector<Scalar> x, y;
+    for (unsigned i = 0; i < 100; ++i) {
+        for (unsigned j = 0; j < 100; ++j) {
+            x.push_back(Scalar(-2.0) + Scalar(5.0)*i/99);
+            y.push_back(Scalar(-4.0) + Scalar(9.0)*j/99);
+        }
+    }
+
+    std::vector<Scalar> result(x.size());
+    uniformXTab.eval(x.size(), x.data(), y.data(), result.data(), /*extrapolate=*/true);
+    for (std::size_t k = 0; k < x.size(); ++k)
+        BOOST_CHECK_EQUAL(result[k], uniformXTab.eval(x[k], y[k], /*extrapolate=*/true));
+}
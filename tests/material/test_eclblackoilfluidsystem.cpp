@@ -52,6 +52,7 @@
 
 #include <type_traits>
 #include <cmath>
+#include <thread>
 
 // values of strings based on the SPE1 and NORNE cases of opm-data.
 static constexpr const char* deckString1 =
@@ -726,3 +727,84 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BlackOil, Evaluation, Types)
     [[maybe_unused]] const auto& oPvt = FluidSystem::oilPvt();
     [[maybe_unused]] const auto& wPvt = FluidSystem::waterPvt();
 }
+
+BOOST_AUTO_TEST_CASE(Instances)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<double>;
+    using FluidState = Opm::BlackOilFluidState<double, FluidSystem>;
+
+    static constexpr int oilPhaseIdx = FluidSystem::oilPhaseIdx;
+
+    Opm::Parser parser;
+
+    auto deck = parser.parseString(deckString1);
+    auto python = std::make_shared<Opm::Python>();
+    Opm::EclipseState eclState(deck);
+    Opm::Schedule schedule(deck, eclState, python);
+
+    auto* const defaultInstance = &FluidSystem::instance();
+    const double surfacePressure = FluidSystem::standardPressure();
+    const double surfaceTemperature = FluidSystem::standardTemperature();
+
+    FluidSystem::Instance first;
+    {
+        FluidSystem::ScopedInstance bound(first);
+        BOOST_CHECK(&FluidSystem::instance() == &first);
+        BOOST_CHECK(!FluidSystem::isInitialized());
+        FluidSystem::initFromState(eclState, schedule);
+        BOOST_CHECK(FluidSystem::isInitialized());
+        BOOST_CHECK_EQUAL(FluidSystem::standardPressure(), eclState.getTableManager().stCond().pressure);
+        BOOST_CHECK_EQUAL(FluidSystem::standardTemperature(), eclState.getTableManager().stCond().temperature);
+    }
+    BOOST_CHECK(&FluidSystem::instance() == defaultInstance);
+
+    // initializing other instances leaves the default instance alone
+    BOOST_CHECK_EQUAL(FluidSystem::standardPressure(), surfacePressure);
+    BOOST_CHECK_EQUAL(FluidSystem::standardTemperature(), surfaceTemperature);
+
+    // a copy shares the PVT tables, but the remaining state is its own
+    FluidSystem::Instance second = first;
+    {
+        FluidSystem::ScopedInstance bound(second);
+        FluidSystem::setReferenceDensities(900.0, 1033.0, 0.854, /*regionIdx=*/0);
+    }
+
+    const auto oilDensity = [&](FluidSystem::Instance& inst, const double p)
+    {
+        FluidSystem::ScopedInstance bound(inst);
+
+        FluidState fluidState{};
+        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+            fluidState.setPressure(phaseIdx, p);
+            fluidState.setSaturation(phaseIdx, 1.0/3);
+        }
+        fluidState.setRs(FluidSystem::saturatedDissolutionFactor(fluidState, oilPhaseIdx, 0));
+        fluidState.setRv(0.0);
+
+        return FluidSystem::density(fluidState, oilPhaseIdx, /*regionIdx=*/0);
+    };
+
+    const double p = 200e5;
+    const double rhoFirst = oilDensity(first, p);
+    const double rhoSecond = oilDensity(second, p);
+    BOOST_CHECK_GT(rhoSecond, rhoFirst);
+
+    {
+        FluidSystem::ScopedInstance bound(first);
+        const auto* const oilPvt = &FluidSystem::oilPvt();
+        FluidSystem::ScopedInstance rebound(second);
+        BOOST_CHECK(&FluidSystem::oilPvt() == oilPvt);
+        BOOST_CHECK_CLOSE(FluidSystem::referenceDensity(oilPhaseIdx, 0), 900.0, 1e-10);
+    }
+
+    // both models can be evaluated concurrently
+    double rhoThread[2] = {0.0, 0.0};
+    std::thread firstThread([&] { rhoThread[0] = oilDensity(first, p); });
+    std::thread secondThread([&] { rhoThread[1] = oilDensity(second, p); });
+    firstThread.join();
+    secondThread.join();
+
+    BOOST_CHECK_EQUAL(rhoThread[0], rhoFirst);
+    BOOST_CHECK_EQUAL(rhoThread[1], rhoSecond);
+    BOOST_CHECK(&FluidSystem::instance() == defaultInstance);
+}
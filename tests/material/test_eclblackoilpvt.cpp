@@ -42,6 +42,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/DeadOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/DryGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
 
@@ -59,6 +60,7 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <tuple>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -138,6 +140,64 @@ static constexpr const char* deckString1 =
     "/\n"
     "\n";
 
+// gas with vaporized oil and water
+static constexpr const char* deckString2 =
+    "RUNSPEC\n"
+    "\n"
+    "DIMENS\n"
+    "   1 1 1 /\n"
+    "\n"
+    "TABDIMS\n"
+    " /\n"
+    "\n"
+    "OIL\n"
+    "GAS\n"
+    "WATER\n"
+    "\n"
+    "VAPOIL\n"
+    "VAPWAT\n"
+    "\n"
+    "METRIC\n"
+    "\n"
+    "GRID\n"
+    "\n"
+    "DX\n"
+    "   1*1000 /\n"
+    "DY\n"
+    "   1*1000 /\n"
+    "DZ\n"
+    "   1*20 /\n"
+    "TOPS\n"
+    "   1*1234 /\n"
+    "PORO\n"
+    "   1*0.15 /\n"
+    "\n"
+    "PROPS\n"
+    "\n"
+    "DENSITY\n"
+    "      859.5  1033.0    0.854  /\n"
+    "\n"
+    "PVTG\n"
+    "-- PRESSURE       RV        BG     VISCOSITY\n"
+    "    50.00     0.6e-3      0.025    0.014\n"
+    "              0.0         0.024    0.013 /\n"
+    "   100.00     0.8e-3      0.012    0.016\n"
+    "              0.0         0.0115   0.015 /\n"
+    "   200.00     0.9e-3      0.006    0.020\n"
+    "              0.0         0.0058   0.019 /\n"
+    "/\n"
+    "\n"
+    "PVTGW\n"
+    "-- PRESSURE       RW        BG     VISCOSITY\n"
+    "    50.00     3.0e-6      0.025    0.014\n"
+    "              0.0         0.024    0.013 /\n"
+    "   100.00     5.0e-6      0.012    0.016\n"
+    "              0.0         0.0115   0.015 /\n"
+    "   200.00     8.0e-6      0.006    0.020\n"
+    "              0.0         0.0058   0.019 /\n"
+    "/\n"
+    "\n";
+
 template <class Evaluation, class OilPvt, class GasPvt, class WaterPvt>
 void ensurePvtApi(const OilPvt& oilPvt, const GasPvt& gasPvt, const WaterPvt& waterPvt)
 {
@@ -295,4 +355,92 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
                         refTmp << ". (is " << tmp << ")");
 }
 
+// saturatedFactor(p) is the dissolution factor returned by saturatedProperties(),
+// invertedFactor(p) the one which saturationPressure() inverts
+template <class Pvt, class Scalar, class SaturatedFactor, class InvertedFactor>
+void checkSaturatedProperties(const Pvt& pvt, unsigned regionIdx,
+                              const std::vector<Scalar>& pressures,
+                              Scalar tolerance,
+                              SaturatedFactor saturatedFactor,
+                              InvertedFactor invertedFactor)
+{
+    const Scalar T = 273.15 + 20.0;
+    const std::size_t n = pressures.size();
+    std::vector<Scalar> invB(n), mu(n), R(n);
+    pvt.saturatedProperties(regionIdx, n, pressures.data(), invB.data(), mu.data(), R.data());
+
+    for (std::size_t k = 0; k < n; ++k) {
+        const Scalar p = pressures[k];
+        BOOST_CHECK_CLOSE(invB[k], pvt.saturatedInverseFormationVolumeFactor(regionIdx, T, p), tolerance);
+        BOOST_CHECK_CLOSE(mu[k], pvt.saturatedViscosity(regionIdx, T, p), tolerance);
+        BOOST_CHECK_CLOSE(R[k], saturatedFactor(p), tolerance);
+
+        // the saturation pressure inverts the saturated dissolution factor
+        BOOST_CHECK_CLOSE(pvt.saturationPressure(regionIdx, T, invertedFactor(p)), p, tolerance);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SaturatedProperties, Scalar, Types)
+{
+    // in percent
+    const Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e6;
+
+    // pressures inside and beyond the tabulated range
+    std::vector<Scalar> pressures;
+    for (int i = 0; i < 40; ++i)
+        pressures.push_back(Scalar(2e5 + i*15e5));
+
+    Opm::WetGasPvt<Scalar> wetGasPvt;
+    wetGasPvt.initFromState(eclState, schedule);
+
+    for (unsigned regionIdx = 0; regionIdx < wetGasPvt.numRegions(); ++regionIdx) {
+        const auto RvSat = [&](Scalar p)
+        { return wetGasPvt.saturatedOilVaporizationFactor(regionIdx, Scalar(293.15), p); };
+        checkSaturatedProperties(wetGasPvt, regionIdx, pressures, tolerance, RvSat, RvSat);
+
+        // Rv decreases with pressure in both regions of the deck
+        const Scalar T = 273.15 + 20.0;
+        const Scalar Rv = Scalar(1.0e-3);
+        const Scalar pSat = wetGasPvt.saturationPressure(regionIdx, T, Rv);
+        BOOST_CHECK_CLOSE(wetGasPvt.saturatedOilVaporizationFactor(regionIdx, T, pSat), Rv, tolerance);
+    }
+
+    Opm::LiveOilPvt<Scalar> liveOilPvt;
+    liveOilPvt.setNumRegions(1);
+    liveOilPvt.setReferenceDensities(0, 860.0, 0.85, 1000.0);
+    liveOilPvt.setSaturatedOilGasDissolutionFactor(0, {{1e5, 1.0}, {100e5, 50.0}, {200e5, 100.0}, {300e5, 140.0}});
+    liveOilPvt.setSaturatedOilFormationVolumeFactor(0, {{1e5, 1.05}, {100e5, 1.15}, {200e5, 1.25}, {300e5, 1.32}});
+    liveOilPvt.setSaturatedOilViscosity(0, {{1e5, 2e-3}, {100e5, 1.5e-3}, {200e5, 1.2e-3}, {300e5, 1e-3}});
+    liveOilPvt.initEnd();
+
+    const auto RsSat = [&](Scalar p)
+    { return liveOilPvt.saturatedGasDissolutionFactor(0, Scalar(293.15), p); };
+    checkSaturatedProperties(liveOilPvt, 0, pressures, tolerance, RsSat, RsSat);
+
+    // derivatives of the saturation pressure are those of the inverse function
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+    const auto Rs = Eval::createVariable(75.0, 0);
+    const auto pSat = liveOilPvt.saturationPressure(0, Eval(293.15), Rs);
+    BOOST_CHECK_CLOSE(pSat.value(), Scalar(150e5), tolerance);
+    BOOST_CHECK_CLOSE(pSat.derivative(0), Scalar(100e5/50.0), tolerance);
+
+    // the saturation pressure of humid gas depends on the vaporized water, while the
+    // batch call returns the saturated oil vaporization factor
+    const auto humidDeck = Opm::Parser().parseString(deckString2);
+    Opm::EclipseState humidState(humidDeck);
+    Opm::Schedule humidSchedule(humidDeck, humidState, python);
+
+    Opm::WetHumidGasPvt<Scalar> wetHumidGasPvt;
+    wetHumidGasPvt.initFromState(humidState, humidSchedule);
+
+    const auto humidRvSat = [&](Scalar p)
+    { return wetHumidGasPvt.saturatedOilVaporizationFactor(0, Scalar(293.15), p); };
+    const auto humidRwSat = [&](Scalar p)
+    { return wetHumidGasPvt.saturatedWaterVaporizationFactor(0, Scalar(293.15), p); };
+    checkSaturatedProperties(wetHumidGasPvt, 0, pressures, tolerance, humidRvSat, humidRwSat);
+
+    BOOST_CHECK_CLOSE(wetHumidGasPvt.saturationPressure(0, Scalar(293.15), Scalar(5e-6)),
+                      Scalar(100e5), tolerance);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
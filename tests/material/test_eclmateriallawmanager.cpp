@@ -964,3 +964,141 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CompactStorage, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+    constexpr auto approach = Opm::EclMultiplexerApproach::Default;
+
+    // Two layers of cells with different connate water saturations.
+    std::string deckString = fam1DeckString;
+    deckString.insert(deckString.find("DIMENS"), "ENDSCALE\n/\n\n");
+    deckString.insert(deckString.find("SWOF"), "SWL\n  200*0.12 100*0.15 /\n\n");
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+    const size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager compactManager;
+    compactManager.setEnableCompactStorage(true);
+    compactManager.initFromState(eclState);
+    compactManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    BOOST_CHECK(!compactManager.enableHysteresis());
+
+    const auto& params0 = compactManager.materialLawParams(0).template getRealParams<approach>();
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const auto& params = compactManager.materialLawParams(elemIdx).template getRealParams<approach>();
+        BOOST_CHECK_EQUAL(&params == &params0, elemIdx < 200);
+        BOOST_CHECK(compactManager.materialLawParams(elemIdx).hasSharedRealParams());
+    }
+
+    const auto checkEqual = [&](unsigned elemIdx)
+    {
+        for (int i = 0; i <= 100; i += 5) {
+            typename Fixture<Scalar>::FluidState fs;
+            fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Scalar(i) / 100);
+            fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, Scalar(100 - i) / 200);
+            fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, Scalar(100 - i) / 200);
+
+            std::array<Scalar,numPhases> pc = {0.0, 0.0, 0.0};
+            std::array<Scalar,numPhases> pcCompact = {0.0, 0.0, 0.0};
+            MaterialLaw::capillaryPressures(pc, materialLawManager.materialLawParams(elemIdx), fs);
+            MaterialLaw::capillaryPressures(pcCompact, compactManager.materialLawParams(elemIdx), fs);
+
+            std::array<Scalar,numPhases> kr = {0.0, 0.0, 0.0};
+            std::array<Scalar,numPhases> krCompact = {0.0, 0.0, 0.0};
+            MaterialLaw::relativePermeabilities(kr, materialLawManager.materialLawParams(elemIdx), fs);
+            MaterialLaw::relativePermeabilities(krCompact, compactManager.materialLawParams(elemIdx), fs);
+
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(pc[phaseIdx], pcCompact[phaseIdx]);
+                BOOST_CHECK_EQUAL(kr[phaseIdx], krCompact[phaseIdx]);
+            }
+        }
+    };
+
+    for (unsigned elemIdx = 0; elemIdx < n; elemIdx += 7) {
+        checkEqual(elemIdx);
+    }
+
+    // Modifying a single cell must not affect the cells it shared parameters with.
+    materialLawManager.applyRestartSwatInit(0, 1.0e5);
+    compactManager.applyRestartSwatInit(0, 1.0e5);
+    BOOST_CHECK(&compactManager.materialLawParams(0).template getRealParams<approach>() != &params0);
+    BOOST_CHECK(&compactManager.materialLawParams(1).template getRealParams<approach>() == &params0);
+    checkEqual(0);
+    checkEqual(1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchEvaluation, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    for (const auto* deckString : { fam1DeckString, hysterDeckString, fam2DeckStringGasWater }) {
+        Opm::Parser parser;
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager materialLawManager;
+        materialLawManager.initFromState(eclState);
+        materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        // Every element with different saturations, in reverse order.
+        std::vector<unsigned> elemIdx(n);
+        std::array<std::vector<Scalar>, numPhases> saturations;
+        for (auto& s : saturations)
+            s.resize(n);
+
+        for (unsigned i = 0; i < n; ++i) {
+            elemIdx[i] = n - 1 - i;
+            const Scalar Sw = Scalar(i % 101) / 100;
+            saturations[Fixture<Scalar>::waterPhaseIdx][i] = Sw;
+            saturations[Fixture<Scalar>::oilPhaseIdx][i] = (1 - Sw) / 3;
+            saturations[Fixture<Scalar>::gasPhaseIdx][i] = 2*(1 - Sw) / 3;
+        }
+
+        std::array<std::vector<Scalar>, numPhases> pc;
+        std::array<std::vector<Scalar>, numPhases> kr;
+        std::array<const Scalar*, numPhases> satPtr;
+        std::array<Scalar*, numPhases> pcPtr;
+        std::array<Scalar*, numPhases> krPtr;
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            // the batched calls must not depend on what is in the output arrays
+            pc[phaseIdx].assign(n, 42.0);
+            kr[phaseIdx].assign(n, 42.0);
+            satPtr[phaseIdx] = saturations[phaseIdx].data();
+            pcPtr[phaseIdx] = pc[phaseIdx].data();
+            krPtr[phaseIdx] = kr[phaseIdx].data();
+        }
+
+        materialLawManager.capillaryPressures(n, elemIdx.data(), satPtr, pcPtr);
+        materialLawManager.relativePermeabilities(n, elemIdx.data(), satPtr, krPtr);
+
+        for (unsigned i = 0; i < n; ++i) {
+            typename Fixture<Scalar>::FluidState fs;
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+                fs.setSaturation(phaseIdx, saturations[phaseIdx][i]);
+
+            std::array<Scalar,numPhases> cellPc = {0.0, 0.0, 0.0};
+            std::array<Scalar,numPhases> cellKr = {0.0, 0.0, 0.0};
+            MaterialLaw::capillaryPressures(cellPc, materialLawManager.materialLawParams(elemIdx[i]), fs);
+            MaterialLaw::relativePermeabilities(cellKr, materialLawManager.materialLawParams(elemIdx[i]), fs);
+
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(pc[phaseIdx][i], cellPc[phaseIdx]);
+                BOOST_CHECK_EQUAL(kr[phaseIdx][i], cellKr[phaseIdx]);
+            }
+        }
+    }
+}
@@ -220,3 +220,123 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+namespace {
+
+// Set up a fluid state at the given pressure and temperature with Wilson
+// K-values as the initial guess and everything in the oil phase, and return
+// the global mole fractions with respect to pressure and the first two
+// components.
+ComponentVector initFluidState(FluidState& fluid_state,
+                               Scalar p, Scalar z0, Scalar z1, Scalar temp)
+{
+    const Evaluation p_init = Evaluation::createVariable(p, 0);
+    ComponentVector z;
+    z[0] = Evaluation::createVariable(z0, 1);
+    z[1] = Evaluation::createVariable(z1, 2);
+    z[2] = 1. - z[0] - z[1];
+
+    fluid_state.setPressure(FluidSystem::oilPhaseIdx, p_init);
+    fluid_state.setPressure(FluidSystem::gasPhaseIdx, p_init);
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, z[compIdx]);
+        fluid_state.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, z[compIdx]);
+    }
+    fluid_state.setSaturation(FluidSystem::oilPhaseIdx, 1.0);
+    fluid_state.setSaturation(FluidSystem::gasPhaseIdx, 0.0);
+    fluid_state.setTemperature(temp);
+
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+    }
+    fluid_state.setLvalue(1.);
+
+    return z;
+}
+
+void checkSameFlash(const FluidState& fs, const FluidState& ref, double tol)
+{
+    using Toolbox = Opm::MathToolbox<Evaluation>;
+    for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+        for (const auto phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+            const auto& x = fs.moleFraction(phaseIdx, compIdx);
+            const auto& x_ref = ref.moleFraction(phaseIdx, compIdx);
+            if (tol == 0.0) {
+                BOOST_CHECK_MESSAGE(x == x_ref, "phase " << phaseIdx << " component "
+                                    << compIdx << " mole fraction does not match");
+            }
+            else {
+                BOOST_CHECK_MESSAGE(Toolbox::isSame(x, x_ref, tol), "phase " << phaseIdx
+                                    << " component " << compIdx << " mole fraction does not match");
+            }
+        }
+    }
+
+    if (tol == 0.0) {
+        BOOST_CHECK_MESSAGE(fs.L() == ref.L(), "L does not match");
+    }
+    else {
+        BOOST_CHECK_MESSAGE(Toolbox::isSame(fs.L(), ref.L(), tol), "L does not match");
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PtFlashCompileTimeMethod)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+    using Method = Opm::PTFlashMethod;
+
+    auto check = [](auto method)
+    {
+        FluidState fs, ref;
+        const auto z = initFluidState(fs, 10e5, 0.5, 0.3, 300.0);
+        initFluidState(ref, 10e5, 0.5, 0.3, 300.0);
+
+        Flash::solve<decltype(method)::value>(fs, z, 1.e-12);
+        Flash::solve(ref, z, Flash::flashMethodName(decltype(method)::value), 1.e-12);
+
+        checkSameFlash(fs, ref, 0.0);
+    };
+
+    check(std::integral_constant<Method, Method::Newton>{});
+    check(std::integral_constant<Method, Method::Ssi>{});
+    check(std::integral_constant<Method, Method::SsiNewton>{});
+}
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    // A two-phase cell and a liquid cell consisting mostly of the heavy
+    // component.
+    const std::vector<std::array<Scalar, 2>> compositions {
+        {0.5, 0.3}, {0.01, 0.01}
+    };
+
+    std::vector<FluidState> fluid_states(compositions.size());
+    std::vector<FluidState> ref(compositions.size());
+    std::vector<ComponentVector> z;
+    for (std::size_t cell = 0; cell < compositions.size(); ++cell) {
+        const auto& [z0, z1] = compositions[cell];
+        z.push_back(initFluidState(fluid_states[cell], 10e5, z0, z1, 300.0));
+        initFluidState(ref[cell], 10e5, z0, z1, 300.0);
+        Flash::solve(ref[cell], z[cell], "ssi+newton", 1.e-12);
+    }
+
+    // Without a stability margin the batch does exactly what solve() does.
+    auto batch = fluid_states;
+    Flash::solveBatch<Opm::PTFlashMethod::SsiNewton>(batch, z);
+    for (std::size_t cell = 0; cell < compositions.size(); ++cell) {
+        checkSameFlash(batch[cell], ref[cell], 0.0);
+    }
+
+    // The liquid cell is far from the phase boundary, so skipping its
+    // stability test does not change the result.
+    BOOST_CHECK_EQUAL(Opm::getValue(ref[1].L()), 1.0);
+    batch = fluid_states;
+    Flash::solveBatch<Opm::PTFlashMethod::SsiNewton>(batch, z, 0.1);
+    for (std::size_t cell = 0; cell < compositions.size(); ++cell) {
+        checkSameFlash(batch[cell], ref[cell], 1e-10);
+    }
+}
@@ -1708,3 +1708,197 @@ ENDACTIO
 
     BOOST_CHECK_THROW(make_schedule(deck_string), std::exception);
 }
+
+BOOST_AUTO_TEST_CASE(Action_Replay_Reuses_Snapshots)
+{
+    const auto deck_string = [](const std::string& action_result)
+    {
+        return std::string { R"(
+SCHEDULE
+
+WELSPECS
+  'W1'  'OP'  1 1 3.33  'OIL' 7*/
+  'W2'  'OP'  2 2 3.33  'OIL' 7*/
+/
+
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 1000.0 4* 100.0 /
+ 'W2' 'OPEN' 'ORAT' 1000.0 4* 100.0 /
+/
+
+ACTIONX
+   'ACTION' /
+   WWCT W1  > 0.75 /
+/
+
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 500.0 4* 100.0 /
+/
+
+ENDACTIO
+)" } + action_result + R"(
+TSTEP
+   10 /
+
+WCONPROD
+ 'W2' 'OPEN' 'ORAT' 800.0 4* 100.0 /
+/
+
+TSTEP
+   10 /
+
+WELOPEN
+ 'W2' 'SHUT' /
+/
+
+TSTEP
+   10 /
+
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 200.0 4* 100.0 /
+/
+
+TSTEP
+   10 /
+
+TSTEP
+   10 /
+)";
+    };
+
+    auto sched = make_schedule(deck_string(""));
+    const auto expected = make_schedule(deck_string(R"(
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 500.0 4* 100.0 /
+/
+)"));
+
+    const auto* w2 = &sched[2].wells("W2");
+
+    const auto& action = sched[0].actions.get()["ACTION"];
+    sched.applyAction(0, action, Action::Result{true}.wells(),
+                      std::unordered_map<std::string,double>{});
+
+    BOOST_REQUIRE_EQUAL(sched.size(), expected.size());
+    for (std::size_t report_step = 0; report_step < sched.size(); ++report_step) {
+        for (const auto& well : { "W1", "W2" }) {
+            BOOST_CHECK_MESSAGE(sched[report_step].wells(well) == expected[report_step].wells(well),
+                                "Well " << well << " differs at report step " << report_step);
+        }
+
+        if (report_step > 0) {
+            BOOST_CHECK_MESSAGE(sched[report_step] == expected[report_step],
+                                "Snapshot differs at report step " << report_step);
+        }
+    }
+
+    // Report step 2 only refers to W2, which the action did not change.
+    BOOST_CHECK_EQUAL(&sched[2].wells("W2"), w2);
+
+    BOOST_CHECK_CLOSE(sched[2].wells("W1").getProductionProperties().OilRate.get<double>(), 500.0, 1.0e-8);
+    BOOST_CHECK_CLOSE(sched[4].wells("W1").getProductionProperties().OilRate.get<double>(), 200.0, 1.0e-8);
+}
+
+BOOST_AUTO_TEST_CASE(Action_Replay_Multisegment_Well)
+{
+    const auto deck_string = [](const std::string& action_result)
+    {
+        return std::string { R"(
+GRID
+
+PORO
+  1000*0.1 /
+PERMX
+  1000*100 /
+PERMY
+  1000*100 /
+PERMZ
+  1000*10 /
+
+SCHEDULE
+
+WELSPECS
+  'W1'  'OP'  1 1 1*  'OIL' 7*/
+  'W2'  'OP'  2 2 1*  'OIL' 7*/
+/
+
+COMPDAT
+  'W1'  1 1 1 3 'OPEN' 1* 100.0 0.3 /
+/
+
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 1000.0 4* 100.0 /
+ 'W2' 'OPEN' 'ORAT' 1000.0 4* 100.0 /
+/
+
+ACTIONX
+   'ACTION' /
+   WWCT W2  > 0.75 /
+/
+
+WCONPROD
+ 'W2' 'OPEN' 'ORAT' 500.0 4* 100.0 /
+/
+
+ENDACTIO
+)" } + action_result + R"(
+TSTEP
+   10 /
+
+WCONPROD
+ 'W2' 'OPEN' 'ORAT' 800.0 4* 100.0 /
+/
+
+TSTEP
+   10 /
+
+WELSEGS
+  'W1' 0.5 0.5 1* 'INC' 'HFA' /
+   2 3 1 1 1.0 1.0 0.1 1.0E-5 /
+/
+
+COMPSEGS
+  'W1' /
+  1 1 1 1 0.0 1.0 /
+  1 1 2 1 1.0 2.0 /
+  1 1 3 1 2.0 3.0 /
+/
+
+TSTEP
+   10 /
+
+WELSEGS
+  'W1' 0.5 0.5 1* 'INC' 'HFA' /
+   2 3 1 1 1.0 1.0 0.2 1.0E-5 /
+/
+
+WELPI
+  'W1' 50.0 /
+/
+
+TSTEP
+   10 /
+)";
+    };
+
+    auto sched = make_schedule(deck_string(""));
+    const auto expected = make_schedule(deck_string(R"(
+WCONPROD
+ 'W2' 'OPEN' 'ORAT' 500.0 4* 100.0 /
+/
+)"));
+
+    // The COMPSEGS of report step 2 must be known when the WELSEGS of
+    // report step 3 is checked, even though report step 2 is unaffected.
+    const auto& action = sched[0].actions.get()["ACTION"];
+    BOOST_CHECK_NO_THROW(sched.applyAction(0, action, Action::Result{true}.wells(),
+                                           std::unordered_map<std::string,double>{}));
+
+    BOOST_REQUIRE_EQUAL(sched.size(), expected.size());
+    for (std::size_t report_step = 1; report_step < sched.size(); ++report_step) {
+        BOOST_CHECK_MESSAGE(sched[report_step] == expected[report_step],
+                            "Snapshot differs at report step " << report_step);
+    }
+
+    BOOST_CHECK(sched[3].wells("W1").isMultiSegment());
+}
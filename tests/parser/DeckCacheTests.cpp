@@ -0,0 +1,159 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE DeckCacheTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/json/JsonObject.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <tests/WorkArea.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace Opm;
+
+namespace {
+
+void writeFile(const std::string& fileName, const std::string& content)
+{
+    std::ofstream os(fileName);
+    os << content;
+}
+
+void writeDeck(const std::string& permx)
+{
+    writeFile("CASE.DATA", R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+INCLUDE
+ 'grid.inc' /
+PORO
+ 4*0.25 /
+)");
+
+    writeFile("grid.inc", "PERMX\n " + permx + " /\n");
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad)
+{
+    WorkArea work;
+    writeDeck("4*100");
+
+    const auto deck = Parser{}.parseFile("CASE.DATA");
+    const DeckCache cache("CASE.CACHE", "fingerprint");
+
+    BOOST_CHECK(!cache.load().has_value());
+
+    cache.store(deck, { "CASE.DATA", "grid.inc" });
+    {
+        const auto cached = cache.load();
+        BOOST_REQUIRE(cached.has_value());
+        BOOST_CHECK(*cached == deck);
+        BOOST_CHECK_EQUAL(cached->getDataFile(), deck.getDataFile());
+        BOOST_CHECK_EQUAL(cached->tree().root(), deck.tree().root());
+
+        const auto& location = (*cached)["PERMX"].back().location();
+        BOOST_CHECK_EQUAL(location.filename, deck["PERMX"].back().location().filename);
+        BOOST_CHECK_EQUAL(location.lineno, 1U);
+    }
+
+    BOOST_CHECK(!DeckCache("CASE.CACHE", "other").load().has_value());
+
+    // Same size, different content
+    writeFile("grid.inc", "PERMX\n 4*200 /\n");
+    BOOST_CHECK(!cache.load().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(DamagedCache)
+{
+    WorkArea work;
+    writeDeck("4*100");
+
+    const auto deck = Parser{}.parseFile("CASE.DATA");
+    const DeckCache cache("CASE.CACHE", "fingerprint");
+    cache.store(deck, { "CASE.DATA", "grid.inc" });
+
+    const auto size = std::filesystem::file_size("CASE.CACHE");
+    {
+        std::fstream fs("CASE.CACHE", std::ios::binary | std::ios::in | std::ios::out);
+        fs.seekp(size - 10);
+        fs.put('\x7f');
+    }
+    BOOST_CHECK(!cache.load().has_value());
+
+    std::filesystem::resize_file("CASE.CACHE", size / 2);
+    BOOST_CHECK(!cache.load().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(ParseFileCached)
+{
+    WorkArea work;
+    writeDeck("4*100");
+
+    const auto parser = Parser{};
+    const auto deck = parser.parseFileCached("CASE.DATA", "CASE.CACHE");
+    BOOST_CHECK(std::filesystem::exists("CASE.CACHE"));
+
+    const auto cached = parser.parseFileCached("CASE.DATA", "CASE.CACHE");
+    BOOST_CHECK(cached == deck);
+    BOOST_CHECK(cached == parser.parseFile("CASE.DATA"));
+
+    writeDeck("4*300");
+    const auto updated = parser.parseFileCached("CASE.DATA", "CASE.CACHE");
+    BOOST_CHECK_CLOSE(updated["PERMX"].back().getRawDoubleData()[0], 300.0, 1.0e-8);
+    BOOST_CHECK(updated == parser.parseFile("CASE.DATA"));
+
+    // Only decks fully determined by the input files are cached
+    std::filesystem::remove("CASE.CACHE");
+    writeFile("CASE.DATA", "RUNSPEC\nINCLUDE\n 'missing.inc' /\n");
+
+    auto parseContext = ParseContext{};
+    parseContext.update(ParseContext::PARSE_MISSING_INCLUDE, InputErrorAction::IGNORE);
+    ErrorGuard errors;
+    parser.parseFileCached("CASE.DATA", "CASE.CACHE", parseContext, errors);
+    BOOST_CHECK(!std::filesystem::exists("CASE.CACHE"));
+}
+
+BOOST_AUTO_TEST_CASE(KeywordsFingerprint)
+{
+    BOOST_CHECK_EQUAL(Parser{}.keywordsFingerprint(), Parser{}.keywordsFingerprint());
+    BOOST_CHECK(Parser{}.keywordsFingerprint() != Parser{false}.keywordsFingerprint());
+
+    // Same number of keywords, but different definitions
+    auto intParser = Parser{};
+    auto doubleParser = Parser{};
+    intParser.loadKeywords(Json::JsonObject(R"([{"name" : "PERMX", "sections" : ["GRID"], "data" : {"value_type" : "INT"}}])"));
+    doubleParser.loadKeywords(Json::JsonObject(R"([{"name" : "PERMX", "sections" : ["GRID"], "data" : {"value_type" : "DOUBLE"}}])"));
+
+    BOOST_CHECK_EQUAL(intParser.size(), doubleParser.size());
+    BOOST_CHECK(intParser.keywordsFingerprint() != doubleParser.keywordsFingerprint());
+    BOOST_CHECK(intParser.keywordsFingerprint() != Parser{}.keywordsFingerprint());
+}
@@ -30,6 +30,7 @@
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckView.hpp>
+#include <opm/input/eclipse/Deck/DeckSection.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
@@ -325,6 +326,42 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ValueStatusRuns) {
+    Dimension dim{ 2 };
+    Dimension defaultDim{ 100 };
+    DeckItem item( "HEI", double(), {dim}, {defaultDim} );
+
+    item.push_back( 1.0, 3 );
+    item.push_back( 1.0 );
+    item.push_backDefault( 1.0, 2 );
+    item.push_back( 1.0 );
+
+    BOOST_CHECK_EQUAL( 7U, item.data_size() );
+    BOOST_CHECK( item.getValueStatus(3) == value::status::deck_value );
+    BOOST_CHECK( item.getValueStatus(4) == value::status::valid_default );
+    BOOST_CHECK( item.getValueStatus(5) == value::status::valid_default );
+    BOOST_CHECK( item.getValueStatus(6) == value::status::deck_value );
+    BOOST_CHECK_THROW( item.getValueStatus(7), std::out_of_range );
+
+    const auto& status = item.getValueStatus();
+    BOOST_REQUIRE_EQUAL( 7U, status.size() );
+    for (std::size_t i = 0; i < status.size(); ++i)
+        BOOST_CHECK( status[i] == item.getValueStatus(i) );
+
+    const auto& si = item.getSIDoubleData();
+    const auto expect = std::vector<double> { 2, 2, 2, 2, 100, 100, 2 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( si.begin(), si.end(), expect.begin(), expect.end() );
+
+    item.push_backDummyDefault<double>( 2 );
+    BOOST_CHECK_EQUAL( 9U, item.getValueStatus().size() );
+    BOOST_CHECK( !item.hasValue(8) );
+
+    item.releaseData();
+    BOOST_CHECK_EQUAL( 0U, item.data_size() );
+    BOOST_CHECK( item.getData<double>().empty() );
+    BOOST_CHECK( item.getValueStatus().empty() );
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
@@ -630,6 +667,20 @@ BOOST_AUTO_TEST_CASE(RecordWrite) {
 }
 
 
+BOOST_AUTO_TEST_CASE(ReleaseArrayData) {
+    auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+PORO
+ 4*0.25 /
+)");
+
+    deck.releaseArrayData();
+    BOOST_CHECK_EQUAL( 0U, deck["PORO"].back().getDataSize() );
+    BOOST_CHECK_EQUAL( 2, deck["DIMENS"].back().getRecord(0).getItem(0).get<int>(0) );
+}
+
 BOOST_AUTO_TEST_CASE(DeckItemEqual) {
     auto dims = make_dims();
     DeckItem item1("TEST1" , int());
@@ -846,3 +897,66 @@ DATES
     auto count = std::count_if(dw.begin(), dw.end(), is_vfpprod);
     BOOST_CHECK_EQUAL(count, 2);
 }
+
+BOOST_AUTO_TEST_CASE(DeckIndexAndSectionView) {
+    Deck deck;
+    for (const auto* name : {"RUNSPEC", "DIMENS", "GRID", "PORO", "PERMX", "PORO",
+                             "PROPS", "SWOF", "SCHEDULE", "DATES", "DATES"})
+        deck.addKeyword(DeckKeyword(KeywordLocation{}, name));
+
+    BOOST_CHECK_EQUAL(deck.count("PORO"), 2U);
+    BOOST_CHECK(deck.index("PORO") == std::vector<std::size_t>({3, 5}));
+
+    // The index is maintained as keywords are added
+    deck.addKeyword(DeckKeyword(KeywordLocation{}, "PORO"));
+    BOOST_CHECK(deck.index("PORO") == std::vector<std::size_t>({3, 5, 11}));
+    BOOST_CHECK_EQUAL(deck["PORO"].size(), 3U);
+
+    const GRIDSection grid(deck);
+    BOOST_CHECK_EQUAL(grid.size(), 4U);
+    BOOST_CHECK_EQUAL(grid.front().name(), "GRID");
+    BOOST_CHECK_EQUAL(grid.back().name(), "PORO");
+    BOOST_CHECK_EQUAL(grid.count("PORO"), 2U);
+    BOOST_CHECK(grid.index("PORO") == std::vector<std::size_t>({1, 3}));
+    BOOST_CHECK_EQUAL(grid["PORO"].size(), 2U);
+    BOOST_CHECK(!grid.has_keyword("SWOF"));
+    BOOST_CHECK_THROW(grid[4], std::out_of_range);
+
+    std::vector<std::string> names;
+    for (const auto& kw : grid)
+        names.push_back(kw.name());
+    BOOST_CHECK(names == std::vector<std::string>({"GRID", "PORO", "PERMX", "PORO"}));
+
+    // Adding to a section view detaches it from the deck
+    DeckSection props = PROPSSection(deck);
+    props.add_keyword(deck["PORO"].back());
+    BOOST_CHECK_EQUAL(props.size(), 3U);
+    BOOST_CHECK_EQUAL(props.count("PORO"), 1U);
+
+    const SCHEDULESection schedule(deck);
+    BOOST_CHECK_EQUAL(schedule.size(), 4U);
+    BOOST_CHECK_EQUAL(schedule.count("DATES"), 2U);
+
+    BOOST_CHECK(EDITSection(deck).empty());
+
+    deck.remove_keywords(3, 6);
+    BOOST_CHECK(!deck.hasKeyword("PERMX"));
+    BOOST_CHECK(deck.index("PORO") == std::vector<std::size_t>({8}));
+    BOOST_CHECK_EQUAL(GRIDSection(deck).size(), 1U);
+}
+
+BOOST_AUTO_TEST_CASE(SectionViewSurvivesDeckMove) {
+    Deck deck;
+    for (const auto* name : {"RUNSPEC", "DIMENS", "GRID", "PORO", "PERMX", "PORO", "PROPS", "SWOF"})
+        deck.addKeyword(DeckKeyword(KeywordLocation{}, name));
+
+    const GRIDSection grid(deck);
+    const auto deck_view = deck["PORO"];
+
+    const Deck moved(std::move(deck));
+    BOOST_CHECK_EQUAL(grid.size(), 4U);
+    BOOST_CHECK_EQUAL(grid.count("PORO"), 2U);
+    BOOST_CHECK_EQUAL(&grid.back(), &moved[5]);
+    BOOST_CHECK_EQUAL(&deck_view.back(), &moved[5]);
+    BOOST_CHECK(GRIDSection(moved).index("PORO") == std::vector<std::size_t>({1, 3}));
+}
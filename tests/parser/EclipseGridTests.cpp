@@ -2871,6 +2871,62 @@ BOOST_AUTO_TEST_CASE(TEST_getCellCenters) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(BulkCellGeometry) {
+    auto check = [](const Opm::EclipseGrid& grid)
+    {
+        const auto nx = grid.getNX();
+        const auto ny = grid.getNY();
+        const auto nz = grid.getNZ();
+
+        const auto all = grid.getLayerGeometry(0, nz);
+        BOOST_REQUIRE_EQUAL(all.volume.size(), grid.getCartesianSize());
+
+        for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+            BOOST_CHECK_CLOSE(all.volume[g], grid.getCellVolume(g), 1e-10);
+            BOOST_CHECK_EQUAL(all.depth[g], grid.getCellDepth(g));
+            BOOST_CHECK_EQUAL(all.thickness[g], grid.getCellThickness(g));
+
+            const auto center = grid.getCellCenter(g);
+            for (std::size_t d = 0; d < 3; ++d) {
+                BOOST_CHECK_EQUAL(all.center[g][d], center[d]);
+            }
+        }
+
+        const auto last = grid.getLayerGeometry(nz - 1, nz);
+        BOOST_REQUIRE_EQUAL(last.depth.size(), nx*ny);
+        for (std::size_t n = 0; n < nx*ny; ++n) {
+            BOOST_CHECK_EQUAL(last.depth[n], all.depth[n + (nz - 1)*nx*ny]);
+        }
+
+        for (std::size_t j = 0; j < ny; ++j) {
+            for (std::size_t i = 0; i < nx; ++i) {
+                const auto column = grid.getColumnGeometry(i, j);
+                BOOST_REQUIRE_EQUAL(column.volume.size(), nz);
+
+                for (std::size_t k = 0; k < nz; ++k) {
+                    const auto g = grid.getGlobalIndex(i, j, k);
+                    BOOST_CHECK_EQUAL(column.volume[k], all.volume[g]);
+                    BOOST_CHECK_EQUAL(column.depth[k], all.depth[g]);
+                    BOOST_CHECK_EQUAL(column.thickness[k], all.thickness[g]);
+                }
+            }
+        }
+
+        for (std::size_t a = 0; a < grid.getNumActive(); ++a) {
+            BOOST_CHECK_CLOSE(grid.activeVolume()[a],
+                              all.volume[grid.getGlobalIndex(a)], 1e-10);
+        }
+
+        BOOST_CHECK(grid.getLayerGeometry(1, 1).volume.empty());
+        BOOST_CHECK_THROW(grid.getLayerGeometry(0, nz + 1), std::invalid_argument);
+        BOOST_CHECK_THROW(grid.getColumnGeometry(nx, 0), std::invalid_argument);
+    };
+
+    check(Opm::EclipseGrid { BAD_CP_GRID() });
+    check(Opm::EclipseGrid { BAD_CP_GRID_ACTNUM() });
+    check(Opm::EclipseGrid { radial_details() });
+}
+
 BOOST_AUTO_TEST_CASE(LoadFromBinary) {
     BOOST_CHECK_THROW(Opm::EclipseGrid( "No/does/not/exist" ) , std::runtime_error);
 }
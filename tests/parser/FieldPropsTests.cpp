@@ -3169,3 +3169,162 @@ MULTZ
         BOOST_CHECK_EQUAL(multz2[ij + 100], 40.0);
     }
 }
+
+BOOST_AUTO_TEST_CASE(LAZY_EVALUATION) {
+    const std::string deck_string { R"(
+GRID
+
+PORO
+   200*0.15 /
+
+PERMX
+   200*1 /
+
+PROPS
+
+SWATINIT
+  200*0.25 /
+
+BOX
+  1 10 1 10 1 1 /
+
+MULTIPLY
+  SWATINIT 2 /
+/
+
+ENDBOX
+
+REGIONS
+
+MULTNUM
+  50*1 50*2 100*3 /
+
+SOLUTION
+
+PRESSURE
+  200*100 /
+
+COPY
+  SWATINIT SWAT /
+/
+
+EQUALS
+  SGAS 0 /
+/
+
+MULTIREG
+  PRESSURE 2 2 M /
+/
+
+OPERATE
+  SGAS 1 10 1 10 2 2 'MULTA' SWAT 0.5 0.1 /
+/
+
+BOX
+  1 10 1 10 2 2 /
+
+SWAT
+  100*0.2 /
+
+ENDBOX
+
+RS
+  200*50 /
+)" };
+
+    const auto deck = Parser{}.parseString(deck_string);
+
+    auto grid = EclipseGrid { 10, 10, 2 };
+    const auto eager = FieldPropsManager {
+        deck, Phases{true, true, true}, grid, TableManager{}
+    };
+
+    auto lazy_grid = EclipseGrid { 10, 10, 2 };
+    const auto lazy = FieldPropsManager {
+        deck, Phases{true, true, true}, lazy_grid, TableManager{}, 0, true
+    };
+
+    // SGAS is evaluated from SWAT before SWAT is overwritten in the
+    // second layer.
+    const auto& sgas = lazy.get_double("SGAS");
+    for (std::size_t g = 0; g < 100; ++g) {
+        BOOST_CHECK_EQUAL(sgas[g], 0.0);
+        BOOST_CHECK_CLOSE(sgas[g + 100], 0.5*0.25 + 0.1, 1.0e-8);
+    }
+
+    BOOST_CHECK(lazy.has_double("RS"));
+    BOOST_CHECK(!lazy.has_double("SOIL"));
+
+    for (const auto* kw : { "SWATINIT", "SWAT", "SGAS", "PRESSURE", "RS" }) {
+        BOOST_CHECK_MESSAGE(lazy.get_double(kw) == eager.get_double(kw),
+                            "Lazy and eager evaluation of " << kw << " must agree");
+    }
+
+    const auto& swat = lazy.get_double("SWAT");
+    BOOST_CHECK_CLOSE(swat[0], 0.5, 1.0e-8);
+    BOOST_CHECK_CLOSE(swat[100], 0.2, 1.0e-8);
+
+    auto lazy_keys = lazy.keys<double>();
+    auto eager_keys = eager.keys<double>();
+    std::sort(lazy_keys.begin(), lazy_keys.end());
+    std::sort(eager_keys.begin(), eager_keys.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(lazy_keys.begin(), lazy_keys.end(),
+                                  eager_keys.begin(), eager_keys.end());
+
+    BOOST_CHECK(lazy == eager);
+}
+
+BOOST_AUTO_TEST_CASE(LAZY_EVALUATION_RELEASE_ARRAY_DATA) {
+    const std::string deck_string { R"(
+GRID
+
+PORO
+   200*0.15 /
+
+PROPS
+
+SWATINIT
+  200*0.25 /
+
+BOX
+  1 10 1 10 1 1 /
+
+MULTIPLY
+  SWATINIT 2 /
+/
+
+ENDBOX
+
+SOLUTION
+
+PRESSURE
+  200*100 /
+)" };
+
+    auto deck = Parser{}.parseString(deck_string);
+
+    auto grid = EclipseGrid { 10, 10, 2 };
+    const auto eager = FieldPropsManager {
+        deck, Phases{true, true, true}, grid, TableManager{}
+    };
+
+    auto lazy_grid = EclipseGrid { 10, 10, 2 };
+    const auto lazy = FieldPropsManager {
+        deck, Phases{true, true, true}, lazy_grid, TableManager{}, 0, true
+    };
+
+    // Evaluating the pending arrays first makes the deck's array data
+    // superfluous.
+    lazy.apply_deferred_operations();
+    deck.releaseArrayData();
+    BOOST_CHECK_EQUAL(deck["SWATINIT"].back().getDataSize(), 0U);
+
+    for (const auto* kw : { "SWATINIT", "PRESSURE" }) {
+        BOOST_CHECK_MESSAGE(lazy.get_double(kw) == eager.get_double(kw),
+                            "Lazy and eager evaluation of " << kw << " must agree");
+    }
+
+    const auto& swatinit = lazy.get_double("SWATINIT");
+    BOOST_CHECK_CLOSE(swatinit[0], 0.5, 1.0e-8);
+    BOOST_CHECK_CLOSE(swatinit[100], 0.25, 1.0e-8);
+}
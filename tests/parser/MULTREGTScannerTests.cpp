@@ -42,6 +42,7 @@
 #include <array>
 #include <initializer_list>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 BOOST_AUTO_TEST_SUITE(Basic)
@@ -961,4 +962,50 @@ BOOST_AUTO_TEST_CASE(Same_Conn_From_Multiple_Regsets)
     BOOST_CHECK_CLOSE(rmult.nnc({ 0, 1, 0 }, { 0, 0, 1 }), 0.05, 1.0e-8);
 }
 
+BOOST_AUTO_TEST_CASE(Bulk_Matches_Single_Connection)
+{
+    const auto deck = setup(Regions::f_plus_one(), R"(
+MULTREGT
+  1 2  0.5  XY  'ALL'   'F' /
+  2 3  0.1  1*  'NNC'   'M' /
+  3 3  0.3  Z   'NONNC' 'M' /
+  2 2  0.7  1*  'ALL'   'F' /
+/
+)");
+
+    auto grid = Opm::EclipseGrid { deck };
+    const auto fp = Opm::FieldPropsManager { deck, Opm::Phases { true, true, true }, grid, Opm::TableManager { deck } };
+    auto scanner = Opm::MULTREGTScanner { grid, &fp, deck.getKeywordList<Opm::ParserKeywords::MULTREGT>() };
+    scanner.applyNumericalAquifer({ grid.getGlobalIndex(0, 5, 1) });
+
+    const auto directions = std::array {
+        Opm::FaceDir::XPlus, Opm::FaceDir::YPlus, Opm::FaceDir::ZPlus,
+        Opm::FaceDir::XMinus, Opm::FaceDir::YMinus, Opm::FaceDir::ZMinus,
+    };
+
+    auto connections = std::vector<std::pair<std::size_t, std::size_t>>{};
+    auto faceDirs = std::vector<Opm::FaceDir::DirEnum>{};
+    for (std::size_t c1 = 0; c1 < grid.getCartesianSize(); ++c1) {
+        for (std::size_t c2 = 0; c2 < grid.getCartesianSize(); ++c2) {
+            for (const auto dir : directions) {
+                connections.emplace_back(c1, c2);
+                faceDirs.push_back(dir);
+            }
+        }
+    }
+
+    const auto mult = scanner.getRegionMultipliers(connections, faceDirs);
+    const auto multNNC = scanner.getRegionMultipliersNNC(connections);
+    BOOST_REQUIRE_EQUAL(mult.size(), connections.size());
+    BOOST_REQUIRE_EQUAL(multNNC.size(), connections.size());
+
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        const auto& [c1, c2] = connections[i];
+        BOOST_CHECK_EQUAL(mult[i], scanner.getRegionMultiplier(c1, c2, faceDirs[i]));
+        BOOST_CHECK_EQUAL(multNNC[i], scanner.getRegionMultiplierNNC(c1, c2));
+    }
+
+    BOOST_CHECK_THROW(scanner.getRegionMultipliers(connections, {}), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // MultiRegSet
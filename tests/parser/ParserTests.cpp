@@ -34,6 +34,7 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywords.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
@@ -323,6 +324,44 @@ BOOST_AUTO_TEST_CASE(WildCardTest) {
     BOOST_CHECK_EQUAL( keyword1 , keyword3 );
 }
 
+BOOST_AUTO_TEST_CASE(BuiltinKeywordTable) {
+    const auto& builtin = ParserKeywords::builtinKeywords();
+    BOOST_REQUIRE_GT(builtin.num_deck_names, 0U);
+
+    const Parser parser;
+    BOOST_CHECK_EQUAL(parser.size(), builtin.num_deck_names);
+
+    for (std::size_t i = 0; i < builtin.num_deck_names; ++i) {
+        const auto& deck_name = builtin.deck_names[i];
+        const auto keyword = builtin.find(deck_name.name);
+        BOOST_REQUIRE(keyword.has_value());
+        BOOST_CHECK_EQUAL(*keyword, deck_name.keyword);
+
+        const auto& parserKeyword = parser.getParserKeywordFromDeckName(deck_name.name);
+        BOOST_CHECK_EQUAL(parserKeyword.getName(), builtin.keywords[deck_name.keyword].name);
+        BOOST_CHECK(parserKeyword.matches(deck_name.name));
+    }
+
+    BOOST_CHECK(!builtin.find("NOSUCHKW").has_value());
+    BOOST_CHECK(!builtin.find("").has_value());
+
+    // Builtin keywords are shared between parsers
+    const Parser other;
+    BOOST_CHECK_EQUAL(&other.getKeyword("DIMENS"), &parser.getKeyword("DIMENS"));
+
+    // Keywords added to a parser take precedence, in that parser only
+    Parser replaced;
+    BOOST_CHECK( replaced.loadKeywordFromFile( prefix() + "parser/EQLDIMS2" ) );
+    BOOST_CHECK( replaced.getKeyword("EQLDIMS").getRecord(0).hasItem("NEW") );
+    BOOST_CHECK( !parser.getKeyword("EQLDIMS").getRecord(0).hasItem("NEW") );
+    BOOST_CHECK_EQUAL( replaced.size(), parser.size() );
+
+    const Parser empty(false);
+    BOOST_CHECK(!empty.isRecognizedKeyword("DIMENS"));
+    BOOST_CHECK(!empty.isRecognizedKeyword("TVDPXXX"));
+    BOOST_CHECK_EQUAL(empty.size(), 0U);
+}
+
 
 BOOST_AUTO_TEST_CASE( quoted_comments ) {
     BOOST_CHECK_EQUAL( Parser::stripComments( "ABC" ) , "ABC");
@@ -683,6 +722,26 @@ BOOST_AUTO_TEST_CASE(Scan_All_CorrectIntSetInDeckItem) {
     BOOST_CHECK_EQUAL(77,  deckIntItem.get< int >(3));
     BOOST_CHECK_EQUAL(1,   deckIntItem.get< int >(21));
     BOOST_CHECK_EQUAL(25,  deckIntItem.get< int >(22));
+
+    // The numeric items are scanned straight from the record string, which
+    // is then consumed without ever being split into items.
+    BOOST_CHECK(rawRecord.empty());
+    BOOST_CHECK_EQUAL(rawRecord.size(), 0U);
+    BOOST_CHECK_EQUAL(rawRecord.max_size(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(Scan_All_Split_Record) {
+    auto sizeType = ParserItem::item_size::ALL;
+    ParserItem itemInt("ITEM", INT); itemInt.setSizeType(sizeType);
+
+    RawRecord rawRecord( "100 443 10*77 10*1 25", KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK_EQUAL(rawRecord.front(), "100");
+
+    UnitSystem unit_system;
+    const auto deckIntItem = itemInt.scan(rawRecord, unit_system, unit_system);
+    BOOST_CHECK_EQUAL(23U, deckIntItem.data_size());
+    BOOST_CHECK(rawRecord.empty());
+    BOOST_CHECK_EQUAL(rawRecord.max_size(), 5U);
 }
 
 BOOST_AUTO_TEST_CASE(Scan_All_WithDefaults) {
@@ -2989,3 +3048,143 @@ END
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Parse_ROCK
+
+BOOST_AUTO_TEST_CASE(ParseDeferredDataKeywords)
+{
+    // Data keywords are converted to deck data in batches, possibly
+    // concurrently.  The deck must still come out in input order and with
+    // the units in effect at the keyword's position.
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+FIELD
+DIMENS
+ 2 2 1 /
+GRID
+DX
+ 4*100 /
+DY
+ 2*100 2*200 /
+PORO
+ 0.25 3*0.30 /
+EQUALS
+ DZ 10 /
+/
+PERMX
+ 1* 100 2*200 /
+ACTNUM
+ 1 0 2*1 /
+END
+)");
+
+    const auto names = std::vector<std::string> {
+        "RUNSPEC", "FIELD", "DIMENS", "GRID", "DX", "DY",
+        "PORO", "EQUALS", "PERMX", "ACTNUM",
+    };
+
+    BOOST_REQUIRE_EQUAL(deck.size(), names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+        BOOST_CHECK_EQUAL(deck[i].name(), names[i]);
+
+    const auto& dy = deck["DY"].back().getSIDoubleData();
+    BOOST_CHECK_CLOSE(dy[3], 200 * 0.3048, 1.0e-8);
+
+    const auto& poro = deck["PORO"].back().getRawDoubleData();
+    BOOST_CHECK_EQUAL(poro.size(), 4U);
+    BOOST_CHECK_CLOSE(poro[3], 0.30, 1.0e-8);
+
+    const auto& permx = deck["PERMX"].back().getRecord(0).getItem(0);
+    BOOST_CHECK(permx.defaultApplied(0));
+    BOOST_CHECK_CLOSE(permx.get<double>(2), 200.0, 1.0e-8);
+
+    BOOST_CHECK(deck["ACTNUM"].back().getIntData() == std::vector<int>({1, 0, 1, 1}));
+
+    BOOST_CHECK(deck.getActiveUnitSystem().getType() == UnitSystem::UnitType::UNIT_TYPE_FIELD);
+    BOOST_CHECK(deck.getActiveUnitSystem().hasDimension("Length"));
+}
+
+BOOST_AUTO_TEST_CASE(ParseDeferredDataKeywordError)
+{
+    const auto deck_string = std::string { R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+PORO
+ 4*0.25 /
+PERMX
+ 100 100 abc 100 /
+END
+)" };
+
+    try {
+        const auto deck = Parser{}.parseString(deck_string);
+        BOOST_FAIL("Invalid PERMX data must be rejected");
+    }
+    catch (const OpmInputError& e) {
+        BOOST_CHECK_MESSAGE(std::string { e.what() }.find("PERMX") != std::string::npos,
+                            "Error message must name the offending keyword");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParseBulkNumericData)
+{
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 2 2 2 /
+GRID
+PORO
+ 0.25 +1.5E-1 -2.5d+2 3*0.125 1.00000000000000000001
+ 6.02214076D23 ,	2.5e-20 /
+ACTNUM
+ +1 0 2*1
+ -0 3* /
+END
+)");
+
+    const auto& poro = deck["PORO"].back().getRawDoubleData();
+    const auto expect = std::vector<double> {
+        0.25, 0.15, -250.0, 0.125, 0.125, 0.125,
+        std::strtod("1.00000000000000000001", nullptr),
+        6.02214076e23, 2.5e-20,
+    };
+
+    BOOST_REQUIRE_EQUAL(poro.size(), expect.size());
+    for (std::size_t i = 0; i < expect.size(); ++i)
+        BOOST_CHECK_EQUAL(poro[i], expect[i]);
+
+    const auto& actnum = deck["ACTNUM"].back().getRecord(0).getItem(0);
+    BOOST_REQUIRE_EQUAL(actnum.data_size(), 8U);
+    BOOST_CHECK(actnum.defaultApplied(5));
+    BOOST_CHECK(actnum.defaultApplied(7));
+    BOOST_CHECK_EQUAL(actnum.get<int>(0), 1);
+    BOOST_CHECK_EQUAL(actnum.get<int>(3), 1);
+    BOOST_CHECK_EQUAL(actnum.get<int>(4), 0);
+
+    BOOST_CHECK_THROW(Parser{}.parseString("PORO\n 0*0.25 /\n"), OpmInputError);
+    BOOST_CHECK_THROW(Parser{}.parseString("PORO\n 2*0.25X /\n"), OpmInputError);
+}
+
+BOOST_AUTO_TEST_CASE(ParseDeferredDataKeywordsThreads)
+{
+    const auto deck_string = std::string { R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+DX
+ 4*100 /
+PORO
+ 0.25 3*0.30 /
+PERMX
+ 1* 100 2*200 /
+END
+)" };
+
+    auto parser = Parser{};
+    BOOST_CHECK_GE(parser.numThreads(), 1);
+    BOOST_CHECK_THROW(parser.setNumThreads(0), std::invalid_argument);
+
+    parser.setNumThreads(1);
+    const auto serial = parser.parseString(deck_string);
+
+    parser.setNumThreads(4);
+    BOOST_CHECK_EQUAL(parser.numThreads(), 4);
+    BOOST_CHECK(parser.parseString(deck_string) == serial);
+}
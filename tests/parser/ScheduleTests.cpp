@@ -4828,7 +4828,9 @@ END
 
         BOOST_CHECK_CLOSE(scalingFactor, 2.0, 1.0e-10);
 
+        const auto generation = sched.generation();
         applyWellPIScaling(1729, scalingFactor);
+        BOOST_CHECK_EQUAL(sched.generation(), generation);
 
         {
             const auto expectCF = 100.0*cp_rm3_per_db();
@@ -4891,9 +4893,13 @@ END
     {
         const auto report_step   = std::size_t{1};
         const auto newWellPI     = 100.0*liquid_PI_unit();
+        const auto generation    = sched.generation();
 
         applyWellPIScaling(report_step, newWellPI);
 
+        // Wells in the snapshots have been replaced.
+        BOOST_CHECK(sched.generation() != generation);
+
         {
             const auto expectCF = 100.0*cp_rm3_per_db();
 
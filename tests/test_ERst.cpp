@@ -316,6 +316,31 @@ BOOST_AUTO_TEST_CASE(TestERst_4) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestERst_ParallelLoad) {
+
+    std::string testFile1="./SPE1_TESTCASE.UNRST";
+    std::string testFile2="./SPE1_TESTCASE.FUNRST";
+
+    for (const auto& testFile : { testFile1, testFile2 }) {
+        ERst rst1(testFile);
+        rst1.loadReportStepNumber(25);
+
+        ERst rst2(testFile);
+        BOOST_CHECK_THROW(rst2.setNumThreads(0), std::invalid_argument);
+        rst2.setNumThreads(4);
+        BOOST_CHECK_EQUAL(rst2.numThreads(), 4);
+        rst2.loadReportStepNumber(25);
+
+        BOOST_CHECK(rst1.getRestartData<int>("INTEHEAD", 25, 0) == rst2.getRestartData<int>("INTEHEAD", 25, 0));
+        BOOST_CHECK(rst1.getRestartData<bool>("LOGIHEAD", 25, 0) == rst2.getRestartData<bool>("LOGIHEAD", 25, 0));
+        BOOST_CHECK(rst1.getRestartData<double>("DOUBHEAD", 25, 0) == rst2.getRestartData<double>("DOUBHEAD", 25, 0));
+        BOOST_CHECK(rst1.getRestartData<float>("PRESSURE", 25, 0) == rst2.getRestartData<float>("PRESSURE", 25, 0));
+        BOOST_CHECK(rst1.getRestartData<float>("SWAT", 25, 0) == rst2.getRestartData<float>("SWAT", 25, 0));
+        BOOST_CHECK(rst1.getRestartData<std::string>("ZWEL", 25, 0) == rst2.getRestartData<std::string>("ZWEL", 25, 0));
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(TestERst_5a) {
 
     std::string testRstFile = "LGR_TESTMOD.X0002";
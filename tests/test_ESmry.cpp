@@ -421,6 +421,105 @@ BOOST_AUTO_TEST_CASE(TestESmry_5) {
 
 
 namespace fs = std::filesystem;
+BOOST_AUTO_TEST_CASE(TestColumnCache) {
+    ESmry ref("SPE1CASE1.SMSPEC");
+    ref.loadData();
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        BOOST_CHECK(smry.use_column_cache());
+        BOOST_CHECK(fs::exists("SPE1CASE1.SMRYCACHE"));
+
+        for (const auto& key : ref.keywordList())
+            BOOST_CHECK(smry.get(key) == ref.get(key));
+    }
+
+    const auto cacheTime = fs::last_write_time("SPE1CASE1.SMRYCACHE");
+
+    {
+        // Cache is valid, vectors are read from it.
+        ESmry smry("SPE1CASE1.SMSPEC");
+        BOOST_CHECK(smry.use_column_cache());
+        BOOST_CHECK(fs::last_write_time("SPE1CASE1.SMRYCACHE") == cacheTime);
+
+        BOOST_CHECK(smry.get("WOPR:PROD") == ref.get("WOPR:PROD"));
+        BOOST_CHECK(smry.get_at_rstep("FGOR") == ref.get_at_rstep("FGOR"));
+
+        smry.loadData();
+        BOOST_CHECK(smry.get("TIME") == ref.get("TIME"));
+    }
+
+    // Touching a summary file invalidates the cache.
+    fs::last_write_time("SPE1CASE1.UNSMRY", cacheTime + std::chrono::hours(1));
+
+    {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        BOOST_CHECK(smry.use_column_cache());
+        BOOST_CHECK(fs::last_write_time("SPE1CASE1.SMRYCACHE") != cacheTime);
+        BOOST_CHECK(smry.get("WBHP:INJ") == ref.get("WBHP:INJ"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestFollow) {
+    ESmry ref("SPE1CASE1.SMSPEC");
+    ref.loadData();
+
+    Opm::EclIO::EclFile unsmry("SPE1CASE1.UNSMRY");
+    unsmry.loadData();
+
+    const auto arrays = unsmry.getList();
+
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+
+    // Append arrays [from, to) of the reference summary file, as done by a
+    // running simulator.
+    auto append = [&unsmry, &arrays](std::size_t from, std::size_t to)
+    {
+        Opm::EclIO::EclOutput outFile("SPE1CASE1.UNSMRY", false, std::ios::app);
+
+        for (std::size_t n = from; n < to; n++) {
+            const auto& name = std::get<0>(arrays[n]);
+            if (name == "PARAMS")
+                outFile.write<float>(name, unsmry.get<float>(n));
+            else
+                outFile.write<int>(name, unsmry.get<int>(n));
+        }
+    };
+
+    // SEQHDR + 3 x (MINISTEP, PARAMS)
+    append(0, 7);
+
+    ESmry smry("SPE1CASE1.SMSPEC");
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), 3U);
+    BOOST_CHECK_EQUAL(smry.follow(), 0U);
+
+    const auto& wopr = smry.get("WOPR:PROD");
+    BOOST_CHECK_EQUAL(wopr.size(), 3U);
+
+    // Two more ministeps, and the MINISTEP array of the third one without
+    // its PARAMS.
+    append(7, 14);
+    BOOST_CHECK_EQUAL(smry.follow(), 2U);
+    BOOST_CHECK_EQUAL(wopr.size(), 5U);
+
+    append(14, arrays.size());
+    const auto numTimeSteps = ref.numberOfTimeSteps();
+    BOOST_CHECK_EQUAL(smry.follow(), numTimeSteps - 5);
+    BOOST_CHECK_EQUAL(smry.follow(), 0U);
+
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), numTimeSteps);
+    BOOST_CHECK(smry.get("WOPR:PROD") == ref.get("WOPR:PROD"));
+    BOOST_CHECK(smry.get("FGOR") == ref.get("FGOR"));
+    BOOST_CHECK(smry.dates() == ref.dates());
+    BOOST_CHECK(smry.get_at_rstep("WBHP:INJ") == ref.get_at_rstep("WBHP:INJ"));
+    BOOST_CHECK(smry.all_steps_available());
+}
+
 BOOST_AUTO_TEST_CASE(TestCreateRSM) {
     ESmry smry1("SPE1CASE1.SMSPEC");
     smry1.loadData();
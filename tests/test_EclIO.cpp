@@ -243,6 +243,61 @@ BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped) {
+
+    std::string testFile1="ECLFILE.INIT";
+    std::string testFile2="ECLFILE.FINIT";
+
+    EclFile file1(testFile1);
+    EclFile file2(testFile1);
+
+    BOOST_CHECK(!file2.memoryMapped());
+
+    auto icon = file2.view<int>("ICON");
+    auto porv = file2.view<float>("PORV");
+    auto xcon = file2.view<double>(3);
+    auto logih = file2.view<bool>("LOGIHEAD");
+
+    BOOST_CHECK(file2.memoryMapped());
+
+    // Arrays spanning several Fortran records, compared both element by
+    // element and through bulk decoding.
+
+    const auto& ref_icon = file1.get<int>("ICON");
+    BOOST_CHECK_EQUAL(icon.size(), ref_icon.size());
+    for (std::size_t i = 0; i < icon.size(); i++)
+        BOOST_CHECK_EQUAL(icon[i], ref_icon[i]);
+
+    BOOST_CHECK(icon.toVector() == ref_icon);
+    BOOST_CHECK(porv.toVector() == file1.get<float>("PORV"));
+    BOOST_CHECK(xcon.toVector() == file1.get<double>("XCON"));
+    BOOST_CHECK(logih.toVector() == file1.get<bool>("LOGIHEAD"));
+
+    BOOST_CHECK(std::equal(porv.begin(), porv.end(), file1.get<float>("PORV").begin()));
+
+    BOOST_CHECK_THROW(icon.at(icon.size()), std::out_of_range);
+    BOOST_CHECK_THROW(file2.view<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<double>("NO_SUCH"), std::invalid_argument);
+    BOOST_CHECK_THROW(file2.view<double>(-1), std::invalid_argument);
+    BOOST_CHECK_THROW(file2.view<double>(static_cast<int>(file2.size())), std::invalid_argument);
+    BOOST_CHECK_THROW(file2.get<double>(static_cast<int>(file2.size())), std::invalid_argument);
+
+    // Regular get<>() decodes from the mapping once it has been enabled.
+
+    BOOST_CHECK(file2.get<float>("PORV") == file1.get<float>("PORV"));
+    BOOST_CHECK(file2.get<std::string>("KEYWORDS") == file1.get<std::string>("KEYWORDS"));
+
+    file2.setNumThreads(3);
+    file2.loadData();
+    BOOST_CHECK(file2.get<double>("XCON") == file1.get<double>("XCON"));
+    BOOST_CHECK(file2.get<bool>("LOGIHEAD") == file1.get<bool>("LOGIHEAD"));
+
+    EclFile file3(testFile2);
+    BOOST_CHECK_THROW(file3.enableMemoryMapping(), std::runtime_error);
+    BOOST_CHECK_THROW(file3.view<int>("ICON"), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_IX) {
 
     // file MODEL1_IX.INIT is output from comercial simulator ix with
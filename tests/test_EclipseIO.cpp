@@ -303,7 +303,7 @@ WELSPECS
 /
 )" };
 
-    auto write_and_check = [&deckString]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&deckString]( int first = 1, int last = 5, std::size_t maxPending = 0 ) {
         const auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         const auto& eclGrid = es.getInputGrid();
@@ -313,6 +313,7 @@ WELSPECS
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        eclWriter.setAsyncOutput(maxPending);
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -360,7 +361,16 @@ WELSPECS
                                     first_step - start_time,
                                     std::move(restart_value));
 
-            checkRestartFile(i);
+            if (maxPending == 0) {
+                checkRestartFile(i);
+            }
+        }
+
+        if (maxPending > 0) {
+            eclWriter.flush();
+            for (int i = first; i < last; ++i) {
+                checkRestartFile(i);
+            }
         }
 
         checkInitFile(deck, eGridProps);
@@ -435,6 +445,10 @@ WELSPECS
     // Verify that restarting a simulation, then writing fewer steps truncates
     // the file
     BOOST_CHECK_EQUAL(file_size, write_and_check(3, 5));
+
+    // Output on a background thread creates the same files.
+    BOOST_CHECK_EQUAL(file_size, write_and_check(1, 5, 1));
+    BOOST_CHECK_EQUAL(file_size, write_and_check(1, 5, 3));
 }
 
 namespace {
@@ -0,0 +1,358 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE EVALUATION_BATCH_TESTS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/EvaluationBatch.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/IdealGas.hpp>
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+#include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/DeadOilPvt.hpp>
+
+#include <array>
+#include <vector>
+#include <stdexcept>
+
+namespace {
+
+constexpr int numVars = 3;
+constexpr int width = 4;
+
+using Batch = Opm::DenseAd::EvaluationBatch<double, numVars, width>;
+using Eval = Opm::DenseAd::Evaluation<double, numVars>;
+
+// Lane l has value base[l], and derivative i + 1 + l/10 w.r.t. variable i.
+Batch makeBatch(const std::array<double, width>& base)
+{
+    Batch result;
+    for (int l = 0; l < width; ++l) {
+        Eval lane(base[l]);
+        for (int i = 0; i < numVars; ++i)
+            lane.setDerivative(i, i + 1 + 0.1*l);
+
+        result.setLane(l, lane);
+    }
+
+    return result;
+}
+
+void checkLanes(const Batch& batch, const std::array<Eval, width>& expected)
+{
+    for (int l = 0; l < width; ++l) {
+        const auto lane = batch.lane(l);
+        BOOST_CHECK_CLOSE(lane.value(), expected[l].value(), 1e-10);
+        for (int i = 0; i < numVars; ++i)
+            BOOST_CHECK_CLOSE(lane.derivative(i), expected[l].derivative(i), 1e-10);
+    }
+}
+
+template <class BatchFunction, class EvalFunction>
+void checkUnary(const std::array<double, width>& base,
+                BatchFunction batchFunction,
+                EvalFunction evalFunction)
+{
+    const auto x = makeBatch(base);
+
+    std::array<Eval, width> expected;
+    for (int l = 0; l < width; ++l)
+        expected[l] = evalFunction(x.lane(l));
+
+    checkLanes(batchFunction(x), expected);
+}
+
+template <class BatchFunction, class EvalFunction>
+void checkBinary(const std::array<double, width>& base1,
+                 const std::array<double, width>& base2,
+                 BatchFunction batchFunction,
+                 EvalFunction evalFunction)
+{
+    const auto x = makeBatch(base1);
+    const auto y = makeBatch(base2)*2.0;
+
+    std::array<Eval, width> expected;
+    for (int l = 0; l < width; ++l)
+        expected[l] = evalFunction(x.lane(l), y.lane(l));
+
+    checkLanes(batchFunction(x, y), expected);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Lanes)
+{
+    const auto x = Batch::createVariable(Batch::LaneValues{1.0, 2.0, 3.0, 4.0}, 1);
+
+    for (int l = 0; l < width; ++l) {
+        BOOST_CHECK_EQUAL(x.value()[l], l + 1.0);
+        BOOST_CHECK_EQUAL(x.derivative(0)[l], 0.0);
+        BOOST_CHECK_EQUAL(x.derivative(1)[l], 1.0);
+        BOOST_CHECK_EQUAL(x.derivative(2)[l], 0.0);
+    }
+
+    const auto c = Batch(5.0);
+    for (int l = 0; l < width; ++l) {
+        BOOST_CHECK_EQUAL(c.value()[l], 5.0);
+        for (int i = 0; i < numVars; ++i)
+            BOOST_CHECK_EQUAL(c.derivative(i)[l], 0.0);
+    }
+
+    auto y = c;
+    y.setLane(2, Eval::createVariable(7.0, 0));
+    BOOST_CHECK_EQUAL(y.value()[2], 7.0);
+    BOOST_CHECK_EQUAL(y.derivative(0)[2], 1.0);
+    BOOST_CHECK_EQUAL(y.value()[1], 5.0);
+    BOOST_CHECK(y.lane(2) == Eval::createVariable(7.0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(Arithmetic)
+{
+    const auto a = std::array<double, width>{1.0, -2.0, 3.5, 0.25};
+    const auto b = std::array<double, width>{4.0, 0.5, -1.5, 2.0};
+
+    checkBinary(a, b, [](const auto& x, const auto& y) { return x + y; },
+                [](const auto& x, const auto& y) { return x + y; });
+    checkBinary(a, b, [](const auto& x, const auto& y) { return x - y; },
+                [](const auto& x, const auto& y) { return x - y; });
+    checkBinary(a, b, [](const auto& x, const auto& y) { return x*y; },
+                [](const auto& x, const auto& y) { return x*y; });
+    checkBinary(a, b, [](const auto& x, const auto& y) { return x/y; },
+                [](const auto& x, const auto& y) { return x/y; });
+
+    checkUnary(a, [](const auto& x) { return -x; }, [](const auto& x) { return -x; });
+    checkUnary(a, [](const auto& x) { return 2.0 + x; }, [](const auto& x) { return 2.0 + x; });
+    checkUnary(a, [](const auto& x) { return 2.0 - x; }, [](const auto& x) { return 2.0 - x; });
+    checkUnary(a, [](const auto& x) { return 2.0*x; }, [](const auto& x) { return 2.0*x; });
+    checkUnary(a, [](const auto& x) { return 2.0/x; }, [](const auto& x) { return 2.0/x; });
+    checkUnary(a, [](const auto& x) { return x - 2.0; }, [](const auto& x) { return x - 2.0; });
+    checkUnary(a, [](const auto& x) { return x/2.0; }, [](const auto& x) { return x/2.0; });
+}
+
+BOOST_AUTO_TEST_CASE(Functions)
+{
+    using Toolbox = Opm::MathToolbox<Batch>;
+
+    const auto a = std::array<double, width>{0.1, 0.3, 0.5, 0.7};
+    const auto b = std::array<double, width>{1.5, 2.0, 3.0, 4.5};
+    const auto s = std::array<double, width>{-0.5, 0.25, -0.125, 2.0};
+
+#define CHECK_UNARY(base, fn)                                           \
+    checkUnary(base, [](const auto& x) { return Toolbox::fn(x); },      \
+               [](const auto& x) { return Opm::DenseAd::fn(x); })
+
+    CHECK_UNARY(s, abs);
+    CHECK_UNARY(a, tan);
+    CHECK_UNARY(s, atan);
+    CHECK_UNARY(s, sin);
+    CHECK_UNARY(a, asin);
+    CHECK_UNARY(s, sinh);
+    CHECK_UNARY(s, asinh);
+    CHECK_UNARY(s, cos);
+    CHECK_UNARY(a, acos);
+    CHECK_UNARY(s, cosh);
+    CHECK_UNARY(b, acosh);
+    CHECK_UNARY(b, sqrt);
+    CHECK_UNARY(s, exp);
+    CHECK_UNARY(b, log);
+    CHECK_UNARY(b, log10);
+
+#undef CHECK_UNARY
+
+    checkBinary(s, a, [](const auto& x, const auto& y) { return Toolbox::min(x, y); },
+                [](const auto& x, const auto& y) { return Opm::min(x, y); });
+    checkBinary(s, a, [](const auto& x, const auto& y) { return Toolbox::max(x, y); },
+                [](const auto& x, const auto& y) { return Opm::max(x, y); });
+    checkBinary(s, a, [](const auto& x, const auto& y) { return Toolbox::atan2(x, y); },
+                [](const auto& x, const auto& y) { return Opm::atan2(x, y); });
+    checkBinary(b, a, [](const auto& x, const auto& y) { return Toolbox::pow(x, y); },
+                [](const auto& x, const auto& y) { return Opm::pow(x, y); });
+
+    checkUnary(s, [](const auto& x) { return Toolbox::min(x, 0.1); },
+               [](const auto& x) { return Opm::min(x, 0.1); });
+    checkUnary(s, [](const auto& x) { return Toolbox::max(0.1, x); },
+               [](const auto& x) { return Opm::max(0.1, x); });
+    checkUnary(b, [](const auto& x) { return Toolbox::pow(x, 1.5); },
+               [](const auto& x) { return Opm::pow(x, 1.5); });
+    checkUnary(s, [](const auto& x) { return Toolbox::pow(2.0, x); },
+               [](const auto& x) { return Opm::pow(2.0, x); });
+
+    // a zero base gives zero value and derivatives, as for the scalar
+    // evaluation
+    checkUnary(std::array<double, width>{0.0, 1.0, 0.0, 2.0},
+               [](const auto& x) { return Toolbox::pow(x, 2.5); },
+               [](const auto& x) { return Opm::pow(x, 2.5); });
+}
+
+BOOST_AUTO_TEST_CASE(Comparisons)
+{
+    const auto x = Batch(Batch::LaneValues{1.0, 2.0, 3.0, 4.0});
+
+    BOOST_CHECK((x > 0.5).all());
+    BOOST_CHECK((x < 5.0).all());
+    BOOST_CHECK((0.5 < x).all());
+    BOOST_CHECK((x >= 1.0).all());
+    BOOST_CHECK(!(x > 5.0).any());
+    BOOST_CHECK(x == x);
+    BOOST_CHECK(x != Batch(1.0));
+    BOOST_CHECK((Batch(1.0) == 1.0).all());
+
+    const auto mask = x > 2.5;
+    for (int l = 0; l < width; ++l)
+        BOOST_CHECK_EQUAL(mask[l], l >= 2);
+
+    BOOST_CHECK(mask.any());
+    BOOST_CHECK(!mask.all());
+    BOOST_CHECK_EQUAL((!mask)[0], true);
+    BOOST_CHECK_EQUAL((mask && x < 3.5)[2], true);
+    BOOST_CHECK_EQUAL((mask && x < 3.5)[3], false);
+    BOOST_CHECK_EQUAL((mask || x < 1.5)[0], true);
+    BOOST_CHECK_EQUAL((mask || x < 1.5)[1], false);
+
+    // branching is only possible if all lanes agree
+    BOOST_CHECK(static_cast<bool>(x > 0.5));
+    BOOST_CHECK_THROW((void)static_cast<bool>(mask), std::logic_error);
+    BOOST_CHECK_THROW((void)static_cast<bool>(x == 1.0), std::logic_error);
+
+    const auto y = Opm::DenseAd::select(mask, x, -x);
+    for (int l = 0; l < width; ++l)
+        BOOST_CHECK_EQUAL(y.value()[l], l >= 2 ? x.value()[l] : -x.value()[l]);
+
+    const auto z = Opm::DenseAd::select(mask, 0.0, x);
+    for (int l = 0; l < width; ++l)
+        BOOST_CHECK_EQUAL(z.value()[l], l >= 2 ? 0.0 : x.value()[l]);
+}
+
+BOOST_AUTO_TEST_CASE(MaterialLaw)
+{
+    // code which does not branch on the values runs unchanged for a batch
+    using Gas = Opm::IdealGas<double>;
+
+    const auto molarMass = Batch(0.016);
+    const auto temperature = Batch::createVariable(Batch::LaneValues{280.0, 300.0, 320.0, 340.0}, 0);
+    const auto pressure = Batch::createVariable(Batch::LaneValues{1e5, 2e5, 3e5, 4e5}, 1);
+
+    const auto rho = Gas::density(molarMass, temperature, pressure);
+
+    std::array<Eval, width> expected;
+    for (int l = 0; l < width; ++l)
+        expected[l] = Gas::density(molarMass.lane(l), temperature.lane(l), pressure.lane(l));
+
+    checkLanes(rho, expected);
+
+    BOOST_CHECK(Opm::MathToolbox<Batch>::isfinite(rho));
+    BOOST_CHECK(!Opm::MathToolbox<Batch>::isnan(rho));
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedFunctions)
+{
+    // every lane falls into a different segment, the first and the last one
+    // are extrapolated
+    const auto x = makeBatch({-0.5, 0.5, 1.5, 3.5});
+
+    const std::vector<double> xs{0.0, 1.0, 2.0, 3.0};
+    const std::vector<double> ys{1.0, 3.0, 2.0, 5.0};
+    const Opm::Tabulated1DFunction<double> f(xs, ys);
+
+    std::array<Eval, width> expected;
+    for (int l = 0; l < width; ++l)
+        expected[l] = f.eval(x.lane(l), /*extrapolate=*/true);
+
+    checkLanes(f.eval(x, /*extrapolate=*/true), expected);
+
+    Opm::UniformXTabulated2DFunction<double> g;
+    for (int i = 0; i < 3; ++i) {
+        const auto xIdx = g.appendXPos(i);
+        for (int j = 0; j < 4; ++j)
+            g.appendSamplePoint(xIdx, j + 0.5*i, (i + 1)*(j + 1) + 0.5*j*j);
+    }
+
+    const auto y = makeBatch({0.75, 1.5, 2.25, 3.25});
+    const auto u = makeBatch({0.25, 0.5, 1.25, 1.75});
+    for (int l = 0; l < width; ++l)
+        expected[l] = g.eval(u.lane(l), y.lane(l), /*extrapolate=*/true);
+
+    checkLanes(g.eval(u, y, /*extrapolate=*/true), expected);
+}
+
+BOOST_AUTO_TEST_CASE(DeadOil)
+{
+    Opm::DeadOilPvt<double> pvt;
+    pvt.setNumRegions(1);
+    pvt.setReferenceDensities(0, 850.0, 1.0, 1000.0);
+
+    const std::vector<double> p{1e5, 1e6, 1e7, 3e7};
+    const std::vector<double> invB{0.95, 0.96, 0.98, 0.99};
+    const std::vector<double> mu{2.0e-3, 1.9e-3, 1.7e-3, 1.6e-3};
+    pvt.setInverseOilFormationVolumeFactor(0, Opm::Tabulated1DFunction<double>(p, invB));
+    pvt.setOilViscosity(0, Opm::Tabulated1DFunction<double>(p, mu));
+    pvt.initEnd();
+
+    const auto T = Batch(300.0);
+    const auto Rs = Batch(0.0);
+    const auto pressure = makeBatch({5e4, 5e5, 5e6, 2e7})*2.0;
+
+    std::array<Eval, width> expectedB, expectedMu;
+    for (int l = 0; l < width; ++l) {
+        const auto pl = pressure.lane(l);
+        expectedB[l] = pvt.inverseFormationVolumeFactor(0, T.lane(l), pl, Rs.lane(l));
+        expectedMu[l] = pvt.viscosity(0, T.lane(l), pl, Rs.lane(l));
+    }
+
+    checkLanes(pvt.inverseFormationVolumeFactor(0, T, pressure, Rs), expectedB);
+    checkLanes(pvt.viscosity(0, T, pressure, Rs), expectedMu);
+}
+
+BOOST_AUTO_TEST_CASE(PiecewiseLinear)
+{
+    using Traits = Opm::TwoPhaseMaterialTraits<double, /*wettingPhaseIdx=*/0,
+                                               /*nonWettingPhaseIdx=*/1>;
+    using TwoPhaseLaw = Opm::PiecewiseLinearTwoPhaseMaterial<Traits>;
+
+    TwoPhaseLaw::Params params;
+    const std::vector<double> Sw{0.2, 0.4, 0.6, 0.8};
+    params.setKrwSamples(Sw, std::vector<double>{0.0, 0.1, 0.4, 0.8});
+    params.setKrnSamples(Sw, std::vector<double>{0.9, 0.5, 0.2, 0.0});
+    params.setPcnwSamples(Sw, std::vector<double>{3e5, 1e5, 5e4, 1e4});
+    params.finalize();
+
+    // the lanes lie below, inside and above the table
+    const auto S = makeBatch({0.1, 0.3, 0.65, 0.9});
+
+    std::array<Eval, width> expectedKrw, expectedKrn, expectedPc, expectedInv;
+    for (int l = 0; l < width; ++l) {
+        expectedKrw[l] = TwoPhaseLaw::twoPhaseSatKrw(params, S.lane(l));
+        expectedKrn[l] = TwoPhaseLaw::twoPhaseSatKrn(params, S.lane(l));
+        expectedPc[l] = TwoPhaseLaw::twoPhaseSatPcnw(params, S.lane(l));
+    }
+
+    checkLanes(TwoPhaseLaw::twoPhaseSatKrw(params, S), expectedKrw);
+    checkLanes(TwoPhaseLaw::twoPhaseSatKrn(params, S), expectedKrn);
+    checkLanes(TwoPhaseLaw::twoPhaseSatPcnw(params, S), expectedPc);
+
+    // descending x values
+    const auto pc = makeBatch({4e5, 2e5, 7e4, 5e3});
+    for (int l = 0; l < width; ++l)
+        expectedInv[l] = TwoPhaseLaw::twoPhaseSatPcnwInv(params, pc.lane(l));
+
+    checkLanes(TwoPhaseLaw::twoPhaseSatPcnwInv(params, pc), expectedInv);
+}
@@ -0,0 +1,188 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE EVALUATION_EXPRESSION_TESTS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationExpression.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/components/SimpleHuDuanH2O.hpp>
+#include <opm/material/components/CO2.hpp>
+
+#include <type_traits>
+
+namespace {
+
+using Eval = Opm::DenseAd::Evaluation<double, 3>;
+
+Eval makeEval(double value, double d0, double d1, double d2)
+{
+    Eval result(value);
+    result.setDerivative(0, d0);
+    result.setDerivative(1, d1);
+    result.setDerivative(2, d2);
+    return result;
+}
+
+void checkSame(const Eval& a, const Eval& b)
+{
+    BOOST_CHECK_CLOSE(a.value(), b.value(), 1e-10);
+    for (int i = 0; i < Eval::numVars; ++i)
+        BOOST_CHECK_CLOSE(a.derivative(i), b.derivative(i), 1e-10);
+}
+
+// Evaluates the same formula with and without expression templates.
+template <class Formula>
+void checkFormula(const Eval& x, const Eval& y, Formula formula)
+{
+    const Eval eager = formula(x, y);
+    const Eval lazy = formula(Opm::DenseAd::lazy(x), Opm::DenseAd::lazy(y));
+    checkSame(lazy, eager);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Arithmetic)
+{
+    const auto x = makeEval(0.75, 1.0, 0.5, -2.0);
+    const auto y = makeEval(-1.5, 0.25, 3.0, 1.0);
+
+    checkFormula(x, y, [](const auto& a, const auto& b) { return a + b; });
+    checkFormula(x, y, [](const auto& a, const auto& b) { return a - b; });
+    checkFormula(x, y, [](const auto& a, const auto& b) { return a*b; });
+    checkFormula(x, y, [](const auto& a, const auto& b) { return a/b; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return -a; });
+
+    checkFormula(x, y, [](const auto& a, const auto&) { return 2.0 + a; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return a + 2.0; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return 2.0 - a; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return a - 2.0; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return 2.0*a; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return a*2; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return 2.0/a; });
+    checkFormula(x, y, [](const auto& a, const auto&) { return a/2.0; });
+
+    checkFormula(x, y, [](const auto& a, const auto& b)
+                 { return (a*a*b - 3*b)/(1 - a*b) + 2*(a - 0.5)*(b + 4); });
+}
+
+BOOST_AUTO_TEST_CASE(MixedOperands)
+{
+    using Opm::DenseAd::lazy;
+
+    const auto x = makeEval(0.75, 1.0, 0.5, -2.0);
+    const auto y = makeEval(-1.5, 0.25, 3.0, 1.0);
+
+    // plain Evaluation operands, lvalues as well as temporaries
+    checkSame(lazy(x)*y, x*y);
+    checkSame(y - lazy(x), y - x);
+    checkSame(lazy(x)/(x + y), x/(x + y));
+    checkSame((x*y) + lazy(y), (x*y) + y);
+
+    // assignment and explicit evaluation
+    Eval z;
+    z = lazy(x)*lazy(x) + y;
+    checkSame(z, x*x + y);
+    checkSame((lazy(x) + 1.0).evaluate(), x + 1.0);
+
+    // scalars pass through unchanged
+    static_assert(std::is_same<decltype(lazy(1.0)), const double&>::value);
+    BOOST_CHECK_EQUAL(lazy(2.0)*3.0, 6.0);
+}
+
+BOOST_AUTO_TEST_CASE(Functions)
+{
+    const auto x = makeEval(0.25, 1.0, 0.5, -2.0);
+    const auto y = makeEval(1.5, 0.25, 3.0, 1.0);
+
+#define CHECK_FUNCTION(arg, fn)                                         \
+    checkFormula(x, y, [](const auto& a, const auto& b)                 \
+                 { using namespace Opm::DenseAd; (void)a; (void)b; return fn(arg); })
+
+    CHECK_FUNCTION(a, abs);
+    CHECK_FUNCTION(-a, abs);
+    CHECK_FUNCTION(a, exp);
+    CHECK_FUNCTION(b, log);
+    CHECK_FUNCTION(b, log10);
+    CHECK_FUNCTION(b, sqrt);
+    CHECK_FUNCTION(a, sin);
+    CHECK_FUNCTION(a, cos);
+    CHECK_FUNCTION(a, tan);
+    CHECK_FUNCTION(a, asin);
+    CHECK_FUNCTION(a, acos);
+    CHECK_FUNCTION(a, atan);
+    CHECK_FUNCTION(a, sinh);
+    CHECK_FUNCTION(a, cosh);
+    CHECK_FUNCTION(a, asinh);
+    CHECK_FUNCTION(b, acosh);
+
+#undef CHECK_FUNCTION
+
+    checkFormula(x, y, [](const auto& a, const auto& b) { return atan2(a, b); });
+    checkFormula(x, y, [](const auto& a, const auto& b) { return pow(b, a); });
+    checkFormula(x, y, [](const auto& a, const auto&) { return pow(a, 1.5); });
+    checkFormula(x, y, [](const auto& a, const auto&) { return pow(2.0, a); });
+    checkFormula(x, y, [](const auto& a, const auto& b) { return exp(a*b)*log(b/(b + a)); });
+
+    const auto zero = Eval(0.0);
+    checkFormula(zero, y, [](const auto& a, const auto&) { return pow(a, 1.5); });
+    checkFormula(zero, y, [](const auto& a, const auto& b) { return pow(a, b); });
+}
+
+BOOST_AUTO_TEST_CASE(FugacityCoefficients)
+{
+    // Brine_CO2 evaluates its Redlich-Kwong formulas by expressions; compare
+    // with a finite difference of the scalar version.
+    using H2O = Opm::SimpleHuDuanH2O<double>;
+    using CO2 = Opm::CO2<double>;
+    using BinaryCoeff = Opm::BinaryCoeff::Brine_CO2<double, H2O, CO2>;
+    using Eval2 = Opm::DenseAd::Evaluation<double, 2>;
+
+    for (const bool highTemp : { false, true }) {
+        const double T = highTemp ? 400.0 : 330.0;
+        const double p = 2.0e7;
+        const double yH2O = 0.02;
+
+        const auto TEval = Eval2::createVariable(T, 0);
+        const auto pEval = Eval2::createVariable(p, 1);
+        const auto yEval = Eval2(yH2O);
+
+        const auto phiCO2 = BinaryCoeff::fugacityCoefficientCO2(TEval, pEval, yEval, highTemp);
+        const auto phiH2O = BinaryCoeff::fugacityCoefficientH2O(TEval, pEval, yEval, highTemp);
+
+        BOOST_CHECK_CLOSE(phiCO2.value(),
+                          BinaryCoeff::fugacityCoefficientCO2(T, p, yH2O, highTemp), 1e-10);
+        BOOST_CHECK_CLOSE(phiH2O.value(),
+                          BinaryCoeff::fugacityCoefficientH2O(T, p, yH2O, highTemp), 1e-10);
+
+        const double dp = 1.0;
+        const double dPhiCO2_dp =
+            (BinaryCoeff::fugacityCoefficientCO2(T, p + dp, yH2O, highTemp)
+             - BinaryCoeff::fugacityCoefficientCO2(T, p - dp, yH2O, highTemp))/(2*dp);
+        const double dPhiH2O_dp =
+            (BinaryCoeff::fugacityCoefficientH2O(T, p + dp, yH2O, highTemp)
+             - BinaryCoeff::fugacityCoefficientH2O(T, p - dp, yH2O, highTemp))/(2*dp);
+
+        BOOST_CHECK_CLOSE(phiCO2.derivative(1), dPhiCO2_dp, 1e-3);
+        BOOST_CHECK_CLOSE(phiH2O.derivative(1), dPhiH2O_dp, 1e-3);
+    }
+}
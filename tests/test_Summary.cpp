@@ -2944,6 +2944,68 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_EQUAL(st.get_conn_var("OP2", "COPR", 101, 99), 99);
 }
 
+BOOST_AUTO_TEST_CASE(Test_SummaryState_Handles) {
+    Opm::SummaryState st(TimeService::now(), -1.0);
+
+    const auto wopr = Opm::SummaryState::WellVarHandle { "OP1", "WOPR" };
+    const auto wopt = Opm::SummaryState::WellVarHandle { "OP1", "WOPT" };
+    const auto gopr = Opm::SummaryState::GroupVarHandle { "G1", "GOPR" };
+
+    BOOST_CHECK_THROW(st.get_well_var(wopr), std::invalid_argument);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr, 2.0), 2.0);
+    BOOST_CHECK_EQUAL(st.get_well_var(Opm::SummaryState::WellVarHandle { "OP1", "WUX" }), -1.0);
+
+    st.update_well_var(wopr, 10.0);
+    st.update_well_var(wopr, 20.0);
+    st.update_well_var(wopt, 10.0);
+    st.update_well_var(wopt, 20.0);
+    st.update_group_var(gopr, 30.0);
+
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr), 20.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 20.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 20.0);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopt), 30.0);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 30.0);
+    BOOST_CHECK_EQUAL(st.get_group_var(gopr), 30.0);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPR"), 30.0);
+    BOOST_CHECK_EQUAL(st.num_wells(), 1U);
+    BOOST_CHECK_EQUAL(st.groups().size(), 1U);
+
+    // Handles and names refer to the same variable.
+    st.update_well_var("OP1", "WOPR", 40.0);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr), 40.0);
+
+    // The general key is independent of the well variable.
+    st.set("WOPR:OP1", 50.0);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr), 40.0);
+
+    // Handles remain valid with copies, and are rebound after changes
+    // to the layout of either object.
+    auto copy = st;
+    copy.update_well_var("OP2", "WOPR", 1.0);
+    copy.update_well_var(wopr, 60.0);
+    BOOST_CHECK_EQUAL(copy.get_well_var(wopr), 60.0);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr), 40.0);
+
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPR"));
+    BOOST_CHECK_THROW(st.get_well_var(wopr), std::invalid_argument);
+    st.update_well_var(wopr, 70.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 70.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 70.0);
+
+    std::size_t count = 0;
+    for (const auto& [key, value] : st) {
+        BOOST_CHECK_EQUAL(st.get(key), value);
+        ++count;
+    }
+    BOOST_CHECK_EQUAL(count, st.size());
+
+    st.append(copy);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopr), 60.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP2", "WOPR"), 1.0);
+    BOOST_CHECK(st == copy);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary
 
 // ####################################################################
@@ -57,6 +57,23 @@ BOOST_AUTO_TEST_CASE (calc_cellvol)
     BOOST_REQUIRE_CLOSE (calculateCellVol(x2,y2,z2), 15766.9187847524, 1e-9);
     BOOST_REQUIRE_CLOSE (calculateCellVol(x3,y3,z3), 3268.8819007839, 1e-9);
     BOOST_REQUIRE_CLOSE (calculateCellVol(x4,y4,z4), 23391.4917234564, 1e-9);
+
+    /* The batch variant, over more than one block of cells. */
+    const std::size_t n = 150;
+    const std::array<const std::array<double,8>*, 4> xs {{ &x1, &x2, &x3, &x4 }};
+    const std::array<const std::array<double,8>*, 4> ys {{ &y1, &y2, &y3, &y4 }};
+    const std::array<const std::array<double,8>*, 4> zs {{ &z1, &z2, &z3, &z4 }};
+    std::vector<double> X, Y, Z;
+    for (std::size_t cell = 0; cell < n; cell++) {
+        X.insert(X.end(), xs[cell % 4]->begin(), xs[cell % 4]->end());
+        Y.insert(Y.end(), ys[cell % 4]->begin(), ys[cell % 4]->end());
+        Z.insert(Z.end(), zs[cell % 4]->begin(), zs[cell % 4]->end());
+    }
+
+    std::vector<double> volume(n);
+    calculateCellVol(n, X.data(), Y.data(), Z.data(), volume.data());
+    for (std::size_t cell = 0; cell < n; cell++)
+        BOOST_CHECK_EQUAL(volume[cell], calculateCellVol(*xs[cell % 4], *ys[cell % 4], *zs[cell % 4]));
 }
 
 BOOST_AUTO_TEST_CASE (calc_cellvol_cylindric)